@@ -129,6 +129,7 @@ private:
   Frozen_Visc_Cont,         /*!< \brief Flag for cont. adjoint problem with/without frozen viscosity. */
   Frozen_Visc_Disc,         /*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
   Frozen_Limiter_Disc,      /*!< \brief Flag for disc. adjoint problem with/without frozen limiter. */
+  Frozen_ConvJac_Disc,      /*!< \brief Flag for disc. adjoint problem with/without frozen convective flux Jacobians. */
   Inconsistent_Disc,        /*!< \brief Use an inconsistent (primal/dual) discrete adjoint formulation. */
   Sens_Remove_Sharp,        /*!< \brief Flag for removing or not the sharp edges from the sensitivity computation. */
   Hold_GridFixed,           /*!< \brief Flag hold fixed some part of the mesh during the deformation. */
@@ -158,6 +159,7 @@ private:
   su2double **DV_Value;              /*!< \brief Previous value of the design variable. */
   su2double Venkat_LimiterCoeff;     /*!< \brief Limiter coefficient */
   unsigned long LimiterIter;         /*!< \brief Freeze the value of the limiter after a number of iterations */
+  bool FusedGradientLimiter;         /*!< \brief Compute the reconstruction gradient and the limiter in one pass. */
   su2double AdjSharp_LimiterCoeff;   /*!< \brief Coefficient to identify the limit of a sharp edge. */
   unsigned short SystemMeasurements; /*!< \brief System of measurements. */
   ENUM_REGIME Kind_Regime;           /*!< \brief Kind of flow regime: in/compressible. */
@@ -168,6 +170,8 @@ private:
   unsigned short Discrete_Eqns;      /*!< \brief Which equations to treat discretely (Hybrid adjoint). */
   unsigned short *Design_Variable;   /*!< \brief Kind of design variable. */
   unsigned short nTimeInstances;     /*!< \brief Number of periodic time instances for  harmonic balance. */
+  unsigned short nHBParallelGroups;  /*!< \brief Number of groups of ranks that share the time instances of harmonic balance. */
+  unsigned short iHBParallelGroup = 0; /*!< \brief Group of ranks of this rank for harmonic balance. */
   su2double HarmonicBalance_Period;  /*!< \brief Period of oscillation to be used with harmonic balance computations. */
   su2double Delta_UnstTime,          /*!< \brief Time step for unsteady computations. */
   Delta_UnstTimeND;                  /*!< \brief Time step for unsteady computations (non dimensional). */
@@ -404,6 +408,7 @@ private:
   unsigned long InnerIter;          /*!< \brief Current inner iterations for multizone problems. */
   unsigned long TimeIter;           /*!< \brief Current time iterations for multizone problems. */
   long Unst_AdjointIter;            /*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  unsigned long Unst_AdjointCheckpoints; /*!< \brief Number of primal states kept in memory by the unsteady adjoint (0 reads restart files). */
   long Iter_Avg_Objective;          /*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
@@ -413,6 +418,14 @@ private:
   unsigned short nTimeIntegrationADER_DG;   /*!< \brief Number of time integration points ADER-DG. */
   su2double *TimeIntegrationADER_DG;        /*!< \brief The location of the ADER-DG time integration points on the interval [-1,1]. */
   su2double *WeightsIntegrationADER_DG;     /*!< \brief The weights of the ADER-DG time integration points on the interval [-1,1]. */
+
+  unsigned short nTimeParallelGroups;       /*!< \brief Number of groups of ranks that integrate slices of the time window in parallel. */
+  unsigned short iTimeParallelGroup = 0;    /*!< \brief Group of ranks (i.e. time slice) of this rank for parallel-in-time integration. */
+  unsigned short PararealCoarseFactor;      /*!< \brief Ratio of the time steps of the coarse and fine Parareal propagators. */
+  unsigned short nPararealIter;             /*!< \brief Maximum number of Parareal iterations. */
+  su2double PararealTol;                    /*!< \brief Tolerance on the relative change of the initial states of the time slices. */
+  unsigned short TimeExtrapolationOrder;    /*!< \brief Order of the extrapolation of the initial guess of a dual time step. */
+  su2double InnerTruncErrorRatio;           /*!< \brief Inner residual to temporal truncation error ratio that stops dual time inner iterations. */
   unsigned short nRKStep;                   /*!< \brief Number of steps of the explicit Runge-Kutta method. */
   su2double *RK_Alpha_Step;                 /*!< \brief Runge-Kutta beta coefficients. */
 
@@ -421,6 +434,11 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  array<su2double,3> NK_ForcingParam{{0.0, 0.9, 2.0}}; /*!< \brief Eisenstat-Walker forcing parameters for NK method. */
+  unsigned short NK_LineSearchIter;  /*!< \brief Maximum number of backtracking steps of the NK line search. */
+  su2double NK_SwitchContraction;    /*!< \brief Nonlinear contraction that triggers switching between quasi-Newton and NK steps. */
+  bool ActiveSet;              /*!< \brief Restrict the flow residual evaluation to the points that are not converged. */
+  array<su2double,3> ActiveSetParam{{0.01, 2.0, 50.0}}; /*!< \brief Active set parameters {residual ratio, buffer layers, full evaluation frequency}. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -453,6 +471,7 @@ private:
   unsigned short GeometryMode;        /*!< \brief Gemoetry mode (analysis or gradient computation). */
   unsigned short MGCycle;             /*!< \brief Kind of multigrid cycle. */
   unsigned short FinestMesh;          /*!< \brief Finest mesh for the full multigrid approach. */
+  bool MG_Turbulence;                 /*!< \brief Include the turbulence equations in the multigrid cycle of the flow. */
   unsigned short nFFD_Fix_IDir,
   nFFD_Fix_JDir, nFFD_Fix_KDir;       /*!< \brief Number of planes fixed in the FFD. */
   unsigned short nMG_PreSmooth,       /*!< \brief Number of MG pre-smooth parameters found in config file. */
@@ -761,10 +780,12 @@ private:
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
+  Tape_DryRun,               /*!< \brief Only record the tapes to report their memory (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
   Wrt_Projected_Sensitivity, /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
   Plot_Section_Forces;       /*!< \brief Write sectional forces for specified markers. */
+  su2double Tape_DryRun_Fraction;  /*!< \brief Fraction of the points of each rank registered in the tape dry run (discrete adjoint). */
   unsigned short
   Console_Output_Verb,  /*!< \brief Level of verbosity for console output */
   Kind_Average;         /*!< \brief Particular average for the marker analyze. */
@@ -801,6 +822,10 @@ private:
   Mu_Temperature_RefND,  /*!< \brief Non-dimensional reference temperature for Sutherland model.  */
   Mu_S,                  /*!< \brief Reference S for Sutherland model.  */
   Mu_SND;                /*!< \brief Non-dimensional reference S for Sutherland model.  */
+  bool FluidTable;              /*!< \brief Interpolate the thermodynamic properties from a look-up table. */
+  array<unsigned short,2> FluidTable_Size{{300, 300}};    /*!< \brief Number of table nodes in density and energy. */
+  array<su2double,4> FluidTable_Limits{{0.01, 10.0, 0.25, 4.0}}; /*!< \brief Table limits relative to the free-stream state. */
+  string FluidTable_FileName;   /*!< \brief File where the look-up table is stored. */
   array<su2double, N_POLY_COEFFS> CpPolyCoefficientsND{{0.0}};  /*!< \brief Definition of the non-dimensional temperature polynomial coefficients for specific heat Cp. */
   array<su2double, N_POLY_COEFFS> MuPolyCoefficientsND{{0.0}};  /*!< \brief Definition of the non-dimensional temperature polynomial coefficients for viscosity. */
   array<su2double, N_POLY_COEFFS> KtPolyCoefficientsND{{0.0}};  /*!< \brief Definition of the non-dimensional temperature polynomial coefficients for thermal conductivity. */
@@ -1120,6 +1145,7 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool SkipUnusedFields;            /*!< \brief Do not allocate the per-point fields that are unused by the case. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1141,7 +1167,9 @@ private:
   bool frozen,                              /*!< \brief Flag for determining if mixture is frozen. */
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
+  chemistry_splitting,                      /*!< \brief Flag for operator-split integration of the thermochemical sources. */
   monoatomic;                               /*!< \brief Flag for monoatomic mixture. */
+  unsigned short nChemistry_SubSteps;       /*!< \brief Number of point-implicit sub-steps of the split thermochemical sources. */
   string GasModel,                          /*!< \brief Gas Model. */
   *Wall_Catalytic;                          /*!< \brief Pointer to catalytic walls. */
   TRANSCOEFFMODEL   Kind_TransCoeffModel;   /*!< \brief Transport coefficient Model for NEMO solver. */
@@ -2247,6 +2275,12 @@ public:
    */
   unsigned long GetLimiterIter(void) const { return LimiterIter; }
 
+  /*!
+   * \brief Get whether the reconstruction gradient and the limiter are computed in one pass over the points.
+   * \return <code>TRUE</code> if the fused computation is requested.
+   */
+  bool GetFused_Gradient_Limiter(void) const { return FusedGradientLimiter; }
+
   /*!
    * \brief Get the value of sharp edge limiter.
    * \return Value of the sharp edge limiter coefficient.
@@ -2648,6 +2682,12 @@ public:
    */
   unsigned short GetMGCycle(void) const { return MGCycle; }
 
+  /*!
+   * \brief Check if the turbulence equations are part of the (FAS) multigrid cycle of the flow equations.
+   * \return <code>TRUE</code> if the turbulence variables are smoothed, restricted, and prolongated with the flow.
+   */
+  bool GetMG_Turbulence(void) const { return MG_Turbulence; }
+
   /*!
    * \brief Get the king of evaluation in the geometrical module.
    * \return 0 or 1 depending of we are dealing with a V or W cycle.
@@ -2784,6 +2824,45 @@ public:
    */
   void SetnLevels_TimeAccurateLTS(unsigned short val_nLevels) { nLevels_TimeAccurateLTS = val_nLevels;}
 
+  /*!
+   * \brief Get the number of groups of ranks that integrate slices of the time window in parallel.
+   * \return Number of time slices (1 means sequential time integration).
+   */
+  unsigned short GetnTime_Parallel_Groups(void) const { return nTimeParallelGroups; }
+
+  /*!
+   * \brief Get the group of ranks, i.e. the time slice, of this rank for parallel-in-time integration.
+   * \note The ranks of MPI_COMM_WORLD are split in contiguous groups.
+   */
+  unsigned short GetiTime_Parallel_Group(void) const { return iTimeParallelGroup; }
+
+  /*!
+   * \brief Get the ratio between the time steps of the coarse and fine Parareal propagators.
+   */
+  unsigned short GetParareal_Coarse_Factor(void) const { return PararealCoarseFactor; }
+
+  /*!
+   * \brief Get the maximum number of Parareal iterations.
+   */
+  unsigned short GetnParareal_Iter(void) const { return nPararealIter; }
+
+  /*!
+   * \brief Get the Parareal tolerance on the relative change of the initial states of the time slices.
+   */
+  su2double GetParareal_Tol(void) const { return PararealTol; }
+
+  /*!
+   * \brief Get the order of the polynomial extrapolation, from the previous time levels, of the initial
+   *        guess for a new dual time step (0 means starting from the solution at time n).
+   */
+  unsigned short GetTime_Extrapolation_Order(void) const { return TimeExtrapolationOrder; }
+
+  /*!
+   * \brief Get the ratio between the inner residual and the estimated temporal truncation error
+   *        below which the inner iterations of a dual time step stop (0 disables the criterion).
+   */
+  su2double GetInner_TruncError_Ratio(void) const { return InnerTruncErrorRatio; }
+
   /*!
    * \brief Get the number time DOFs for ADER-DG.
    * \return Number of time DOFs used in ADER-DG.
@@ -2964,6 +3043,12 @@ public:
    */
   long GetUnst_AdjointIter(void) const { return Unst_AdjointIter; }
 
+  /*!
+   * \brief Get the number of primal checkpoints kept in memory by the unsteady adjoint.
+   * \return Number of checkpoints, 0 if the primal states are read from restart files.
+   */
+  unsigned long GetUnst_AdjointCheckpoints(void) const { return Unst_AdjointCheckpoints; }
+
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -2976,6 +3061,27 @@ public:
    */
   unsigned short GetnTimeInstances(void) const { return nTimeInstances; }
 
+  /*!
+   * \brief Get the number of groups of ranks that share the time instances of harmonic balance.
+   */
+  unsigned short GetnHB_Parallel_Groups(void) const { return nHBParallelGroups; }
+
+  /*!
+   * \brief Get the group of ranks of this rank for harmonic balance.
+   * \note The ranks of MPI_COMM_WORLD are split in contiguous groups.
+   */
+  unsigned short GetiHB_Parallel_Group(void) const { return iHBParallelGroup; }
+
+  /*!
+   * \brief Get the number of time instances stored by this rank (all, unless HB_PARALLEL_GROUPS > 1).
+   */
+  unsigned short GetnLocal_TimeInstances(void) const { return nTimeInstances / nHBParallelGroups; }
+
+  /*!
+   * \brief Get the (global) index of the first time instance stored by this rank.
+   */
+  unsigned short GetFirst_TimeInstance(void) const { return iHBParallelGroup * GetnLocal_TimeInstances(); }
+
   /*!
    * \brief Retrieves the period of oscillations to be used with Harmonic Balance.
    * \return: Period for Harmonic Balance.
@@ -3054,6 +3160,18 @@ public:
    */
   bool GetWrt_AD_Statistics(void) const { return Wrt_AD_Statistics; }
 
+  /*!
+   * \brief Get information about the dry run of the discrete adjoint.
+   * \return <code>TRUE</code> means that the tapes are recorded to report their memory, without solving the adjoint.
+   */
+  bool GetTape_DryRun(void) const { return Tape_DryRun; }
+
+  /*!
+   * \brief Get the fraction of the points of each rank whose variables are registered in the tape dry run.
+   * \return Fraction in (0,1], 1 records the full tapes.
+   */
+  su2double GetTape_DryRun_Fraction(void) const { return Tape_DryRun_Fraction; }
+
   /*!
    * \brief Get information about writing the mesh quality metrics to the visualization files.
    * \return <code>TRUE</code> means that the mesh quality metrics will be written to the visualization files.
@@ -3707,6 +3825,27 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Get whether the thermodynamic properties are interpolated from a look-up table.
+   * \return <code>TRUE</code> if the fluid model is tabulated.
+   */
+  bool GetFluidTable(void) const { return FluidTable; }
+
+  /*!
+   * \brief Get the number of nodes of the fluid table in the density and energy directions.
+   */
+  array<unsigned short,2> GetFluidTable_Size(void) const { return FluidTable_Size; }
+
+  /*!
+   * \brief Get the limits (min/max density, min/max energy) of the fluid table, relative to the free-stream state.
+   */
+  array<su2double,4> GetFluidTable_Limits(void) const { return FluidTable_Limits; }
+
+  /*!
+   * \brief Get the name of the file where the fluid table is stored.
+   */
+  const string& GetFluidTable_FileName(void) const { return FluidTable_FileName; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -4025,6 +4164,31 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get the Eisenstat-Walker forcing parameters {max forcing term, gamma, alpha}.
+   */
+  array<su2double,3> GetNewtonKrylovForcingParam(void) const { return NK_ForcingParam; }
+
+  /*!
+   * \brief Get the maximum number of backtracking steps of the Newton-Krylov line search (0 disables it).
+   */
+  unsigned short GetNewtonKrylovLineSearchIter(void) const { return NK_LineSearchIter; }
+
+  /*!
+   * \brief Get the nonlinear contraction ratio used to switch between quasi-Newton and Newton-Krylov steps.
+   */
+  su2double GetNewtonKrylovSwitchContraction(void) const { return NK_SwitchContraction; }
+
+  /*!
+   * \brief Get whether the flow residuals are only evaluated on the active (not converged) points.
+   */
+  bool GetActiveSet(void) const { return ActiveSet; }
+
+  /*!
+   * \brief Get the active set parameters {residual ratio, buffer layers, full evaluation frequency}.
+   */
+  array<su2double,3> GetActiveSetParam(void) const { return ActiveSetParam; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -4666,6 +4830,13 @@ public:
    */
   bool GetFrozen_Limiter_Disc(void) const { return Frozen_Limiter_Disc; }
 
+  /*!
+   * \brief Provides information about the way in which the convective edge fluxes (vectorized numerics)
+   *        are differentiated by the disc. adjoint method.
+   * \return <code>TRUE</code> means that the flux Jacobians of the implicit system are used.
+   */
+  bool GetFrozen_ConvJac_Disc(void) const { return Frozen_ConvJac_Disc; }
+
   /*!
    * \brief Provides information about if the sharp edges are going to be removed from the sensitivity.
    * \return <code>FALSE</code> means that the sharp edges will be removed from the sensitivity.
@@ -5143,6 +5314,16 @@ public:
    */
   bool GetVTTransferResidualLimiting(void) const { return vt_transfer_res_limit; }
 
+  /*!
+   * \brief Indicates whether the chemistry and VT relaxation sources are integrated separately from the flow (operator splitting).
+   */
+  bool GetChemistry_Splitting(void) const { return chemistry_splitting; }
+
+  /*!
+   * \brief Get the number of point-implicit sub-steps used to integrate the split thermochemical sources.
+   */
+  unsigned short GetChemistry_SubSteps(void) const { return nChemistry_SubSteps; }
+
   /*!
    * \brief Indicates if mixture is monoatomic.
    */
@@ -8293,15 +8474,15 @@ public:
    * \brief Start the timer for profiling subroutines.
    * \param[in] val_start_time - the value of the start time.
    */
-  void Tick(double *val_start_time);
+  void Tick(double *val_start_time) const;
 
   /*!
    * \brief Stop the timer for profiling subroutines and store results.
    * \param[in] val_start_time - the value of the start time.
    * \param[in] val_function_name - string for the name of the profiled subroutine.
-   * \param[in] val_group_id - string for the name of the profiled subroutine.
+   * \param[in] val_group_id - group of the profiled subroutine (0 = driver phases, 1 = preprocessing sub-steps).
    */
-  void Tock(double val_start_time, string val_function_name, int val_group_id);
+  void Tock(double val_start_time, string val_function_name, int val_group_id) const;
 
   /*!
    * \brief Write a CSV file containing the results of the profiling.
@@ -8326,6 +8507,53 @@ public:
    */
   void GEMMProfilingCSV(void);
 
+  /*!
+   * \brief Start the tape memory accounting of a region of the recording (discrete adjoint).
+   * \param[out] val_start_memory - Tape memory at the start of the region.
+   */
+  void TapeTick(passivedouble *val_start_memory) const;
+
+  /*!
+   * \brief Stop the tape memory accounting of a region of the recording and store the results.
+   * \note Only the master thread accounts, the regions are summed by owner and kind until ClearTapeRegions.
+   * \param[in] val_start_memory - Tape memory at the start of the region.
+   * \param[in] val_owner - Name of the solver (or component) that records the region.
+   * \param[in] val_region - Kind of region.
+   */
+  void TapeTock(passivedouble val_start_memory, const char* val_owner, TAPE_REGION val_region) const;
+
+  /*!
+   * \brief Clear the tape memory accounting, to be called when a new recording starts.
+   */
+  void ClearTapeRegions(void) const;
+
+  /*!
+   * \brief Reduce the tape memory of the regions and of the whole recording over all ranks.
+   * \note Collective operation, each rank records the same regions.
+   * \param[in] val_nPoint_Global - Total number of points of the mesh.
+   * \param[in] val_print - Print a summary table of the regions.
+   */
+  void SetTapeRegions_Summary(unsigned long val_nPoint_Global, bool val_print) const;
+
+  /*!
+   * \brief Get the tape memory of a kind of region in the last recording, summed over owners and ranks.
+   * \param[in] val_region - Kind of region.
+   * \return Memory in MB.
+   */
+  passivedouble GetTapeRegion_Memory(TAPE_REGION val_region) const;
+
+  /*!
+   * \brief Get the memory of the last recording, summed over ranks.
+   * \return Memory in MB.
+   */
+  passivedouble GetTape_Memory(void) const;
+
+  /*!
+   * \brief Get the memory of the last recording on the rank with the largest tape.
+   * \return Memory in MB.
+   */
+  passivedouble GetTape_PeakMemory(void) const;
+
   /*!
    * \brief Set freestream turbonormal for initializing solution.
    */
@@ -9290,6 +9518,11 @@ public:
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Check if the per-point fields that are unused by the case should not be allocated.
+   */
+  bool GetSkip_Unused_Fields(void) const { return SkipUnusedFields; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
@@ -42,6 +42,17 @@
 #define NEVERINLINE inline
 #endif
 
+/*--- Function multi-versioning, the annotated functions are compiled for several
+ * instruction sets and the best one for the host is selected at load time (via
+ * CPUID). Only supported by GCC and Clang on x86-64 and not with AD types. ---*/
+#if defined(HAVE_SIMD_DISPATCH) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && \
+   !defined(__INTEL_COMPILER) && !defined(CODI_FORWARD_TYPE) && !defined(CODI_REVERSE_TYPE)
+#define USE_SIMD_DISPATCH
+#define SU2_MULTIVERSION __attribute__((target_clones("avx512f","avx2","default")))
+#else
+#define SU2_MULTIVERSION
+#endif
+
 #if defined(__INTEL_COMPILER)
 /*--- Disable warnings related to inline attributes. ---*/
 #pragma warning disable 2196
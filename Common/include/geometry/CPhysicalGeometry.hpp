@@ -174,8 +174,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] Elem_Type - VTK index of the element type being distributed.
+   * \param[in] Local2GlobalElem - Global index of the local elements of the linear partition.
    */
-  void DistributeVolumeConnectivity(const CConfig *config, CGeometry *geometry, unsigned short Elem_Type);
+  void DistributeVolumeConnectivity(const CConfig *config, CGeometry *geometry, unsigned short Elem_Type,
+                                    const vector<unsigned long>& Local2GlobalElem);
 
   /*!
    * \brief Distribute the connectivity for a single surface element type in all markers across all ranks based on a ParMETIS coloring.
@@ -710,6 +710,39 @@ public:
     AddBlock2Diag(block_i, val_block, -1.0);
   }
 
+  /*!
+   * \brief SIMD version of AddBlock2Diag, updates the diagonal blocks of multiple points.
+   * \note Nothing is updated if the mask is 0.
+   */
+  template<class MatTypeSIMD, size_t N, class I, class F = ScalarType>
+  FORCEINLINE void AddBlock2Diag(simd::Array<I,N> iPoint, const MatTypeSIMD& block, simd::Array<F,N> mask = 1) {
+
+    static_assert(MatTypeSIMD::StaticSize, "This method requires static size blocks.");
+    static_assert(MatTypeSIMD::IsRowMajor, "Block storage is not compatible with matrix.");
+    constexpr size_t blkSz = MatTypeSIMD::StaticSize;
+    assert(blkSz == nVar*nEqn);
+
+    ScalarType blk[N][blkSz];
+
+    for (size_t i=0; i<blkSz; ++i) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (size_t k=0; k<N; ++k) {
+        blk[k][i] = PassiveAssign(mask[k] * block.data()[i][k]);
+      }
+    }
+
+    for (size_t k=0; k<N; ++k) {
+      if (mask[k]==0) continue;
+
+      auto bii = &matrix[dia_ptr[iPoint[k]]*blkSz];
+
+      SU2_OMP_SIMD
+      for (size_t i=0; i<blkSz; ++i) {
+        bii[i] += blk[k][i];
+      }
+    }
+  }
+
   /*!
    * \brief Adds the specified value to the diagonal of the (i, i) subblock
    *        of the matrix-by-blocks structure.
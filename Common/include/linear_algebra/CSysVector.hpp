@@ -424,6 +424,24 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     }
   }
 
+  /*!
+   * \brief Vectorized version of AddBlock, updates multiple iPoint's.
+   * \note See SIMD overload of SetBlock.
+   */
+  template <size_t N, class T, class VecTypeSIMD, class F = ScalarType>
+  FORCEINLINE void AddBlock(simd::Array<T, N> iPoint, const VecTypeSIMD& vector, simd::Array<F, N> mask = 1) {
+    constexpr size_t nVar = VecTypeSIMD::StaticSize;
+    assert(nVar == this->nVar);
+    ScalarType vec[N][nVar];
+    UnpackBlock(vector, mask, vec);
+
+    for (size_t k = 0; k < N; ++k) {
+      if (mask[k] == 0) continue;
+      SU2_OMP_SIMD
+      for (size_t i = 0; i < nVar; ++i) vec_val[iPoint[k] * nVar + i] += vec[k][i];
+    }
+  }
+
   /*!
    * \brief Vectorized version of UpdateBlocks, updates multiple i/jPoint's.
    * \note See SIMD overload of SetBlock.
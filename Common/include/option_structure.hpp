@@ -2084,6 +2084,20 @@ enum class RECORDING {
   SOLUTION_AND_MESH,
 };
 
+/*!
+ * \brief Regions of a recording for which the tape memory is accounted (discrete adjoint).
+ */
+enum class TAPE_REGION {
+  CONVECTIVE,   /*!< \brief Convective residuals. */
+  VISCOUS,      /*!< \brief Viscous residuals. */
+  SOURCE,       /*!< \brief Source terms. */
+  BOUNDARY,     /*!< \brief Boundary conditions. */
+  GRADIENT,     /*!< \brief Gradient computations (including fused gradients and limiters). */
+  LIMITER,      /*!< \brief Slope limiters. */
+  MESH_DEFORM,  /*!< \brief Mesh deformation. */
+};
+constexpr unsigned short N_TAPE_REGIONS = 7;  /*!< \brief Number of kinds of TAPE_REGION. */
+
 /*!
  * \brief Types of schemes for dynamic structural computations
  */
@@ -2154,6 +2168,7 @@ enum MPI_QUANTITIES {
   UNDIVIDED_LAPLACIAN  ,  /*!< \brief Undivided Laplacian communication. */
   MAX_EIGENVALUE       ,  /*!< \brief Maximum eigenvalue communication. */
   SENSOR               ,  /*!< \brief Dissipation sensor communication. */
+  TIME_STEP            ,  /*!< \brief Local time step communication. */
   AUXVAR_GRADIENT      ,  /*!< \brief Auxiliary variable gradient communication. */
   COORDINATES          ,  /*!< \brief Vertex coordinates communication. */
   COORDINATES_OLD      ,  /*!< \brief Old vertex coordinates communication. */
@@ -148,6 +148,12 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { MPI_Comm_size(comm, size); }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) {
+    MPI_Comm_split(comm, color, key, newcomm);
+  }
+
+  static inline void Comm_free(Comm* comm) { MPI_Comm_free(comm); }
+
   static inline void Finalize() {
     if (winMinRankErrorInUse) MPI_Win_free(&winMinRankError);
     MPI_Finalize();
@@ -246,6 +252,11 @@ class CBaseMPIWrapper {
     MPI_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm);
   }
 
+  static inline void Reduce_scatter_block(const void* sendbuf, void* recvbuf, int recvcount, Datatype datatype, Op op,
+                                          Comm comm) {
+    MPI_Reduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm);
+  }
+
   static inline void Waitany(int nrequests, Request* request, int* index, Status* status) {
     MPI_Waitany(nrequests, request, index, status);
   }
@@ -459,6 +470,12 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     MPI_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm);
   }
 
+  static inline void Reduce_scatter_block(const void* sendbuf, void* recvbuf, int recvcount, Datatype datatype, Op op,
+                                          Comm comm) {
+    if (datatype == MPI_DOUBLE) Error("Reduce_scatter_block not possible with MPI_DOUBLE", CURRENT_FUNCTION);
+    MPI_Reduce_scatter_block(sendbuf, recvbuf, recvcount, datatype, op, comm);
+  }
+
   static inline void Waitany(int nrequests, Request* request, int* index, Status* status) {
     AMPI_Waitany(nrequests, request, index, status);
   }
@@ -528,6 +545,10 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { *size = 1; }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) { *newcomm = comm; }
+
+  static inline void Comm_free(Comm* comm) {}
+
   static inline void Finalize() {}
 
   static inline void Isend(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
@@ -588,6 +609,11 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, recvcounts[0], datatype);
   }
 
+  static inline void Reduce_scatter_block(const void* sendbuf, void* recvbuf, int recvcount, Datatype datatype, Op op,
+                                          Comm comm) {
+    CopyData(sendbuf, recvbuf, recvcount, datatype);
+  }
+
   static inline void Alltoall(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount,
                               Datatype recvtype, Comm comm) {
     CopyData(sendbuf, recvbuf, recvcount, sendtype);
@@ -143,6 +143,10 @@ FORCEINLINE ARRAY_T NAME(const ARRAY_T& x) {              \
   ARRAY_T res; FOREACH res[k] = IMPL(x[k]); return res;   \
 }
 
+MAKE_UNARY_FUN(exp, ::exp)
+MAKE_UNARY_FUN(log, ::log)
+MAKE_UNARY_FUN(tanh, ::tanh)
+
 #undef MAKE_UNARY_FUN
 
 /*--- Functions of two arguments, with arrays and scalars. ---*/
@@ -40,8 +40,10 @@ namespace simd {
 
 using namespace VecExpr;
 
-/*--- Detect preferred SIMD size (bytes). This only covers x86 architectures. ---*/
-#if defined(__AVX512F__)
+/*--- Detect preferred SIMD size (bytes). This only covers x86 architectures.
+ * With runtime dispatch the widest size is used, the multi-versioned kernels
+ * then split the 8 doubles in 2 or 4 registers on AVX2 and SSE2 hardware. ---*/
+#if defined(__AVX512F__) || defined(USE_SIMD_DISPATCH)
 constexpr size_t PREFERRED_SIZE = 64;
 #elif defined(__AVX__)
 constexpr size_t PREFERRED_SIZE = 32;
@@ -147,6 +149,17 @@ public:
 #undef FOREACH
 };
 
+/*--- Unqualified calls to max/min with two Arrays of the same type would otherwise
+ * resolve to std::max/min (see vector_expressions.hpp), these take precedence. ---*/
+template<class Scalar_t, size_t N>
+FORCEINLINE Array<Scalar_t,N> max(const Array<Scalar_t,N>& a, const Array<Scalar_t,N>& b) {
+  return VecExpr::max(a, b);
+}
+template<class Scalar_t, size_t N>
+FORCEINLINE Array<Scalar_t,N> min(const Array<Scalar_t,N>& a, const Array<Scalar_t,N>& b) {
+  return VecExpr::min(a, b);
+}
+
 /*--- Explicit vectorization specializations, see e.g.
  * https://software.intel.com/sites/landingpage/IntrinsicsGuide/
  * for documentation on the "_mm*" functions. ---*/
@@ -58,6 +58,12 @@ vector<double> GEMM_Profile_MaxTime;      /*!< \brief Maximum time spent for thi
 
 //#pragma omp threadprivate(Profile_Function_tp, Profile_Time_tp, Profile_ID_tp, Profile_Map_tp)
 
+map<pair<string, TAPE_REGION>, pair<passivedouble, unsigned long> >
+TapeRegion_Map;                                     /*!< \brief Tape memory and number of calls of the regions (owner, kind) of a recording. */
+array<passivedouble, N_TAPE_REGIONS> TapeRegion_Tot = {{}}; /*!< \brief Tape memory of each kind of region, summed over owners and ranks. */
+passivedouble Tape_Tot = 0.0;                       /*!< \brief Memory of the last recording, summed over ranks. */
+passivedouble Tape_Peak = 0.0;                      /*!< \brief Memory of the last recording on the rank with the largest tape. */
+
 
 CConfig::CConfig(char case_filename[MAX_STRING_SIZE], SU2_COMPONENT val_software, bool verb_high) {
 
@@ -1158,6 +1164,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
   addBoolOption("VT_RESIDUAL_LIMITING", vt_transfer_res_limit, false);
+  /* DESCRIPTION: Integrate the chemistry and VT relaxation sources point-implicitly, separately from the flow */
+  addBoolOption("CHEMISTRY_SPLITTING", chemistry_splitting, false);
+  /* DESCRIPTION: Number of point-implicit sub-steps per flow update used with CHEMISTRY_SPLITTING */
+  addUnsignedShortOption("CHEMISTRY_SUBSTEPS", nChemistry_SubSteps, 1);
   /* DESCRIPTION: List of catalytic walls */
   addStringListOption("CATALYTIC_WALL", nWall_Catalytic, Wall_Catalytic);
   /*!\brief MARKER_MONITORING\n DESCRIPTION: Marker(s) of the surface where evaluate the non-dimensional coefficients \ingroup Config*/
@@ -1176,6 +1186,16 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the tabulation of the fluid model ---*/
+  /* DESCRIPTION: Interpolate the thermodynamic properties of the fluid model from a look-up table */
+  addBoolOption("FLUID_TABLE", FluidTable, false);
+  /* DESCRIPTION: Number of table nodes in the density and energy directions */
+  addUShortArrayOption("FLUID_TABLE_SIZE", FluidTable_Size.size(), FluidTable_Size.data());
+  /* DESCRIPTION: Min/max density and min/max static energy of the table, relative to the free-stream values */
+  addDoubleArrayOption("FLUID_TABLE_LIMITS", FluidTable_Limits.size(), FluidTable_Limits.data());
+  /* DESCRIPTION: File where the table is stored, it is reused if the size and limits match */
+  addStringOption("FLUID_TABLE_FILENAME", FluidTable_FileName, string("fluid_table.bin"));
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, VISCOSITYMODEL::SUTHERLAND);
@@ -1608,6 +1628,17 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Eisenstat-Walker forcing parameters {max forcing term (0 disables), gamma, alpha}. */
+  addDoubleArrayOption("NEWTON_KRYLOV_FORCING_PARAM", NK_ForcingParam.size(), NK_ForcingParam.data());
+  /* DESCRIPTION: Maximum number of backtracking steps of the line search for NK iterations (0 disables). */
+  addUnsignedShortOption("NEWTON_KRYLOV_LINE_SEARCH_ITER", NK_LineSearchIter, 0);
+  /* DESCRIPTION: Switch to NK when quasi-Newton iterations contract the residual by less than this (0 disables). */
+  addDoubleOption("NEWTON_KRYLOV_SWITCH_CONTRACTION", NK_SwitchContraction, 0.0);
+
+  /* DESCRIPTION: Freeze the points whose residuals have converged (steady implicit flow solvers). */
+  addBoolOption("ACTIVE_SET", ActiveSet, false);
+  /* DESCRIPTION: Active set parameters {residual ratio to the RMS, buffer layers, full evaluation frequency}. */
+  addDoubleArrayOption("ACTIVE_SET_PARAM", ActiveSetParam.size(), ActiveSetParam.data());
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1649,14 +1680,30 @@ void CConfig::SetConfig_Options() {
   addUnsignedShortOption("TIME_DOFS_ADER_DG", nTimeDOFsADER_DG, 2);
   /* DESCRIPTION: Unsteady Courant-Friedrichs-Lewy number of the finest grid */
   addDoubleOption("UNST_CFL_NUMBER", Unst_CFL, 0.0);
+  /* DESCRIPTION: Number of groups of ranks that integrate slices of the time window in parallel (Parareal). */
+  addUnsignedShortOption("TIME_PARALLEL_GROUPS", nTimeParallelGroups, 1);
+  /* DESCRIPTION: Ratio between the time steps of the coarse and fine Parareal propagators. */
+  addUnsignedShortOption("PARAREAL_COARSE_FACTOR", PararealCoarseFactor, 4);
+  /* DESCRIPTION: Maximum number of Parareal iterations. */
+  addUnsignedShortOption("PARAREAL_ITER", nPararealIter, 4);
+  /* DESCRIPTION: Tolerance on the relative change of the initial states of the time slices. */
+  addDoubleOption("PARAREAL_TOL", PararealTol, 1e-6);
+  /* DESCRIPTION: Order of the extrapolation of the initial guess of dual time steps from the previous time levels (0, 1, 2). */
+  addUnsignedShortOption("TIME_EXTRAPOLATION_ORDER", TimeExtrapolationOrder, 0);
+  /* DESCRIPTION: Stop the inner iterations when the residual is below this fraction of the temporal truncation error. */
+  addDoubleOption("INNER_TRUNC_ERROR_RATIO", InnerTruncErrorRatio, 0.0);
   /* DESCRIPTION: Integer number of periodic time instances for Harmonic Balance */
   addUnsignedShortOption("TIME_INSTANCES", nTimeInstances, 1);
+  /* DESCRIPTION: Number of groups of ranks that share the time instances of Harmonic Balance */
+  addUnsignedShortOption("HB_PARALLEL_GROUPS", nHBParallelGroups, 1);
   /* DESCRIPTION: Time period for Harmonic Balance wihtout moving meshes */
   addDoubleOption("HB_PERIOD", HarmonicBalance_Period, -1.0);
   /* DESCRIPTION:  Turn on/off harmonic balance preconditioning */
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Number of primal states the unsteady adjoint keeps in memory, the others are recomputed (0 reads restart files) */
+  addUnsignedLongOption("UNST_ADJOINT_CHECKPOINTS", Unst_AdjointCheckpoints, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Time discretization */
@@ -1777,6 +1824,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_TURBULENCE\n DESCRIPTION: Include the turbulence equations in the multigrid cycle of the flow. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_TURBULENCE", MG_Turbulence, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1796,6 +1845,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief LIMITER_ITER
    *  \n DESCRIPTION: Freeze the value of the limiter after a number of iterations. DEFAULT value 999999. \ingroup Config*/
   addUnsignedLongOption("LIMITER_ITER", LimiterIter, 999999);
+  /*!\brief FUSED_GRADIENT_LIMITER
+   *  \n DESCRIPTION: Compute the reconstruction gradient and the limiter in one pass over the points. DEFAULT NO. \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", FusedGradientLimiter, false);
 
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -1926,6 +1978,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("FROZEN_VISC_DISC", Frozen_Visc_Disc, false);
   /* DESCRIPTION: Discrete Adjoint frozen limiter */
   addBoolOption("FROZEN_LIMITER_DISC", Frozen_Limiter_Disc, false);
+  /* DESCRIPTION: Discrete Adjoint with the flux Jacobians of the implicit system for the convective edge fluxes */
+  addBoolOption("FROZEN_CONV_JACOBIAN_DISC", Frozen_ConvJac_Disc, false);
   /* DESCRIPTION: Use an inconsistent (primal/dual) discrete adjoint formulation */
   addBoolOption("INCONSISTENT_DISC", Inconsistent_Disc, false);
    /* DESCRIPTION:  */
@@ -2008,6 +2062,11 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
+  /* DESCRIPTION: Record the tapes of the discrete adjoint to report their memory and stop before solving the adjoint  \ingroup Config*/
+  addBoolOption("TAPE_DRY_RUN", Tape_DryRun, false);
+  /* DESCRIPTION: Fraction of the points of each rank registered as inputs in the tape dry run, the memory of the
+   * full tapes is extrapolated from it (1 records the full tapes)  \ingroup Config*/
+  addDoubleOption("TAPE_DRY_RUN_FRACTION", Tape_DryRun_Fraction, 0.1);
   /*!\brief MARKER_ANALYZE_AVERAGE
    *  \n DESCRIPTION: Output averaged flow values on specified analyze marker.
    *  Options: AREA, MASSFLUX
@@ -2779,6 +2838,9 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
+
+  /* DESCRIPTION: Do not allocate the per-point fields that are unused by the case (limiter min/max, truncation error). */
+  addBoolOption("SKIP_UNUSED_FIELDS", SkipUnusedFields, false);
   
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
@@ -3614,6 +3676,26 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     SU2_MPI::Error("Only STANDARD_AIR fluid model can be used with US Measurement System", CURRENT_FUNCTION);
   }
 
+  if (FluidTable) {
+    if (Kind_FluidModel != STANDARD_AIR && Kind_FluidModel != IDEAL_GAS &&
+        Kind_FluidModel != VW_GAS && Kind_FluidModel != PR_GAS) {
+      SU2_MPI::Error("FLUID_TABLE can only be used with the fluid models of the compressible solvers.", CURRENT_FUNCTION);
+    }
+    if (FluidTable_Size[0] < 2 || FluidTable_Size[1] < 2 ||
+        FluidTable_Limits[0] <= 0.0 || FluidTable_Limits[1] <= FluidTable_Limits[0] ||
+        FluidTable_Limits[2] <= 0.0 || FluidTable_Limits[3] <= FluidTable_Limits[2]) {
+      SU2_MPI::Error("Invalid FLUID_TABLE_SIZE or FLUID_TABLE_LIMITS.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (chemistry_splitting && (!nemo || nChemistry_SubSteps == 0)) {
+    SU2_MPI::Error("CHEMISTRY_SPLITTING requires a NEMO solver and CHEMISTRY_SUBSTEPS > 0.", CURRENT_FUNCTION);
+  }
+  if (chemistry_splitting &&
+      (TimeMarching == TIME_MARCHING::DT_STEPPING_1ST || TimeMarching == TIME_MARCHING::DT_STEPPING_2ND)) {
+    SU2_MPI::Error("CHEMISTRY_SPLITTING cannot be used with dual time stepping, use TIME_STEPPING.", CURRENT_FUNCTION);
+  }
+
   if (Kind_FluidModel == SU2_NONEQ && Kind_TransCoeffModel != TRANSCOEFFMODEL::WILKE ) {
     SU2_MPI::Error("Only WILKE transport model is stable for the NEMO solver using SU2TClib. Use Mutation++ instead.", CURRENT_FUNCTION);
   }
@@ -4203,6 +4285,42 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
 
   if (Restart) MGCycle = V_CYCLE;
 
+  /*--- The turbulence equations of the primal RANS solvers can be included in the multigrid cycle. The
+   coarse levels do not store the data needed by wall functions, rough walls, DES, or the LM model. ---*/
+
+  if (MG_Turbulence) {
+    if ((Kind_Solver != RANS && Kind_Solver != INC_RANS) || ContinuousAdjoint || DiscreteAdjoint) {
+      SU2_MPI::Error("MG_TURBULENCE is only available for the primal RANS solvers.", CURRENT_FUNCTION);
+    }
+    if (Wall_Functions || (nRough_Wall > 0) || (Kind_HybridRANSLES != NO_HYBRIDRANSLES) || (Kind_Trans_Model == LM)) {
+      SU2_MPI::Error("MG_TURBULENCE is not compatible with wall functions, rough walls, hybrid RANS/LES, or the LM model.",
+                     CURRENT_FUNCTION);
+    }
+    if (nLevels_TimeAccurateLTS > 1) {
+      SU2_MPI::Error("MG_TURBULENCE is not compatible with time accurate local time stepping.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- The active set mode relies on the implicit update of the compressible FVM solvers,
+   and on the residuals of all the points being available at the full evaluations. ---*/
+
+  if (ActiveSet) {
+    if ((Kind_Solver != EULER && Kind_Solver != NAVIER_STOKES && Kind_Solver != RANS) ||
+        ContinuousAdjoint || DiscreteAdjoint) {
+      SU2_MPI::Error("ACTIVE_SET is only available for the primal compressible flow solvers.", CURRENT_FUNCTION);
+    }
+    if ((TimeMarching != TIME_MARCHING::STEADY) || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)) {
+      SU2_MPI::Error("ACTIVE_SET requires a steady problem with EULER_IMPLICIT time integration.", CURRENT_FUNCTION);
+    }
+    if ((nMGLevels != 0) || NewtonKrylov) {
+      SU2_MPI::Error("ACTIVE_SET is not compatible with multigrid or NEWTON_KRYLOV.", CURRENT_FUNCTION);
+    }
+    if ((ActiveSetParam[0] <= 0.0) || (ActiveSetParam[1] < 0.0) || (ActiveSetParam[2] < 1.0)) {
+      SU2_MPI::Error("ACTIVE_SET_PARAM expects {ratio > 0, buffer layers >= 0, full evaluation frequency >= 1}.",
+                     CURRENT_FUNCTION);
+    }
+  }
+
   if (ContinuousAdjoint) {
     if (Kind_Solver == EULER) Kind_Solver = ADJ_EULER;
     if (Kind_Solver == NAVIER_STOKES) Kind_Solver = ADJ_NAVIER_STOKES;
@@ -4241,6 +4359,28 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     Iter_Fixed_NetThrust = SU2_TYPE::Int(su2double (Iter_Fixed_NetThrust) / CFLRedCoeff_AdjFlow);
   }
 
+  /*--- The vectorized AUSM/SLAU/HLLC schemes only implement the approximate (Roe) Jacobians. ---*/
+
+  if (UseVectorization && !GetNEMOProblem() && Kind_Regime == ENUM_REGIME::COMPRESSIBLE &&
+      Kind_ConvNumScheme_Flow == SPACE_UPWIND) {
+    const bool ausmSlau = (Kind_Upwind_Flow == AUSMPLUSUP) || (Kind_Upwind_Flow == AUSMPLUSUP2) ||
+                          (Kind_Upwind_Flow == SLAU) || (Kind_Upwind_Flow == SLAU2);
+    if (ausmSlau && Use_Accurate_Jacobians) {
+      SU2_MPI::Error("USE_ACCURATE_FLUX_JACOBIANS is not available with USE_VECTORIZATION for the\n"
+                     "AUSM+up(2) and SLAU(2) schemes.", CURRENT_FUNCTION);
+    }
+    if (Kind_Upwind_Flow == HLLC && rank == MASTER_NODE) {
+      cout << "\nWARNING: The vectorized HLLC scheme uses approximate (Roe) Jacobians instead of the exact\n"
+              "Jacobians of the non-vectorized version, the convergence rate of implicit runs may differ.\n" << endl;
+    }
+  }
+
+  if (DiscreteAdjoint && Frozen_ConvJac_Disc &&
+      (Kind_TimeIntScheme_Flow != EULER_IMPLICIT || GetDynamic_Grid() || !UseVectorization)) {
+    SU2_MPI::Error("FROZEN_CONV_JACOBIAN_DISC requires USE_VECTORIZATION, EULER_IMPLICIT time integration,\n"
+                   "and a static grid.", CURRENT_FUNCTION);
+  }
+
   if ((DiscreteAdjoint) && (Inconsistent_Disc)) {
     Kind_ConvNumScheme_Flow = Kind_ConvNumScheme_AdjFlow;
     Kind_Centered_Flow = Kind_Centered_AdjFlow;
@@ -4279,20 +4419,115 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (nLevels_TimeAccurateLTS == 0)  nLevels_TimeAccurateLTS =  1;
   if (nLevels_TimeAccurateLTS  > 15) nLevels_TimeAccurateLTS = 15;
 
+  /* Time accurate local time stepping is also possible for the compressible
+     finite volume solvers, with explicit Euler time stepping (multirate). RANS is
+     excluded since the turbulence solver is not sub-cycled (it would be advanced
+     with the local time steps of the flow points). */
+  const bool fvmLTS = (Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES) &&
+                      (TimeMarching == TIME_MARCHING::TIME_STEPPING) &&
+                      (Kind_TimeIntScheme_Flow == EULER_EXPLICIT);
+
   /* Check that no time accurate local time stepping is specified for time
      integration schemes other than ADER. */
-  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && nLevels_TimeAccurateLTS != 1) {
+  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && !fvmLTS && nLevels_TimeAccurateLTS != 1) {
 
     if (rank==MASTER_NODE) {
       cout << endl << "WARNING: "
            << nLevels_TimeAccurateLTS << " levels specified for time accurate local time stepping." << endl
-           << "Time accurate local time stepping is only possible for ADER, hence this option is not used." << endl
+           << "Time accurate local time stepping is only possible for ADER, or for TIME_STEPPING with" << endl
+           << "EULER_EXPLICIT of the compressible FVM solvers (EULER, NAVIER_STOKES)," << endl
+           << "hence this option is not used." << endl
            << endl;
     }
 
     nLevels_TimeAccurateLTS = 1;
   }
 
+  if (fvmLTS && nLevels_TimeAccurateLTS != 1 && Unst_CFL == 0.0) {
+    SU2_MPI::Error("Unsteady CFL not specified for time accurate local time stepping.", CURRENT_FUNCTION);
+  }
+
+  /* Parallel-in-time integration, the ranks are split in contiguous groups, each
+     integrates one slice of the time window with the fine and coarse propagators. */
+  if (nTimeParallelGroups == 0) nTimeParallelGroups = 1;
+
+  if (nTimeParallelGroups > 1) {
+    if (TimeMarching != TIME_MARCHING::DT_STEPPING_1ST && TimeMarching != TIME_MARCHING::DT_STEPPING_2ND) {
+      SU2_MPI::Error("TIME_PARALLEL_GROUPS requires dual time stepping.", CURRENT_FUNCTION);
+    }
+    if (DiscreteAdjoint || Multizone_Problem || GetDynamic_Grid()) {
+      SU2_MPI::Error("TIME_PARALLEL_GROUPS is only possible for single zone primal problems on static grids.",
+                     CURRENT_FUNCTION);
+    }
+    if (Unst_CFL != 0.0) {
+      SU2_MPI::Error("TIME_PARALLEL_GROUPS requires a fixed time step (UNST_CFL_NUMBER= 0).", CURRENT_FUNCTION);
+    }
+    if (PararealCoarseFactor == 0) PararealCoarseFactor = 1;
+
+    const auto nTimeSteps = nTimeIter - (Restart ? Restart_Iter : 0);
+    if (nTimeSteps % (nTimeParallelGroups * PararealCoarseFactor) != 0) {
+      SU2_MPI::Error("The number of time steps must be a multiple of TIME_PARALLEL_GROUPS x PARAREAL_COARSE_FACTOR.",
+                     CURRENT_FUNCTION);
+    }
+
+    int worldRank = 0, worldSize = 1;
+#ifdef HAVE_MPI
+    SU2_MPI::Comm_rank(MPI_COMM_WORLD, &worldRank);
+    SU2_MPI::Comm_size(MPI_COMM_WORLD, &worldSize);
+#endif
+    if (worldSize % nTimeParallelGroups != 0) {
+      SU2_MPI::Error("The number of MPI ranks must be a multiple of TIME_PARALLEL_GROUPS.", CURRENT_FUNCTION);
+    }
+    iTimeParallelGroup = worldRank / (worldSize / nTimeParallelGroups);
+  }
+
+  /* Harmonic balance with the time instances distributed over groups of ranks, each group
+     stores a contiguous range of instances, the source terms are summed over the groups. */
+  if (nHBParallelGroups == 0) nHBParallelGroups = 1;
+
+  if (nHBParallelGroups > 1) {
+    if (TimeMarching != TIME_MARCHING::HARMONIC_BALANCE) {
+      SU2_MPI::Error("HB_PARALLEL_GROUPS requires TIME_MARCHING= HARMONIC_BALANCE.", CURRENT_FUNCTION);
+    }
+    if (nTimeInstances % nHBParallelGroups != 0) {
+      SU2_MPI::Error("The number of TIME_INSTANCES must be a multiple of HB_PARALLEL_GROUPS.", CURRENT_FUNCTION);
+    }
+
+    int worldRank = 0, worldSize = 1;
+#ifdef HAVE_MPI
+    SU2_MPI::Comm_rank(MPI_COMM_WORLD, &worldRank);
+    SU2_MPI::Comm_size(MPI_COMM_WORLD, &worldSize);
+#endif
+    if (worldSize % nHBParallelGroups != 0) {
+      SU2_MPI::Error("The number of MPI ranks must be a multiple of HB_PARALLEL_GROUPS.", CURRENT_FUNCTION);
+    }
+    iHBParallelGroup = worldRank / (worldSize / nHBParallelGroups);
+  }
+
+  /* The initial guess of dual time steps can be extrapolated from the previous time levels, and
+     the extrapolation is also the predictor that estimates the truncation error of the step. */
+  if (TimeExtrapolationOrder > 0 || InnerTruncErrorRatio > 0.0) {
+    const bool dualTime = (TimeMarching == TIME_MARCHING::DT_STEPPING_1ST) ||
+                          (TimeMarching == TIME_MARCHING::DT_STEPPING_2ND);
+    if (!dualTime || DiscreteAdjoint || ContinuousAdjoint) {
+      SU2_MPI::Error("TIME_EXTRAPOLATION_ORDER and INNER_TRUNC_ERROR_RATIO require primal dual time stepping.",
+                     CURRENT_FUNCTION);
+    }
+    if (TimeExtrapolationOrder > 2) {
+      SU2_MPI::Error("TIME_EXTRAPOLATION_ORDER must be 0, 1, or 2.", CURRENT_FUNCTION);
+    }
+    if ((Unst_CFL != 0.0) || (nTimeParallelGroups > 1)) {
+      SU2_MPI::Error("TIME_EXTRAPOLATION_ORDER and INNER_TRUNC_ERROR_RATIO require a fixed time step,\n"
+                     "(UNST_CFL_NUMBER= 0) and are not compatible with TIME_PARALLEL_GROUPS.", CURRENT_FUNCTION);
+    }
+    const unsigned short timeOrder = (TimeMarching == TIME_MARCHING::DT_STEPPING_1ST)? 1 : 2;
+    if ((InnerTruncErrorRatio > 0.0) && (TimeExtrapolationOrder != timeOrder)) {
+      SU2_MPI::Error("INNER_TRUNC_ERROR_RATIO requires TIME_EXTRAPOLATION_ORDER to match the order of\n"
+                     "the time discretization (1 for DUAL_TIME_STEPPING-1ST_ORDER, 2 for 2ND_ORDER).",
+                     CURRENT_FUNCTION);
+    }
+  }
+
   if (Kind_TimeIntScheme_FEM_Flow == ADER_DG) {
 
     TimeMarching = TIME_MARCHING::TIME_STEPPING;  // Only time stepping for ADER.
@@ -4922,6 +5157,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     }
 #endif
 
+    if (Tape_DryRun && Multizone_Problem) {
+      SU2_MPI::Error("TAPE_DRY_RUN is only available for single zone problems.", CURRENT_FUNCTION);
+    }
+
+    if (Tape_DryRun && (Tape_DryRun_Fraction <= 0.0 || Tape_DryRun_Fraction > 1.0)) {
+      SU2_MPI::Error("TAPE_DRY_RUN_FRACTION must be in (0,1].", CURRENT_FUNCTION);
+    }
+
     /*--- Use the same linear solver on the primal as the one used in the adjoint. ---*/
     Kind_Linear_Solver = Kind_DiscAdj_Linear_Solver;
     Kind_Linear_Solver_Prec = Kind_DiscAdj_Linear_Prec;
@@ -4936,6 +5179,16 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                        CURRENT_FUNCTION);
       }
 
+      if (Unst_AdjointCheckpoints > 0) {
+        const bool fluid = (Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES || Kind_Solver == RANS ||
+                            Kind_Solver == INC_EULER || Kind_Solver == INC_NAVIER_STOKES || Kind_Solver == INC_RANS);
+        if (!fluid || Multizone_Problem || GetDynamic_Grid() || Deform_Mesh ||
+            (TimeMarching != TIME_MARCHING::DT_STEPPING_1ST && TimeMarching != TIME_MARCHING::DT_STEPPING_2ND)) {
+          SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS is only possible for single zone fluid problems on static grids\n"
+                         "with dual time stepping.", CURRENT_FUNCTION);
+        }
+      }
+
       /*--- If the averaging interval is not set, we average over all time-steps ---*/
 
       if (Iter_Avg_Objective == 0.0) {
@@ -9364,7 +9617,7 @@ short CConfig::FindInterfaceMarker(unsigned short iInterface) const {
   return -1;
 }
 
-void CConfig::Tick(double *val_start_time) {
+void CConfig::Tick(double *val_start_time) const {
 
 #ifdef PROFILE
   *val_start_time = SU2_MPI::Wtime();
@@ -9372,7 +9625,7 @@ void CConfig::Tick(double *val_start_time) {
 
 }
 
-void CConfig::Tock(double val_start_time, string val_function_name, int val_group_id) {
+void CConfig::Tock(double val_start_time, string val_function_name, int val_group_id) const {
 
 #ifdef PROFILE
 
@@ -9776,6 +10029,101 @@ void CConfig::GEMMProfilingCSV(void) {
 
 }
 
+namespace {
+/*!
+ * \brief Memory used by the tape (MB), 0 if it is not recording.
+ */
+passivedouble TapeMemory() {
+#ifdef CODI_REVERSE_TYPE
+  if (AD::TapeActive()) return AD::getGlobalTape().getTapeValues().getUsedMemorySize();
+#endif
+  return 0.0;
+}
+}
+
+void CConfig::TapeTick(passivedouble *val_start_memory) const {
+
+  if (omp_get_thread_num() == 0) *val_start_memory = TapeMemory();
+
+}
+
+void CConfig::TapeTock(passivedouble val_start_memory, const char* val_owner, TAPE_REGION val_region) const {
+
+  if (!AD::TapeActive() || omp_get_thread_num() != 0) return;
+
+  auto& region = TapeRegion_Map[make_pair(string(val_owner), val_region)];
+  region.first += TapeMemory() - val_start_memory;
+  region.second += 1;
+
+}
+
+void CConfig::ClearTapeRegions(void) const {
+
+  TapeRegion_Map.clear();
+
+}
+
+void CConfig::SetTapeRegions_Summary(unsigned long val_nPoint_Global, bool val_print) const {
+
+  using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+
+  /*--- Each rank has the same stack trace, hence the same regions in the same order (as for the
+   *    profiling), the first entries are the whole tape and the kinds of regions. ---*/
+
+  vector<passivedouble> localMem(1 + N_TAPE_REGIONS, 0.0);
+  localMem[0] = TapeMemory();
+  for (const auto& region : TapeRegion_Map) {
+    localMem[1 + static_cast<unsigned short>(region.first.second)] += region.second.first;
+    localMem.push_back(region.second.first);
+  }
+
+  vector<passivedouble> totMem(localMem.size()), maxMem(localMem.size());
+  MPI_Wrapper::Allreduce(localMem.data(), totMem.data(), localMem.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  MPI_Wrapper::Allreduce(localMem.data(), maxMem.data(), localMem.size(), MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  Tape_Tot = totMem[0];
+  Tape_Peak = maxMem[0];
+  for (auto iRegion = 0u; iRegion < N_TAPE_REGIONS; ++iRegion) TapeRegion_Tot[iRegion] = totMem[1 + iRegion];
+
+  if (!val_print || rank != MASTER_NODE) return;
+
+  static const array<const char*, N_TAPE_REGIONS> RegionNames = {{
+    "Convective", "Viscous", "Source", "Boundary", "Gradient", "Limiter", "Mesh deformation"}};
+
+  const passivedouble toKB = 1024.0 / max<unsigned long>(val_nPoint_Global, 1);
+
+  cout << "\nTape memory per region (only the master thread is accounted in hybrid parallel builds):\n";
+
+  PrintingToolbox::CTablePrinter RegionTable(&std::cout);
+  RegionTable.AddColumn("Owner", 12);
+  RegionTable.AddColumn("Region", 16);
+  RegionTable.AddColumn("Calls", 8);
+  RegionTable.AddColumn("Total [MB]", 12);
+  RegionTable.AddColumn("Max rank [MB]", 13);
+  RegionTable.AddColumn("KB/point", 10);
+  RegionTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  RegionTable.PrintHeader();
+
+  auto iEntry = 1 + N_TAPE_REGIONS;
+  for (const auto& region : TapeRegion_Map) {
+    RegionTable << region.first.first << RegionNames[static_cast<unsigned short>(region.first.second)]
+                << region.second.second << totMem[iEntry] << maxMem[iEntry] << totMem[iEntry] * toKB;
+    ++iEntry;
+  }
+  RegionTable.PrintFooter();
+  RegionTable << "All" << "Whole tape" << "-" << Tape_Tot << Tape_Peak << Tape_Tot * toKB;
+  RegionTable.PrintFooter();
+
+}
+
+passivedouble CConfig::GetTapeRegion_Memory(TAPE_REGION val_region) const {
+  return TapeRegion_Tot[static_cast<unsigned short>(val_region)];
+}
+
+passivedouble CConfig::GetTape_Memory(void) const { return Tape_Tot; }
+
+passivedouble CConfig::GetTape_PeakMemory(void) const { return Tape_Peak; }
+
 void CConfig::SetFreeStreamTurboNormal(const su2double* turboNormal){
 
   FreeStreamTurboNormal[0] = turboNormal[0];
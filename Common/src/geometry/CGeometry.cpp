@@ -3818,7 +3818,7 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
   bool allEmpty = true;
   vector<bool> wallDistanceNeeded(nZone, false);
 
-  for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++){
+  for (int iInst = 0; iInst < config_container[ZONE_0]->GetnLocal_TimeInstances(); iInst++){
     for (int iZone = 0; iZone < nZone; iZone++){
 
       /*--- Check if a zone needs the wall distance and store a boolean ---*/
@@ -3885,5 +3885,26 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
         }
       }
     }
+
+    /*--- If the turbulence equations are solved on the agglomerated levels, their
+     * wall distance is the volume average of the distance of their children. ---*/
+    for (int iZone = 0; iZone < nZone; iZone++) {
+      if (!wallDistanceNeeded[iZone] || !config_container[iZone]->GetMG_Turbulence()) continue;
+
+      for (unsigned short iMesh = 1; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+        const CGeometry *fine = geometry_container[iZone][iInst][iMesh-1];
+        CGeometry *coarse = geometry_container[iZone][iInst][iMesh];
+
+        for (unsigned long iPoint = 0; iPoint < coarse->GetnPoint(); iPoint++) {
+          su2double distance = 0.0, volume = 0.0;
+          for (unsigned short iChildren = 0; iChildren < coarse->nodes->GetnChildren_CV(iPoint); iChildren++) {
+            const auto Point_Fine = coarse->nodes->GetChildren_CV(iPoint, iChildren);
+            distance += fine->nodes->GetWall_Distance(Point_Fine) * fine->nodes->GetVolume(Point_Fine);
+            volume += fine->nodes->GetVolume(Point_Fine);
+          }
+          if (volume > 0.0) coarse->nodes->SetWall_Distance(iPoint, distance / volume);
+        }
+      }
+    }
   }
 }
@@ -51,6 +51,7 @@
 #include <iterator>
 #include <unordered_set>
 #include <queue>
+#include <array>
 #ifdef _MSC_VER
 #include <direct.h>
 #endif
@@ -187,6 +188,8 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
 
   edgeColorGroupSize = config->GetEdgeColoringGroupSize();
 
+  double tick = 0.0;
+
   /*--- The new geometry class has the same problem dimension/zone. ---*/
 
   nDim  = geometry->GetnDim();
@@ -202,26 +205,73 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
     cout <<"Distributing ParMETIS coloring." << endl;
 
+  config->Tick(&tick);
   DistributeColoring(config, geometry);
+  config->Tock(tick, "CPhysicalGeometry::DistributeColoring", 1);
 
   /*--- Redistribute the points to all ranks based on the coloring. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
     cout <<"Rebalancing vertices." << endl;
 
+  config->Tick(&tick);
   DistributePoints(config, geometry);
+  config->Tock(tick, "CPhysicalGeometry::DistributePoints", 1);
+
+  /*--- Each distribution step below needs an all-to-all exchange of message
+   sizes, which becomes expensive with many ranks. Therefore, we count the
+   element types present in the entire mesh (one reduction for all types)
+   and skip the types that do not exist, e.g. hexahedra in a tetra mesh. ---*/
+
+  const unsigned short volumeTypes[] = {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID};
+  const unsigned short surfaceTypes[] = {LINE, TRIANGLE, QUADRILATERAL};
+  constexpr unsigned short nVolumeTypes = 6, nSurfaceTypes = 3;
+
+  unsigned long nElemType_Local[nVolumeTypes+nSurfaceTypes] = {0};
+  unsigned long nElemType_Global[nVolumeTypes+nSurfaceTypes] = {0};
+
+  for (auto iElem = 0ul; iElem < geometry->GetnElem(); iElem++) {
+    const auto type = geometry->elem[iElem]->GetVTK_Type();
+    for (auto iType = 0u; iType < nVolumeTypes; iType++)
+      nElemType_Local[iType] += (type == volumeTypes[iType]);
+  }
+  /*--- The master rank currently holds all markers (see below). ---*/
+  if (rank == MASTER_NODE) {
+    for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); iMarker++) {
+      for (auto iElem = 0ul; iElem < geometry->GetnElem_Bound(iMarker); iElem++) {
+        const auto type = geometry->bound[iMarker][iElem]->GetVTK_Type();
+        for (auto iType = 0u; iType < nSurfaceTypes; iType++)
+          nElemType_Local[nVolumeTypes+iType] += (type == surfaceTypes[iType]);
+      }
+    }
+  }
+
+  SU2_MPI::Allreduce(nElemType_Local, nElemType_Global, nVolumeTypes+nSurfaceTypes,
+                     MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
   /*--- Distribute the element information to all ranks based on coloring. ---*/
 
   if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
     cout <<"Rebalancing volume element connectivity." << endl;
 
-  DistributeVolumeConnectivity(config, geometry, TRIANGLE     );
-  DistributeVolumeConnectivity(config, geometry, QUADRILATERAL);
-  DistributeVolumeConnectivity(config, geometry, TETRAHEDRON  );
-  DistributeVolumeConnectivity(config, geometry, HEXAHEDRON   );
-  DistributeVolumeConnectivity(config, geometry, PRISM        );
-  DistributeVolumeConnectivity(config, geometry, PYRAMID      );
+  config->Tick(&tick);
+
+  /*--- Prepare a mapping for local to global element index, common to all types. ---*/
+
+  vector<unsigned long> Local2GlobalElem(geometry->Global_to_Local_Elem.size());
+
+  for (const auto& p : geometry->Global_to_Local_Elem) {
+    Local2GlobalElem[p.second] = p.first;
+  }
+
+  for (auto iType = 0u; iType < nVolumeTypes; iType++) {
+    if (nElemType_Global[iType] > 0)
+      DistributeVolumeConnectivity(config, geometry, volumeTypes[iType], Local2GlobalElem);
+  }
+
+  decltype(Local2GlobalElem)().swap(Local2GlobalElem);
+
+  config->Tock(tick, "CPhysicalGeometry::DistributeVolumeConnectivity", 1);
 
   /*--- Distribute the marker information to all ranks based on coloring. ---*/
 
@@ -233,18 +283,24 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
    rank. In the future, this process can be moved directly into the grid
    reader to avoid reading the markers to the master rank alone at first. ---*/
 
+  config->Tick(&tick);
+
   DistributeMarkerTags(config, geometry);
-  PartitionSurfaceConnectivity(config, geometry, LINE         );
-  PartitionSurfaceConnectivity(config, geometry, TRIANGLE     );
-  PartitionSurfaceConnectivity(config, geometry, QUADRILATERAL);
+  for (auto iType = 0u; iType < nSurfaceTypes; iType++) {
+    if (nElemType_Global[nVolumeTypes+iType] > 0)
+      PartitionSurfaceConnectivity(config, geometry, surfaceTypes[iType]);
+  }
 
   /*--- Once the markers are distributed according to the linear partitioning
    of the grid points, we can use similar techniques as above for distributing
    the surface element connectivity. ---*/
 
-  DistributeSurfaceConnectivity(config, geometry, LINE         );
-  DistributeSurfaceConnectivity(config, geometry, TRIANGLE     );
-  DistributeSurfaceConnectivity(config, geometry, QUADRILATERAL);
+  for (auto iType = 0u; iType < nSurfaceTypes; iType++) {
+    if (nElemType_Global[nVolumeTypes+iType] > 0)
+      DistributeSurfaceConnectivity(config, geometry, surfaceTypes[iType]);
+  }
+
+  config->Tock(tick, "CPhysicalGeometry::DistributeSurfaceConnectivity", 1);
 
   /*--- Reduce the total number of elements that we have on each rank. ---*/
 
@@ -265,9 +321,11 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
    on the ParMETIS coloring complete, as a final step, load this data into
    our geometry class data structures. ---*/
 
+  config->Tick(&tick);
   LoadPoints(config, geometry);
   LoadVolumeElements(config, geometry);
   LoadSurfaceElements(config, geometry);
+  config->Tock(tick, "CPhysicalGeometry::LoadPointsAndElements", 1);
 
   /*--- Free memory associated with the partitioning of points and elems. ---*/
 
@@ -750,7 +808,8 @@ void CPhysicalGeometry::DistributeColoring(const CConfig *config,
 
 void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
                                                      CGeometry *geometry,
-                                                     unsigned short Elem_Type) {
+                                                     unsigned short Elem_Type,
+                                                     const vector<unsigned long>& Local2GlobalElem) {
 
   unsigned short NODES_PER_ELEMENT = 0;
 
@@ -790,14 +849,6 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
       break;
   }
 
-  /*--- Prepare a mapping for local to global element index. ---*/
-
-  vector<unsigned long> Local2GlobalElem(geometry->Global_to_Local_Elem.size());
-
-  for (auto p : geometry->Global_to_Local_Elem) {
-    Local2GlobalElem[p.second] = p.first;
-  }
-
   /*--- We start with the connectivity distributed across all procs in a
    linear partitioning. We need to loop through our local partition
    and decide how many elements we must send to each other rank in order to
@@ -3266,6 +3317,7 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
   }
 
   /*--- Set the value of some of the points ---*/
+  Global_to_Local_Point.reserve(nPoint);
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     Global_to_Local_Point[Local_to_Global_Point[iPoint]] = iPoint;
 
@@ -3278,8 +3330,7 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
       for (iVertex = 0; iVertex < nVertexDomain[nMarker]; iVertex++) {
 
         MI = Global_to_Local_Point.find(SendDomainLocal[iDomain][iVertex]);
-        if (MI != Global_to_Local_Point.end())
-          iPoint = Global_to_Local_Point[SendDomainLocal[iDomain][iVertex]];
+        if (MI != Global_to_Local_Point.end()) iPoint = MI->second;
         else iPoint = std::numeric_limits<unsigned long>::max();
 
         SendDomainLocal[iDomain][iVertex] = iPoint;
@@ -3298,8 +3349,7 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
       for (iVertex = 0; iVertex < nVertexDomain[nMarker]; iVertex++) {
 
         MI = Global_to_Local_Point.find(ReceivedDomainLocal[iDomain][iVertex]);
-        if (MI != Global_to_Local_Point.end())
-          iPoint = Global_to_Local_Point[ReceivedDomainLocal[iDomain][iVertex]];
+        if (MI != Global_to_Local_Point.end()) iPoint = MI->second;
         else iPoint = std::numeric_limits<unsigned long>::max();
 
         ReceivedDomainLocal[iDomain][iVertex] = iPoint;
@@ -3357,14 +3407,9 @@ void CPhysicalGeometry::SetSendReceive(const CConfig *config) {
 void CPhysicalGeometry::SetBoundaries(CConfig *config) {
 
   unsigned long iElem_Bound, TotalElem, *nElem_Bound_Copy, iVertex_;
-  string Grid_Marker;
-  unsigned short iDomain, nDomain, iMarkersDomain, iLoop, *DomainCount, nMarker_Physical, Duplicate_SendReceive, *DomainSendCount,
-                 **DomainSendMarkers, *DomainReceiveCount, **DomainReceiveMarkers, nMarker_SendRecv, iMarker, iMarker_;
+  unsigned short nMarker_Physical, nMarker_SendRecv, iMarker, iMarker_;
   CPrimalGrid*** bound_Copy;
   short *Marker_All_SendRecv_Copy;
-  bool CheckStart;
-
-  nDomain = size+1;
 
   /*--- Count the number of physical markers
    in the boundaries ---*/
@@ -3376,75 +3421,36 @@ void CPhysicalGeometry::SetBoundaries(CConfig *config) {
     }
   }
 
-  /*--- Identify if there are markers that send/received with the same domain,
-   they should be together---*/
+  /*--- Markers that send to (or receive from) the same domain must be merged.
+   The send/receive markers are sorted by (domain, send before receive, marker),
+   which gives consecutive groups of markers to merge without looping over
+   all the ranks (that would not scale to large numbers of ranks). ---*/
 
-  Duplicate_SendReceive = 0;
-  for (iLoop = 0; iLoop < 2; iLoop++) {
+  vector<array<unsigned long,3> > SendRecvMarkers;
 
-    DomainCount = new unsigned short [nDomain];
-
-    for (iDomain = 0; iDomain < nDomain; iDomain++)
-      DomainCount[iDomain] = 0;
-
-    if (iLoop == 0) {
-      for (iDomain = 0; iDomain < nDomain; iDomain++)
-        for (iMarker = 0; iMarker < nMarker; iMarker++)
-          if (bound[iMarker][0]->GetVTK_Type() == VERTEX)
-            if (Marker_All_SendRecv[iMarker] == iDomain) DomainCount[iDomain]++;
-    }
-    else {
-      for (iDomain = 0; iDomain < nDomain; iDomain++)
-        for (iMarker = 0; iMarker < nMarker; iMarker++)
-          if (bound[iMarker][0]->GetVTK_Type() == VERTEX)
-            if (Marker_All_SendRecv[iMarker] == -iDomain) DomainCount[iDomain]++;
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (bound[iMarker][0]->GetVTK_Type() == VERTEX) {
+      const auto SendRecv = Marker_All_SendRecv[iMarker];
+      if (SendRecv > 0) SendRecvMarkers.push_back({{static_cast<unsigned long>(SendRecv), 0ul, iMarker}});
+      if (SendRecv < 0) SendRecvMarkers.push_back({{static_cast<unsigned long>(-SendRecv), 1ul, iMarker}});
     }
-
-    for (iDomain = 0; iDomain < nDomain; iDomain++)
-      if (DomainCount[iDomain] > 1) Duplicate_SendReceive++;
-
-    delete [] DomainCount;
-
   }
+  sort(SendRecvMarkers.begin(), SendRecvMarkers.end());
 
-  DomainSendCount = new unsigned short [nDomain];
-  DomainSendMarkers = new unsigned short *[nDomain];
-  DomainReceiveCount = new unsigned short [nDomain];
-  DomainReceiveMarkers = new unsigned short *[nDomain];
-
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    DomainSendCount[iDomain] = 0;
-    DomainSendMarkers[iDomain] = new unsigned short [nMarker];
-
-    DomainReceiveCount[iDomain] = 0;
-    DomainReceiveMarkers[iDomain] = new unsigned short [nMarker];
-  }
+  auto sameGroup = [&](size_t i, size_t j) {
+    return (SendRecvMarkers[i][0] == SendRecvMarkers[j][0]) && (SendRecvMarkers[i][1] == SendRecvMarkers[j][1]);
+  };
 
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    for (iMarker = 0; iMarker < nMarker; iMarker++) {
-      if (bound[iMarker][0]->GetVTK_Type() == VERTEX) {
-        if (Marker_All_SendRecv[iMarker] == iDomain) {
-          DomainSendMarkers[iDomain][DomainSendCount[iDomain]] = iMarker;
-          DomainSendCount[iDomain]++;
-        }
-        if (Marker_All_SendRecv[iMarker] == -iDomain) {
-          DomainReceiveMarkers[iDomain][DomainReceiveCount[iDomain]] = iMarker;
-          DomainReceiveCount[iDomain]++;
-        }
-      }
-    }
-  }
+  nMarker_SendRecv = 0;
+  for (size_t iGroup = 0; iGroup < SendRecvMarkers.size(); iGroup++)
+    if ((iGroup == 0) || !sameGroup(iGroup, iGroup-1)) nMarker_SendRecv++;
 
   /*--- Create an structure to store the Send/Receive
    boundaries, because they require some reorganization ---*/
 
-  nMarker_SendRecv = nMarker - nMarker_Physical - Duplicate_SendReceive;
   bound_Copy = new CPrimalGrid**[nMarker_Physical + nMarker_SendRecv];
   nElem_Bound_Copy = new unsigned long [nMarker_Physical + nMarker_SendRecv];
   Marker_All_SendRecv_Copy = new short [nMarker_Physical + nMarker_SendRecv];
-  iMarker_ = nMarker_Physical;
-  iVertex_ = 0;
-  CheckStart = false;
 
   /*--- Copy and allocate the physical markers in the data structure ---*/
 
@@ -3472,78 +3478,37 @@ void CPhysicalGeometry::SetBoundaries(CConfig *config) {
     }
   }
 
+  /*--- Merge each group of Send/Receive markers into a single marker. ---*/
 
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-
-    /*--- Compute the total number of elements (adding all the
-     boundaries with the same Send/Receive ---*/
-
-    if (DomainSendCount[iDomain] != 0) {
-      TotalElem = 0;
-      for (iMarkersDomain = 0; iMarkersDomain < DomainSendCount[iDomain]; iMarkersDomain++) {
-        iMarker = DomainSendMarkers[iDomain][iMarkersDomain];
-        TotalElem += nElem_Bound[iMarker];
-      }
-      if (CheckStart) iMarker_++;
-      CheckStart = true;
-      iVertex_ = 0;
-      nElem_Bound_Copy[iMarker_] = TotalElem;
-      bound_Copy[iMarker_] = new CPrimalGrid*[TotalElem];
-    }
-
-    for (iMarkersDomain = 0; iMarkersDomain < DomainSendCount[iDomain]; iMarkersDomain++) {
-      iMarker = DomainSendMarkers[iDomain][iMarkersDomain];
-      Marker_All_SendRecv_Copy[iMarker_] = Marker_All_SendRecv[iMarker];
-
-      for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
-        bound_Copy[iMarker_][iVertex_] = new CVertexMPI(bound[iMarker][iElem_Bound]->GetNode(0));
-        bound_Copy[iMarker_][iVertex_]->SetRotation_Type(bound[iMarker][iElem_Bound]->GetRotation_Type());
-        iVertex_++;
-      }
+  iMarker_ = nMarker_Physical;
 
-    }
+  for (size_t iGroup = 0; iGroup < SendRecvMarkers.size(); ) {
 
     /*--- Compute the total number of elements (adding all the
      boundaries with the same Send/Receive ---*/
 
-    if (DomainReceiveCount[iDomain] != 0) {
-      TotalElem = 0;
-      for (iMarkersDomain = 0; iMarkersDomain < DomainReceiveCount[iDomain]; iMarkersDomain++) {
-        iMarker = DomainReceiveMarkers[iDomain][iMarkersDomain];
-        TotalElem += nElem_Bound[iMarker];
-      }
-      if (CheckStart) iMarker_++;
-      CheckStart = true;
-      iVertex_ = 0;
-      nElem_Bound_Copy[iMarker_] = TotalElem;
-      bound_Copy[iMarker_] = new CPrimalGrid*[TotalElem];
+    auto jGroup = iGroup;
+    TotalElem = 0;
+    for (; (jGroup < SendRecvMarkers.size()) && sameGroup(iGroup, jGroup); jGroup++)
+      TotalElem += nElem_Bound[SendRecvMarkers[jGroup][2]];
 
-    }
+    nElem_Bound_Copy[iMarker_] = TotalElem;
+    bound_Copy[iMarker_] = new CPrimalGrid*[TotalElem];
+    Marker_All_SendRecv_Copy[iMarker_] = Marker_All_SendRecv[SendRecvMarkers[iGroup][2]];
 
-    for (iMarkersDomain = 0; iMarkersDomain < DomainReceiveCount[iDomain]; iMarkersDomain++) {
-      iMarker = DomainReceiveMarkers[iDomain][iMarkersDomain];
-      Marker_All_SendRecv_Copy[iMarker_] = Marker_All_SendRecv[iMarker];
+    iVertex_ = 0;
+    for (; iGroup < jGroup; iGroup++) {
+      iMarker = SendRecvMarkers[iGroup][2];
 
       for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++) {
         bound_Copy[iMarker_][iVertex_] = new CVertexMPI(bound[iMarker][iElem_Bound]->GetNode(0));
         bound_Copy[iMarker_][iVertex_]->SetRotation_Type(bound[iMarker][iElem_Bound]->GetRotation_Type());
         iVertex_++;
       }
-
     }
-
+    iMarker_++;
   }
 
-  delete [] DomainSendCount;
-  for (iDomain = 0; iDomain < nDomain; iDomain++)
-    delete [] DomainSendMarkers[iDomain];
-  delete[] DomainSendMarkers;
-
-  delete [] DomainReceiveCount;
-  for (iDomain = 0; iDomain < nDomain; iDomain++)
-    delete [] DomainReceiveMarkers[iDomain];
-  delete[] DomainReceiveMarkers;
-
    /*--- Deallocate the bound variables ---*/
 
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
@@ -599,6 +599,7 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 }
 
 template<class ScalarType>
+SU2_MULTIVERSION
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                  CGeometry *geometry, const CConfig *config) const {
 
@@ -643,6 +644,7 @@ void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
 }
 
 template<class ScalarType>
+SU2_MULTIVERSION
 void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                          CGeometry *geometry, const CConfig *config) const {
 
@@ -660,6 +662,7 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 }
 
 template<class ScalarType>
+SU2_MULTIVERSION
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Copy block matrix to compute factorization in-place. ---*/
@@ -767,6 +770,7 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 }
 
 template<class ScalarType>
+SU2_MULTIVERSION
 void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                       CGeometry *geometry, const CConfig *config) const {
   /*--- Coherent view of vectors. ---*/
@@ -826,6 +830,7 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
 }
 
 template<class ScalarType>
+SU2_MULTIVERSION
 void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                          CGeometry *geometry, const CConfig *config) const {
 
@@ -1060,6 +1065,7 @@ unsigned long CSysMatrix<ScalarType>::BuildLineletPreconditioner(CGeometry *geom
 }
 
 template<class ScalarType>
+SU2_MULTIVERSION
 void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<ScalarType> & vec, CSysVector<ScalarType> & prod,
                                                           CGeometry *geometry, const CConfig *config) const {
   /*--- Coherent view of vectors. ---*/
@@ -1169,6 +1175,7 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
 }
 
 template<class ScalarType>
+SU2_MULTIVERSION
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType> & sol, const CSysVector<ScalarType> & f,
                                              CSysVector<ScalarType> & res) const {
   SU2_OMP_BARRIER
@@ -29,6 +29,8 @@
 #pragma once
 #include "CSinglezoneDriver.hpp"
 
+class CPrimalCheckpoints;
+
 /*!
  * \class CDiscAdjSinglezoneDriver
  * \brief Class for driving single-zone adjoint solvers.
@@ -56,6 +58,32 @@ protected:
 
   COutputLegacy* output_legacy;
 
+  CPrimalCheckpoints* primal_checkpoints = nullptr; /*!< \brief In-memory primal states of unsteady adjoints. */
+  unsigned long nPointRecorded = 0;                 /*!< \brief Global number of points registered in the last recording. */
+
+  /*!
+   * \brief Converge one time step of the direct problem, used to recompute the primal states between checkpoints.
+   * \note The convergence criteria are those of the direct problem, but the maximum number of inner iterations
+   *       is INNER_ITER of the adjoint configuration.
+   * \param[in] DirectIter - Direct time step.
+   */
+  void RecomputePrimalStep(long DirectIter);
+
+  /*!
+   * \brief Make the inputs of the points beyond the first TapeFraction of each rank passive again, such that
+   *        only the operations that depend on those first points are recorded.
+   * \note The free-stream variables and the inputs of MESH_DEFORM recordings remain registered.
+   * \param[in] kind_recording - Kind of recording whose inputs were registered.
+   * \return Global number of points whose inputs remain registered.
+   */
+  unsigned long ResetInputsBeyondFraction(RECORDING kind_recording);
+
+  /*!
+   * \brief Record the main and secondary tapes of the first time step for a fraction of the points (TAPE_DRY_RUN_FRACTION)
+   *        and extrapolate the memory of the full tapes, without evaluating them.
+   */
+  void TapeDryRun();
+
 public:
 
   /*!
@@ -74,6 +102,11 @@ public:
    */
   ~CDiscAdjSinglezoneDriver(void) override;
 
+  /*!
+   * \brief Launch the computation, or only record the tapes to report their memory (TAPE_DRY_RUN).
+   */
+  void StartSolver() override;
+
   /*!
    * \brief Preprocess the single-zone iteration
    * \param[in] TimeIter - index of the current time-step.
@@ -319,6 +319,14 @@ protected:
    */
   void Print_DirectResidual(RECORDING kind_recording);
 
+  /*!
+   * \brief Split a communicator, ranks keep their relative order.
+   * \param[in] comm - Communicator to split.
+   * \param[in] color - Group of the rank.
+   * \return The communicator of the group.
+   */
+  static SU2_Comm SplitCommunicator(SU2_Comm comm, int color);
+
 public:
 
   /*!
@@ -903,9 +911,21 @@ class CHBDriver : public CFluidDriver {
 
 private:
   COutputLegacy* output_legacy;
-  unsigned short nInstHB;
+  unsigned short nInstHB;        /*!< \brief Total number of time instances (over all groups). */
   su2double **D; /*!< \brief Harmonic Balance operator. */
 
+  SU2_Comm worldComm;            /*!< \brief Communicator of all the groups. */
+  SU2_Comm instComm;             /*!< \brief Ranks with the same rank in every group, ordered by group. */
+  unsigned short nGroups = 1;    /*!< \brief Number of groups of ranks that share the time instances. */
+  unsigned short firstInst = 0;  /*!< \brief Global index of the first instance of this group. */
+
+  /*!
+   * \brief Sum a buffer of rows ordered by instance over the groups of ranks, each group keeps only
+   *        the rows of its instances (no-op with a single group).
+   * \param[in,out] buffer - Contributions of this group to all rows on entry, sum of the rows of this group on exit.
+   */
+  void SumOverGroups(vector<su2double>& buffer) const;
+
 public:
 
   /*!
@@ -913,11 +933,15 @@ public:
    * \param[in] confFile - Configuration file name.
    * \param[in] val_nZone - Total number of zones.
    * \param[in] val_nDim - Number of dimensions.
-   * \param[in] MPICommunicator - MPI communicator for SU2.
+   * \param[in] MPICommunicator - MPI communicator of all the groups.
+   * \param[in] val_nGroups - Number of groups of ranks (see HB_PARALLEL_GROUPS), the communicator is split if > 1.
+   * \param[in] val_iGroup - Group of ranks of this rank.
    */
   CHBDriver(char* confFile,
             unsigned short val_nZone,
-            SU2_Comm MPICommunicator);
+            SU2_Comm MPICommunicator,
+            unsigned short val_nGroups = 1,
+            unsigned short val_iGroup = 0);
 
   /*!
    * \brief Destructor of the class.
@@ -930,11 +954,12 @@ public:
   void Run() override;
 
   /*!
-   * \brief Computation and storage of the Harmonic Balance method source terms.
+   * \brief Computation and storage of the Harmonic Balance method source terms of the instances of this group.
    * \author T. Economon, K. Naik
-   * \param[in] iZone - Current zone number.
+   * \note Each group adds the contributions of its instances to the sources of all instances, which are
+   *       then summed over the groups.
    */
-  void SetHarmonicBalance(unsigned short iZone);
+  void SetHarmonicBalance();
 
   /*!
    * \brief Precondition Harmonic Balance source term for stability
@@ -942,6 +967,11 @@ public:
    */
   void StabilizeHarmonicBalance();
 
+  /*!
+   * \brief Monitor the computation, the groups stop together.
+   */
+  bool Monitor(unsigned long ExtIter) override;
+
   /*!
    * \brief Computation of the Harmonic Balance operator matrix for harmonic balance.
    * \author A. Rubino, S. Nimmagadda
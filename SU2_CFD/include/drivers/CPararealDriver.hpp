@@ -0,0 +1,103 @@
+/*!
+ * \file CPararealDriver.hpp
+ * \brief Headers of the parallel-in-time (Parareal) driver for dual time stepping problems.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include "CSinglezoneDriver.hpp"
+
+/*!
+ * \class CPararealDriver
+ * \brief Parallel-in-time driver for single-zone dual time stepping problems.
+ * \details The ranks are split in TIME_PARALLEL_GROUPS contiguous groups, each group solves the
+ *          same (identically partitioned) problem on one slice of the time window. The Parareal
+ *          iteration combines a cheap coarse propagator G (time step PARAREAL_COARSE_FACTOR times
+ *          larger), that is applied sequentially across slices, with the fine propagator F (the
+ *          usual dual time integration), that is applied to all slices in parallel:
+ *          U_{g+1}^k = G(U_g^k) + F(U_g^{k-1}) - G(U_g^{k-1}).
+ *          The state of a slice is the solution at the two previous time levels of all solvers
+ *          that are integrated in time, hence the fine solution is recovered exactly after as
+ *          many iterations as there are slices.
+ * \version 7.2.1 "Blackbird"
+ */
+class CPararealDriver : public CSinglezoneDriver {
+protected:
+  using StateType = vector<passivedouble>;
+
+  SU2_Comm worldComm;            /*!< \brief Communicator of all the groups. */
+  SU2_Comm timeComm;             /*!< \brief Ranks with the same rank in every group, ordered by slice. */
+  unsigned short nGroups = 1;    /*!< \brief Number of time slices. */
+  unsigned short iGroup = 0;     /*!< \brief Time slice of this group. */
+  unsigned long firstTimeIter;   /*!< \brief First time iteration of the time window. */
+  unsigned long nSliceIter;      /*!< \brief Number of (fine) time iterations per slice. */
+  unsigned short coarseFactor;   /*!< \brief Ratio between the coarse and fine time steps. */
+  su2double fineTimeStep;        /*!< \brief Non-dimensional (fine) time step. */
+
+  /*!
+   * \brief Size of the state of a slice (for this rank).
+   */
+  unsigned long GetStateSize() const;
+
+  /*!
+   * \brief Extract the state from the solvers after a time iteration.
+   * \param[out] state - Solution at time levels n and n-1 (interleaved).
+   * \param[in] ratio - Ratio between the time step of the state and that of the solvers.
+   */
+  void GetState(StateType& state, su2double ratio) const;
+
+  /*!
+   * \brief Initialize the solvers (and their multigrid levels) from a state.
+   * \param[in] state - Solution at time levels n and n-1 (interleaved).
+   * \param[in] ratio - Ratio between the time step of the solvers and that of the state.
+   */
+  void SetState(const StateType& state, su2double ratio);
+
+  /*!
+   * \brief Integrate the slice of this group.
+   * \param[in,out] state - Initial state on entry, final state on exit.
+   * \param[in] coarse - Use the coarse propagator.
+   * \param[in] writeOutput - Write screen, history, and solution files (otherwise output is suppressed).
+   */
+  void Propagate(StateType& state, bool coarse, bool writeOutput);
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator of all the groups.
+   * \param[in] val_iGroup - Group (time slice) of this rank.
+   */
+  CPararealDriver(char* confFile,
+                  unsigned short val_nZone,
+                  SU2_Comm MPICommunicator,
+                  unsigned short val_iGroup);
+
+  /*!
+   * \brief Launch the Parareal iteration.
+   */
+  void StartSolver() override;
+
+};
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
 
 using namespace std;
 
@@ -68,4 +69,21 @@ class CConductivityModel {
    */
   virtual void SetDerConductivity(su2double t, su2double rho, su2double dmudrho_t, su2double dmudt_rho,
                                   su2double cp) = 0;
+
+  /*!
+   * \brief Compute the thermal conductivity and its derivatives for "n" points (see CFluidModel::StateBatch).
+   * \note The default implementation loops over the scalar functions, "n" is a multiple of the SIMD length.
+   */
+  virtual void ComputeConductivity(size_t n, const su2double* t, const su2double* rho, const su2double* mu_lam,
+                                   su2double mu_turb, const su2double* cp, const su2double* dmudrho_t,
+                                   const su2double* dmudt_rho, su2double* kt, su2double* dktdrho_t,
+                                   su2double* dktdt_rho) {
+    for (size_t i = 0; i < n; ++i) {
+      SetConductivity(t[i], rho[i], mu_lam[i], mu_turb, cp[i]);
+      kt[i] = GetConductivity();
+      SetDerConductivity(t[i], rho[i], dmudrho_t[i], dmudt_rho[i], cp[i]);
+      dktdrho_t[i] = Getdktdrho_T();
+      dktdt_rho[i] = GetdktdT_rho();
+    }
+  }
 };
@@ -71,6 +71,26 @@ class CConstantPrandtl final : public CConductivityModel {
     dktdt_rho_ = dmudt_rho * cp / pr_lam_;
   }
 
+  /*!
+   * \brief Compute the thermal conductivity and its derivatives for "n" points, vectorized.
+   */
+  void ComputeConductivity(size_t n, const su2double* t, const su2double* rho, const su2double* mu_lam,
+                           su2double mu_turb, const su2double* cp, const su2double* dmudrho_t,
+                           const su2double* dmudt_rho, su2double* kt, su2double* dktdrho_t,
+                           su2double* dktdt_rho) override {
+    using Double = simd::Array<su2double>;
+
+    for (size_t i = 0; i < n; i += Double::Size) {
+      const Double Cp(cp + i);
+      Double tmp = Double(mu_lam + i) * Cp / pr_lam_;
+      tmp.store(kt + i);
+      tmp = Double(dmudrho_t + i) * Cp / pr_lam_;
+      tmp.store(dktdrho_t + i);
+      tmp = Double(dmudt_rho + i) * Cp / pr_lam_;
+      tmp.store(dktdt_rho + i);
+    }
+  }
+
  private:
   su2double kt_{0.0};        /*!< \brief Thermal conductivity. */
   su2double dktdrho_t_{0.0}; /*!< \brief DktDrho_T. */
@@ -69,6 +69,24 @@ class CConstantPrandtlRANS final : public CConductivityModel {
   void SetDerConductivity(su2double t, su2double rho, su2double dmudrho_t, su2double dmudt_rho, su2double cp) override {
   }
 
+  /*!
+   * \brief Compute the thermal conductivity of "n" points, vectorized (the derivatives are not computed by this model).
+   */
+  void ComputeConductivity(size_t n, const su2double* t, const su2double* rho, const su2double* mu_lam,
+                           su2double mu_turb, const su2double* cp, const su2double* dmudrho_t,
+                           const su2double* dmudt_rho, su2double* kt, su2double* dktdrho_t,
+                           su2double* dktdt_rho) override {
+    using Double = simd::Array<su2double>;
+    const su2double turbTerm = mu_turb / pr_turb_;
+
+    for (size_t i = 0; i < n; i += Double::Size) {
+      const Double tmp = Double(cp + i) * ((Double(mu_lam + i) / pr_lam_) + turbTerm);
+      tmp.store(kt + i);
+      Double(dktdrho_t_).store(dktdrho_t + i);
+      Double(dktdt_rho_).store(dktdt_rho + i);
+    }
+  }
+
  private:
   su2double kt_{0.0};        /*!< \brief Effective thermal conductivity. */
   su2double dktdrho_t_{0.0}; /*!< \brief DktDrho_T. */
@@ -66,6 +66,18 @@ class CConstantViscosity final : public CViscosityModel {
    */
   void SetDerViscosity(su2double t, su2double rho) override {}
 
+  /*!
+   * \brief Set the viscosity and its derivatives of "n" points.
+   */
+  void ComputeViscosity(size_t n, const su2double* t, const su2double* rho, su2double* mu,
+                        su2double* dmudrho_t, su2double* dmudt_rho) override {
+    for (size_t i = 0; i < n; ++i) {
+      mu[i] = mu_;
+      dmudrho_t[i] = dmudrho_t_;
+      dmudt_rho[i] = dmudt_rho_;
+    }
+  }
+
  private:
   su2double mu_{0.0};        /*!< \brief Dynamic viscosity. */
   su2double dmudrho_t_{0.0}; /*!< \brief DmuDrho_T. */
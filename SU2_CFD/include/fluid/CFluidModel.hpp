@@ -72,6 +72,44 @@ class CFluidModel {
   unique_ptr<CConductivityModel> ThermalConductivity; /*!< \brief Thermal Conductivity Model */
 
  public:
+  /*!
+   * \brief Number of points processed by each call of the batched (array-based) interface,
+   *        it must be a multiple of the SIMD length of any architecture.
+   */
+  static constexpr size_t BATCH_SIZE = 16;
+
+  /*!
+   * \brief Thermodynamic state and transport properties of a batch of points.
+   * \note Only the first "size" entries are meaningful, but the implementations may process
+   *       all BATCH_SIZE entries, the others are initialized to valid (positive) values.
+   */
+  struct StateBatch {
+    size_t size = BATCH_SIZE;               /*!< \brief Number of points in the batch. */
+    su2double Density[BATCH_SIZE];          /*!< \brief Input of the (rho, e) functions, output of (P, T). */
+    su2double StaticEnergy[BATCH_SIZE];     /*!< \brief Input of the (rho, e) functions, output of (P, T). */
+    su2double Pressure[BATCH_SIZE];         /*!< \brief Input of the (P, T) functions, output of (rho, e). */
+    su2double Temperature[BATCH_SIZE];      /*!< \brief Input of the (P, T) functions, output of (rho, e). */
+    su2double SoundSpeed2[BATCH_SIZE];      /*!< \brief Square of the speed of sound. */
+    su2double Cp[BATCH_SIZE];               /*!< \brief Specific heat at constant pressure. */
+    su2double dPdrho_e[BATCH_SIZE];         /*!< \brief Pressure derivative w.r.t. density. */
+    su2double dPde_rho[BATCH_SIZE];         /*!< \brief Pressure derivative w.r.t. energy. */
+    su2double dTdrho_e[BATCH_SIZE];         /*!< \brief Temperature derivative w.r.t. density. */
+    su2double dTde_rho[BATCH_SIZE];         /*!< \brief Temperature derivative w.r.t. energy. */
+    su2double LaminarViscosity[BATCH_SIZE]; /*!< \brief Output of ComputeTransport. */
+    su2double dmudrho_T[BATCH_SIZE];        /*!< \brief Output of ComputeTransport. */
+    su2double dmudT_rho[BATCH_SIZE];        /*!< \brief Output of ComputeTransport. */
+    su2double Conductivity[BATCH_SIZE];     /*!< \brief Output of ComputeTransport. */
+    su2double dktdrho_T[BATCH_SIZE];        /*!< \brief Output of ComputeTransport. */
+    su2double dktdT_rho[BATCH_SIZE];        /*!< \brief Output of ComputeTransport. */
+
+    StateBatch() {
+      for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        Density[i] = StaticEnergy[i] = Pressure[i] = Temperature[i] = 1.0;
+        SoundSpeed2[i] = Cp[i] = LaminarViscosity[i] = 1.0;
+      }
+    }
+  };
+
   virtual ~CFluidModel() {}
 
   /*!
@@ -298,4 +336,35 @@ class CFluidModel {
    */
   void SetEddyViscosity(su2double val_Mu_Turb) { Mu_Turb = val_Mu_Turb; }
 
+  /*!
+   * \brief Compute the thermodynamic state of a batch of points given their density and static energy.
+   * \note Unlike SetTDState_rhoe, this does not modify the state of the fluid model (thread-safe for
+   *       models that override it). The default implementation loops over the scalar functions.
+   * \param[in,out] batch - Inputs: Density, StaticEnergy; Outputs: Pressure, Temperature, SoundSpeed2,
+   *                  Cp, and the derivatives of pressure and temperature.
+   */
+  virtual void ComputeStates_rhoe(StateBatch& batch);
+
+  /*!
+   * \brief Compute the thermodynamic state of a batch of points given their pressure and temperature.
+   * \param[in,out] batch - Inputs: Pressure, Temperature; Outputs: Density, StaticEnergy, SoundSpeed2,
+   *                  Cp, and the derivatives of pressure and temperature.
+   */
+  virtual void ComputeStates_PT(StateBatch& batch);
+
+  /*!
+   * \brief Compute the laminar viscosity, thermal conductivity, and their derivatives, for a batch of
+   *        points whose state was computed with ComputeStates_rhoe or ComputeStates_PT.
+   * \note The eddy viscosity given by SetEddyViscosity is used for all points, as in GetThermalConductivity.
+   * \param[in,out] batch - Inputs: Density, Temperature, Cp; Outputs: LaminarViscosity, Conductivity,
+   *                  and their derivatives.
+   */
+  void ComputeTransport(StateBatch& batch) const;
+
+ protected:
+  /*!
+   * \brief Copy the current (scalar) state of the fluid model into entry "i" of a batch.
+   */
+  void GetTDState(StateBatch& batch, size_t i) const;
+
 };
@@ -106,4 +106,16 @@ class CIdealGas : public CFluidModel {
    *
    */
   void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Compute the state of a batch of points using density and internal energy, vectorized.
+   * \param[in,out] batch - See CFluidModel::ComputeStates_rhoe.
+   */
+  void ComputeStates_rhoe(StateBatch& batch) override;
+
+  /*!
+   * \brief Compute the state of a batch of points using pressure and temperature, vectorized.
+   * \param[in,out] batch - See CFluidModel::ComputeStates_PT.
+   */
+  void ComputeStates_PT(StateBatch& batch) override;
 };
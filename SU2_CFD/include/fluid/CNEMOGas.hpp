@@ -37,6 +37,31 @@
  */
 class CNEMOGas : public CFluidModel {
 
+public:
+  /*!
+   * \brief State of a batch of (up to BATCH_SIZE) points, for the batched thermochemistry functions.
+   * \note Species quantities are stored by species, i.e. the value of point k is at [iSpecies*BATCH_SIZE+k].
+   */
+  struct ThermoChemBatch {
+    size_t size = 0;                     /*!< \brief Number of valid points. */
+    vector<su2double> rhos;              /*!< \brief Species densities. */
+    vector<su2double> ws;                /*!< \brief Species net production rates. */
+    su2double T[BATCH_SIZE];             /*!< \brief Translational-rotational temperature. */
+    su2double Tve[BATCH_SIZE];           /*!< \brief Vibrational-electronic temperature. */
+    su2double rhoE[BATCH_SIZE];          /*!< \brief Total energy per unit volume. */
+    su2double rhoEve[BATCH_SIZE];        /*!< \brief Vibrational-electronic energy per unit volume. */
+    su2double rhoEvel[BATCH_SIZE];       /*!< \brief Kinetic energy per unit volume. */
+    su2double EveSource[BATCH_SIZE];     /*!< \brief Vibrational-electronic energy source term. */
+
+    explicit ThermoChemBatch(unsigned short nSpecies) :
+      rhos(nSpecies*BATCH_SIZE, 0.0), ws(nSpecies*BATCH_SIZE, 0.0) {
+      for (size_t k = 0; k < BATCH_SIZE; ++k) {
+        T[k] = Tve[k] = 300.0;
+        rhoE[k] = rhoEve[k] = rhoEvel[k] = EveSource[k] = 0.0;
+      }
+    }
+  };
+
 protected:
 
   bool frozen,                           /*!< \brief Indicates if mixture is frozen. */
@@ -179,6 +204,27 @@ public:
    */
   virtual vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel) = 0;
 
+  /*!
+   * \brief Compute the temperatures of a batch of points from rhos, rhoE, rhoEve, and rhoEvel.
+   * \note The default implementation loops over the points using ComputeTemperatures.
+   * \param[in,out] batch - Sets T and Tve.
+   */
+  virtual void ComputeBatchTemperatures(ThermoChemBatch& batch);
+
+  /*!
+   * \brief Compute the species net production rates of a batch of points from rhos, T, and Tve.
+   * \note The default implementation loops over the points using ComputeNetProductionRates.
+   * \param[in,out] batch - Sets ws.
+   */
+  virtual void ComputeBatchNetProductionRates(ThermoChemBatch& batch);
+
+  /*!
+   * \brief Compute the vibrational-electronic energy source term of a batch of points from rhos, T, Tve, and ws.
+   * \note The default implementation loops over the points using ComputeEveSourceTerm.
+   * \param[in,out] batch - Sets EveSource.
+   */
+  virtual void ComputeBatchEveSourceTerm(ThermoChemBatch& batch);
+
   /*!
    * \brief Compute speed of sound.
    */
@@ -110,6 +110,16 @@ class CPengRobinson final : public CIdealGas {
    */
   void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
 
+  /*!
+   * \brief The batched interface uses the scalar functions (not the ideal gas ones).
+   */
+  void ComputeStates_rhoe(StateBatch& batch) override { CFluidModel::ComputeStates_rhoe(batch); }
+
+  /*!
+   * \brief The batched interface uses the scalar functions (not the ideal gas ones).
+   */
+  void ComputeStates_PT(StateBatch& batch) override { CFluidModel::ComputeStates_PT(batch); }
+
  private:
   /*!
    * \brief Internal model parameter.
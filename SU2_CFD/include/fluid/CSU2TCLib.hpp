@@ -67,11 +67,14 @@ private:
   su2activematrix CharElTemp,    /*!< \brief Characteristic temperature of electron states. */
   ElDegeneracy,                  /*!< \brief Degeneracy of electron states. */
   RxnConstantTable,              /*!< \brief Table of chemical equiibrium reaction constants */
+  MillikanWhiteA,                /*!< \brief Millikan & White relaxation time coefficient A of each species pair. */
+  MillikanWhiteB,                /*!< \brief Millikan & White relaxation time coefficient B of each species pair. */
   Blottner,                      /*!< \brief Blottner viscosity coefficients */
   Dij;                           /*!< \brief Binary diffusion coefficients. */
 
   C3DDoubleMatrix Omega00,       /*!< \brief Collision integrals (Omega(0,0)) */
-  Omega11;                       /*!< \brief Collision integrals (Omega(1,1)) */
+  Omega11,                       /*!< \brief Collision integrals (Omega(1,1)) */
+  RxnConstantTables;             /*!< \brief Tables of equilibrium reaction constants of each reaction. */
 
   /*--- Implicit variables ---*/
   su2double                     /*!< \brief Derivatives w.r.t. conservative variables */
@@ -188,6 +191,21 @@ public:
    */
   vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel) final;
 
+  /*!
+   * \brief Compute the temperatures of a batch of points (vectorized bisection method).
+   */
+  void ComputeBatchTemperatures(ThermoChemBatch& batch) final;
+
+  /*!
+   * \brief Compute the species net production rates of a batch of points (vectorized).
+   */
+  void ComputeBatchNetProductionRates(ThermoChemBatch& batch) final;
+
+  /*!
+   * \brief Compute the vibrational-electronic energy source term of a batch of points (vectorized).
+   */
+  void ComputeBatchEveSourceTerm(ThermoChemBatch& batch) final;
+
   private:
 
   /*!
@@ -202,6 +220,23 @@ public:
    */
   void ComputeKeqConstants(unsigned short val_Reaction);
 
+  /*!
+   * \brief Interpolate the equilibrium constants of a reaction for a mixture number density.
+   * \param[in] iReaction - Reaction number indicator.
+   * \param[in] N - Mixture number density [1/cm^3].
+   * \param[out] coeffs - The 5 coefficients of the Keq correlation.
+   */
+  void InterpolateKeqConstants(unsigned short iReaction, su2double N, su2double* coeffs) const;
+
+  /*!
+   * \brief Compute the species V-E energies of a pack of points.
+   * \param[in] val_T - Temperatures.
+   * \param[in] vibe_only - Only the vibrational energy.
+   * \param[out] val_eves - Energies of each species.
+   */
+  template<class Double>
+  void ComputeSpeciesEveBatch(const Double& val_T, bool vibe_only, Double* val_eves) const;
+
   /*!
    * \brief Get species diffusion coefficients with Wilke/Blottner/Eucken transport model.
    */
@@ -75,6 +75,28 @@ class CSutherland final : public CViscosityModel {
     dmudt_rho_ = mu_ref_ * (t_ref_ + s_) * ts_inv * sqrt(t_nondim) * (1.5 * t_ref_inv - t_nondim * ts_inv);
   }
 
+  /*!
+   * \brief Compute the viscosity and its derivatives for "n" points, vectorized.
+   */
+  void ComputeViscosity(size_t n, const su2double* t, const su2double* rho, su2double* mu,
+                        su2double* dmudrho_t, su2double* dmudt_rho) override {
+    using Double = simd::Array<su2double>;
+    const su2double t_ref_inv = 1.0 / t_ref_;
+
+    for (size_t i = 0; i < n; i += Double::Size) {
+      const Double T(t + i);
+      Double t_nondim = T / t_ref_;
+      Double tmp = mu_ref_ * t_nondim * sqrt(t_nondim) * ((t_ref_ + s_) / (T + s_));
+      tmp.store(mu + i);
+
+      t_nondim = t_ref_inv * T;
+      const Double ts_inv = 1.0 / (T + s_);
+      tmp = mu_ref_ * (t_ref_ + s_) * ts_inv * sqrt(t_nondim) * (1.5 * t_ref_inv - t_nondim * ts_inv);
+      tmp.store(dmudt_rho + i);
+      Double(0.0).store(dmudrho_t + i);
+    }
+  }
+
  private:
   su2double mu_{0.0};        /*!< \brief Dynamic viscosity. */
   su2double dmudrho_t_{0.0}; /*!< \brief DmuDrho_T. */
@@ -0,0 +1,166 @@
+/*!
+ * \file CTabulatedGas.hpp
+ * \brief Defines a fluid model that interpolates the properties of another model from a look-up table.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "CFluidModel.hpp"
+
+/*!
+ * \class CTabulatedGas
+ * \brief Fluid model that interpolates (bilinearly) the thermodynamic properties, and their derivatives,
+ *        from a table over a uniform grid of density and static energy, built with another fluid model.
+ * \note The states outside the table, and the functions that do not take (rho, e) as inputs, use the
+ *       original model. The transport properties are computed as for any other model.
+ */
+class CTabulatedGas final : public CFluidModel {
+ public:
+  /*!
+   * \brief Properties stored at each node of the table.
+   */
+  enum TABLE_PROPERTY : unsigned short {
+    PRESSURE, TEMPERATURE, SOUNDSPEED2, DPDRHO_E, DPDE_RHO, DTDRHO_E, DTDE_RHO, CP, ENTROPY, N_PROPERTIES
+  };
+
+  /*!
+   * \brief Size of the signature of the tabulated model (kind, gamma, gas constant,
+   *        critical pressure and temperature, acentric factor).
+   */
+  enum : unsigned short { N_SIGNATURE = 6 };
+
+  /*!
+   * \brief Look-up table, shared (read-only) by the fluid models of all threads and grid levels.
+   */
+  struct Table {
+    unsigned long nDensity = 0;   /*!< \brief Number of nodes in the density direction. */
+    unsigned long nEnergy = 0;    /*!< \brief Number of nodes in the energy direction. */
+    passivedouble signature[N_SIGNATURE] = {}; /*!< \brief Kind and parameters of the tabulated model. */
+    passivedouble limits[4] = {}; /*!< \brief Minimum and maximum density and energy. */
+    passivedouble invDelta[2] = {}; /*!< \brief Inverse of the density and energy spacing. */
+    vector<passivedouble> data;   /*!< \brief Properties of node (i,j) start at (i*nEnergy+j)*N_PROPERTIES. */
+  };
+
+  /*!
+   * \brief Build (or load) the table for a fluid model.
+   * \note The table is read from FLUID_TABLE_FILENAME if its size, limits, and model signature (kind and
+   *       parameters of the fluid model) match the ones requested in the config, otherwise it is built (in
+   *       parallel over the MPI ranks) and written to that file. The limits are relative to the reference
+   *       state. A matching table built or read previously (e.g. for the finest grid) is reused.
+   * \param[in] model - Fluid model to tabulate, its state is modified.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] pressureRef - Reference (free-stream) pressure.
+   * \param[in] densityRef - Reference (free-stream) density.
+   * \return Shared pointer to the table.
+   */
+  static shared_ptr<const Table> MakeTable(CFluidModel& model, const CConfig& config,
+                                           su2double pressureRef, su2double densityRef);
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] model - Original fluid model (ownership is taken).
+   * \param[in] table - Table built from the original model with MakeTable.
+   */
+  CTabulatedGas(CFluidModel* model, shared_ptr<const Table> table);
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy.
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe(su2double rho, su2double e) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature (original model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT(su2double P, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density (original model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless Internal Energy using Pressure and Density (original model).
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy (original model).
+   * \param[in] h - first thermodynamic variable (h).
+   * \param[in] s - second thermodynamic variable (s).
+   */
+  void SetTDState_hs(su2double h, su2double s) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature (original model).
+   * \param[in] rho - first thermodynamic variable (rho).
+   * \param[in] T - second thermodynamic variable (T).
+   */
+  void SetTDState_rhoT(su2double rho, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy (original model).
+   * \param[in] P - first thermodynamic variable (P).
+   * \param[in] s - second thermodynamic variable (s).
+   */
+  void SetTDState_Ps(su2double P, su2double s) override;
+
+  /*!
+   * \brief Compute some derivatives of enthalpy and entropy needed for subsonic inflow BC (original model).
+   * \param[in] P - first thermodynamic variable (P).
+   * \param[in] rho - second thermodynamic variable (rho).
+   */
+  void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Compute the state of a batch of points using density and internal energy.
+   * \param[in,out] batch - See CFluidModel::ComputeStates_rhoe.
+   */
+  void ComputeStates_rhoe(StateBatch& batch) override;
+
+ private:
+  unique_ptr<CFluidModel> Model;  /*!< \brief Original fluid model. */
+  shared_ptr<const Table> LUT;    /*!< \brief Look-up table. */
+
+  /*!
+   * \brief Interpolate the properties at (rho, e).
+   * \param[out] props - Interpolated properties.
+   * \return False if (rho, e) is outside the table or next to invalid states of the original model.
+   */
+  bool Interpolate(su2double rho, su2double e, su2double* props) const;
+
+  /*!
+   * \brief Copy the state of the original model.
+   */
+  void CopyModelState();
+};
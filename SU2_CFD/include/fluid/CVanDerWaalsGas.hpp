@@ -60,6 +60,17 @@ class CVanDerWaalsGas final : public CIdealGas {
    */
   void SetTDState_PT(su2double P, su2double T) override;
 
+  /*!
+   * \brief Compute the state of a batch of points using density and internal energy, vectorized.
+   * \param[in,out] batch - See CFluidModel::ComputeStates_rhoe.
+   */
+  void ComputeStates_rhoe(StateBatch& batch) override;
+
+  /*!
+   * \brief The (P, T) batched interface uses the scalar (iterative) function.
+   */
+  void ComputeStates_PT(StateBatch& batch) override { CFluidModel::ComputeStates_PT(batch); }
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Density
    * \param[in] P - first thermodynamic variable.
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
 
 using namespace std;
 
@@ -67,4 +68,19 @@ class CViscosityModel {
    * \brief Set Viscosity Derivatives.
    */
   virtual void SetDerViscosity(su2double t, su2double rho) = 0;
+
+  /*!
+   * \brief Compute the viscosity and its derivatives for "n" points (see CFluidModel::StateBatch).
+   * \note The default implementation loops over the scalar functions, "n" is a multiple of the SIMD length.
+   */
+  virtual void ComputeViscosity(size_t n, const su2double* t, const su2double* rho, su2double* mu,
+                                su2double* dmudrho_t, su2double* dmudt_rho) {
+    for (size_t i = 0; i < n; ++i) {
+      SetViscosity(t[i], rho[i]);
+      mu[i] = GetViscosity();
+      SetDerViscosity(t[i], rho[i]);
+      dmudrho_t[i] = Getdmudrho_T();
+      dmudt_rho[i] = GetdmudT_rho();
+    }
+  }
 };
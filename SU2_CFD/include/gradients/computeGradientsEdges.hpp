@@ -0,0 +1,401 @@
+/*!
+ * \file computeGradientsEdges.hpp
+ * \brief Vectorized edge-based gradient computation (Green-Gauss and Least-Squares).
+ * \note This file must be included after computeGradientsLeastSquares.hpp.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../numerics_simd/util.hpp"
+
+namespace detail {
+
+/*!
+ * \brief Loop over the edges of a grid coloring in batches of Double::Size edges, the
+ *        edges of a color do not share points, so each thread can update both points
+ *        of its edges (see CFVMFlowSolverBase::EdgeFluxResidual).
+ * \param[in] edgeColoring - Coloring of the edges, with group sizes multiple of Double::Size.
+ * \param[in] edgeKernel - Function of the edge indices and the mask of valid lanes.
+ */
+template<class ColoringType, class EdgeKernel>
+FORCEINLINE void edgeColorLoop(const ColoringType& edgeColoring, const EdgeKernel& edgeKernel)
+{
+#ifdef HAVE_OMP
+  /*--- Minimum chunk size for the edge loops, see CFVMFlowSolverBase. ---*/
+  constexpr size_t OMP_MIN_SIZE = 32;
+#endif
+
+  for (const auto& color : edgeColoring) {
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k+j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k+j*in];
+      }
+      edgeKernel(iEdge, mask);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+/*!
+ * \brief Green-Gauss gradient computed by visiting each edge once, the "fluxes"
+ *        of the edges are vectorized and scattered to the two points of each edge.
+ * \note See computeGradientsGreenGauss for the parameters, the result is the same.
+ * \param[in] edgeColoring - Coloring of the edges, with group sizes multiple of Double::Size.
+ */
+template<size_t nDim, class ColoringType, class FieldType, class GradientType>
+void computeGradientsGreenGaussEdges(CSolver* solver,
+                                     MPI_QUANTITIES kindMpiComm,
+                                     PERIODIC_QUANTITIES kindPeriodicComm,
+                                     CGeometry& geometry,
+                                     const CConfig& config,
+                                     const ColoringType& edgeColoring,
+                                     const FieldType& field,
+                                     size_t varBegin,
+                                     size_t varEnd,
+                                     GradientType& gradient)
+{
+  const size_t nPoint = geometry.GetnPoint();
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const auto nodes = geometry.nodes;
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- Clear the gradient, halos included as they may be updated by the edge loop. ---*/
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPoint; ++iPoint)
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = 0.0;
+  END_SU2_OMP_FOR
+
+  /*--- Each point of a color is read and updated by one thread. ---*/
+
+  AD::StartNoSharedReading();
+
+  edgeColorLoop(edgeColoring, [&](Int iEdge, Double mask) {
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+      Double fieldSum;
+      for (size_t k = 0; k < Double::Size; ++k)
+        fieldSum[k] = field(iPoint[k],iVar) + field(jPoint[k],iVar);
+
+      const Double halfSum = 0.5 * fieldSum;
+
+      VectorDbl<nDim> flux;
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        flux(iDim) = halfSum * normal(iDim);
+
+      /*--- Scatter, the edge normal points out of iPoint. ---*/
+
+      for (size_t k = 0; k < Double::Size; ++k) {
+        if (mask[k] == 0.0) continue;
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          gradient(iPoint[k], iVar, iDim) += flux(iDim)[k];
+          gradient(jPoint[k], iVar, iDim) -= flux(iDim)[k];
+        }
+      }
+    }
+  });
+
+  AD::EndNoSharedReading();
+
+  /*--- Boundary fluxes and division by the volume, on the points of the domain. ---*/
+
+  for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+  {
+    if ((config.GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+        (config.GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY) &&
+        (config.GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY))
+    {
+      /*--- Work is shared in inner loop as two markers
+       *    may try to update the same point. ---*/
+
+      SU2_OMP_FOR_STAT(32)
+      for (size_t iVertex = 0; iVertex < geometry.GetnVertex(iMarker); ++iVertex)
+      {
+        size_t iPoint = geometry.vertex[iMarker][iVertex]->GetNode();
+
+        if (!nodes->GetDomain(iPoint)) continue;
+
+        const auto area = geometry.vertex[iMarker][iVertex]->GetNormal();
+
+        for (size_t iVar = varBegin; iVar < varEnd; iVar++)
+          for (size_t iDim = 0; iDim < nDim; iDim++)
+            gradient(iPoint, iVar, iDim) -= field(iPoint,iVar) * area[iDim];
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const su2double invVol = 1.0 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) *= invVol;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- If no solver was provided we do not communicate ---*/
+
+  if (solver == nullptr) return;
+
+  /*--- Account for periodic contributions. ---*/
+
+  for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+  {
+    solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+  }
+
+  /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+
+  solver->InitiateComms(&geometry, &config, kindMpiComm);
+  solver->CompleteComms(&geometry, &config, kindMpiComm);
+
+}
+
+/*!
+ * \brief Least-Squares gradient computed by visiting each edge once, the contributions
+ *        to the matrix and right-hand-side of the two points of an edge are the same.
+ * \note See computeGradientsLeastSquares for the parameters, the result is the same.
+ * \param[in] edgeColoring - Coloring of the edges, with group sizes multiple of Double::Size.
+ */
+template<size_t nDim, class ColoringType, class FieldType, class GradientType, class RMatrixType>
+void computeGradientsLeastSquaresEdges(CSolver* solver,
+                                       MPI_QUANTITIES kindMpiComm,
+                                       PERIODIC_QUANTITIES kindPeriodicComm,
+                                       CGeometry& geometry,
+                                       const CConfig& config,
+                                       const ColoringType& edgeColoring,
+                                       bool weighted,
+                                       const FieldType& field,
+                                       size_t varBegin,
+                                       size_t varEnd,
+                                       GradientType& gradient,
+                                       RMatrixType& Rmatrix)
+{
+  const size_t nPoint = geometry.GetnPoint();
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  /*--- Clear gradient and Rmatrix, halos included as they may be updated by the edge loop. ---*/
+
+  SU2_OMP_FOR_STAT(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPoint; ++iPoint)
+  {
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = 0.0;
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = 0; jDim < nDim; ++jDim)
+        Rmatrix(iPoint, iDim, jDim) = 0.0;
+  }
+  END_SU2_OMP_FOR
+
+  AD::StartNoSharedReading();
+
+  edgeColorLoop(edgeColoring, [&](Int iEdge, Double mask) {
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+    const auto dist_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    /*--- Inverse weight, default 1 (unweighted), edges of zero length do not contribute. ---*/
+
+    Double weight = 1.0;
+    if (weighted) weight = squaredNorm(dist_ij);
+    const Double valid = weight > 0.0;
+    weight = valid / (weight + (1.0 - valid));
+
+    /*--- Upper triangular part of R, and 2,1 for the 3D decomposition. ---*/
+
+    MatrixDbl<nDim> R_ij;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = iDim; jDim < nDim; ++jDim)
+        R_ij(iDim,jDim) = dist_ij(iDim) * dist_ij(jDim) * weight;
+    const Double R_21 = R_ij(0,nDim-1);
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      if (mask[k] == 0.0) continue;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        for (size_t jDim = iDim; jDim < nDim; ++jDim) {
+          Rmatrix(iPoint[k],iDim,jDim) += R_ij(iDim,jDim)[k];
+          Rmatrix(jPoint[k],iDim,jDim) += R_ij(iDim,jDim)[k];
+        }
+      }
+      if (nDim == 3) {
+        Rmatrix(iPoint[k],2,1) += R_21[k];
+        Rmatrix(jPoint[k],2,1) += R_21[k];
+      }
+    }
+
+    /*--- Entries of c:= transpose(A)*b, the two points get the same contribution
+     *    as both the distance vector and the delta change sign. ---*/
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+      Double delta;
+      for (size_t k = 0; k < Double::Size; ++k)
+        delta[k] = field(jPoint[k],iVar) - field(iPoint[k],iVar);
+
+      const Double delta_ij = weight * delta;
+
+      VectorDbl<nDim> c_ij;
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        c_ij(iDim) = dist_ij(iDim) * delta_ij;
+
+      for (size_t k = 0; k < Double::Size; ++k) {
+        if (mask[k] == 0.0) continue;
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          gradient(iPoint[k], iVar, iDim) += c_ij(iDim)[k];
+          gradient(jPoint[k], iVar, iDim) += c_ij(iDim)[k];
+        }
+      }
+    }
+  });
+
+  AD::EndNoSharedReading();
+
+  /*--- Correct the gradient values across any periodic boundaries. ---*/
+
+  if ((solver != nullptr) && (config.GetnMarker_Periodic() > 0))
+  {
+    for (size_t iPeriodic = 1; iPeriodic <= config.GetnMarker_Periodic()/2; ++iPeriodic)
+    {
+      solver->InitiatePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+      solver->CompletePeriodicComms(&geometry, &config, iPeriodic, kindPeriodicComm);
+    }
+  }
+
+  /*--- Solve the LS problem of each point, the "periodic" version
+   *    preaccumulates on its own (the inputs were accumulated). ---*/
+
+#ifdef HAVE_OMP
+  const auto chunkSizeDomain = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+  SU2_OMP_FOR_DYN(chunkSizeDomain)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+    solveLeastSquares<nDim, true>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+  END_SU2_OMP_FOR
+
+  /*--- If no solver was provided we do not communicate ---*/
+
+  if (solver != nullptr)
+  {
+    /*--- Obtain the gradients at halo points from the MPI ranks that own them. ---*/
+
+    solver->InitiateComms(&geometry, &config, kindMpiComm);
+    solver->CompleteComms(&geometry, &config, kindMpiComm);
+  }
+
+}
+} // end namespace
+
+/*!
+ * \brief Instantiations for 2D and 3D.
+ */
+template<class ColoringType, class FieldType, class GradientType>
+void computeGradientsGreenGaussEdges(CSolver* solver,
+                                     MPI_QUANTITIES kindMpiComm,
+                                     PERIODIC_QUANTITIES kindPeriodicComm,
+                                     CGeometry& geometry,
+                                     const CConfig& config,
+                                     const ColoringType& edgeColoring,
+                                     const FieldType& field,
+                                     size_t varBegin,
+                                     size_t varEnd,
+                                     GradientType& gradient) {
+  passivedouble tapeMemory = 0.0;
+  config.TapeTick(&tapeMemory);
+  switch (geometry.GetnDim()) {
+  case 2:
+    detail::computeGradientsGreenGaussEdges<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                               edgeColoring, field, varBegin, varEnd, gradient);
+    break;
+  case 3:
+    detail::computeGradientsGreenGaussEdges<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                               edgeColoring, field, varBegin, varEnd, gradient);
+    break;
+  default:
+    SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+    break;
+  }
+  config.TapeTock(tapeMemory, solver ? solver->GetSolverName().c_str() : "GRID", TAPE_REGION::GRADIENT);
+}
+
+/*!
+ * \brief Instantiations for 2D and 3D.
+ */
+template<class ColoringType, class FieldType, class GradientType, class RMatrixType>
+void computeGradientsLeastSquaresEdges(CSolver* solver,
+                                       MPI_QUANTITIES kindMpiComm,
+                                       PERIODIC_QUANTITIES kindPeriodicComm,
+                                       CGeometry& geometry,
+                                       const CConfig& config,
+                                       const ColoringType& edgeColoring,
+                                       bool weighted,
+                                       const FieldType& field,
+                                       size_t varBegin,
+                                       size_t varEnd,
+                                       GradientType& gradient,
+                                       RMatrixType& Rmatrix) {
+  passivedouble tapeMemory = 0.0;
+  config.TapeTick(&tapeMemory);
+  switch (geometry.GetnDim()) {
+  case 2:
+    detail::computeGradientsLeastSquaresEdges<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                                 edgeColoring, weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    break;
+  case 3:
+    detail::computeGradientsLeastSquaresEdges<3>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
+                                                 edgeColoring, weighted, field, varBegin, varEnd, gradient, Rmatrix);
+    break;
+  default:
+    SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+    break;
+  }
+  config.TapeTock(tapeMemory, solver ? solver->GetSolverName().c_str() : "GRID", TAPE_REGION::GRADIENT);
+}
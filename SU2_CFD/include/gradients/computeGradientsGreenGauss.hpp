@@ -51,6 +51,7 @@ namespace detail {
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
  */
 template<size_t nDim, class FieldType, class GradientType>
+SU2_MULTIVERSION
 void computeGradientsGreenGauss(CSolver* solver,
                                 MPI_QUANTITIES kindMpiComm,
                                 PERIODIC_QUANTITIES kindPeriodicComm,
@@ -200,6 +201,8 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 size_t varBegin,
                                 size_t varEnd,
                                 GradientType& gradient) {
+  passivedouble tapeMemory = 0.0;
+  config.TapeTick(&tapeMemory);
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
@@ -213,4 +216,5 @@ void computeGradientsGreenGauss(CSolver* solver,
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
     break;
   }
+  config.TapeTock(tapeMemory, solver ? solver->GetSolverName().c_str() : "GRID", TAPE_REGION::GRADIENT);
 }
@@ -172,6 +172,7 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
  */
 template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
+SU2_MULTIVERSION
 void computeGradientsLeastSquares(CSolver* solver,
                                   MPI_QUANTITIES kindMpiComm,
                                   PERIODIC_QUANTITIES kindPeriodicComm,
@@ -333,6 +334,8 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varEnd,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+  passivedouble tapeMemory = 0.0;
+  config.TapeTick(&tapeMemory);
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
@@ -346,4 +349,5 @@ void computeGradientsLeastSquares(CSolver* solver,
     SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
     break;
   }
+  config.TapeTock(tapeMemory, solver ? solver->GetSolverName().c_str() : "GRID", TAPE_REGION::GRADIENT);
 }
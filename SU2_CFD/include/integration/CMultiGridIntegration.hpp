@@ -69,15 +69,46 @@ private:
                        unsigned short iMesh, unsigned short mu, unsigned short RunTime_EqSystem,
                        unsigned short iZone, unsigned short iInst);
 
+  /*!
+   * \brief Set the numerical methods of a system of equations (called by all threads).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   * \param[in] residualOnly - Only the residual is needed, implicit integration is disabled.
+   */
+  void SetEqSystem_Param(CConfig *config, unsigned short RunTime_EqSystem, bool residualOnly);
+
+  /*!
+   * \brief Smoothing iteration of the turbulence equations, when they are part of the multigrid cycle of the flow.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions on level iMesh.
+   * \param[in] numerics_container - Description of the numerical method on level iMesh.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void Turbulence_Smoothing(CGeometry *geometry, CSolver **solver_container, CNumerics ***numerics_container,
+                            CConfig *config, unsigned short iMesh);
+
+  /*!
+   * \brief Compute the residual of the turbulence equations, when they are part of the multigrid cycle of the flow.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions on level iMesh.
+   * \param[in] numerics_container - Description of the numerical method on level iMesh.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void Turbulence_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics ***numerics_container,
+                           CConfig *config, unsigned short iMesh);
+
   /*!
    * \brief Compute the forcing term.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
    * \param[in] sol_coarse - Pointer to the solution on the coarse grid.
    * \param[in] geo_fine - Geometrical definition of the fine grid.
    * \param[in] geo_coarse - Geometrical definition of the coarse grid.
    * \param[in] config - Definition of the particular problem.
    */
-  void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+  void SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                        CGeometry *geo_coarse, CConfig *config, unsigned short iMesh);
 
   /*!
@@ -95,6 +126,15 @@ private:
    */
   void SetProlongated_Correction(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config, unsigned short iMesh);
 
+  /*!
+   * \brief Set the value of the corrected fine grid turbulence solution, limiting the
+   *        correction such that the turbulence variables remain positive.
+   * \param[out] sol_fine - Pointer to the solution on the fine grid.
+   * \param[in] geo_fine - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetProlongated_TurbCorrection(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config);
+
   /*!
    * \brief Compute the gradient in coarse grid using the fine grid information.
    * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
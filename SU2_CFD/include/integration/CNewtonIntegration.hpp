@@ -88,6 +88,24 @@ private:
   unsigned short tolRelaxFactor = 0;
   su2double fullTolResidual = 0.0;
 
+  /*--- Eisenstat-Walker (choice 2) forcing terms for the NK solves, eta = gamma*(|F_k|/|F_k-1|)^alpha,
+   * safeguarded and limited to [LINEAR_SOLVER_ERROR, forcingMax]. Inactive if forcingMax is 0. ---*/
+  su2double forcingMax = 0.0, forcingGamma = 0.9, forcingAlpha = 2.0;
+  Scalar forcingTerm = 0.0;
+
+  /*--- Backtracking line search for the NK steps, with sufficient decrease
+   * |F(x+l*dx)| <= (1-t*l*(1-eta))|F(x)|, inactive if lineSearchIters is 0. ---*/
+  unsigned short lineSearchIters = 0;
+  bool lineSearchFailed = false;
+
+  /*--- Switch from quasi-Newton to NK steps when the (averaged) nonlinear contraction
+   * of the former is worse than switchContraction, and back to quasi-Newton steps when
+   * NK steps stop reducing the residual. Inactive if switchContraction is 0. ---*/
+  su2double switchContraction = 0.0;
+  unsigned short fallbackIters = 0, nContraction = 0;
+  Scalar prevResNorm = 0.0, logContraction = 0.0;
+  bool lastStepNK = false;
+
   CConfig* config = nullptr;
   CSolver** solvers = nullptr;
   CGeometry* geometry = nullptr;
@@ -179,6 +197,27 @@ private:
    */
   void ComputeFinDiffStep();
 
+  /*!
+   * \brief Scale the current solution update, x := x_old+factor*(x-x_old).
+   */
+  void ScaleSolutionUpdate(Scalar factor);
+
+  /*!
+   * \brief Update the Eisenstat-Walker forcing term based on the nonlinear contraction.
+   * \param[in] contraction - Ratio between the current and previous residual norms.
+   * \return Relative tolerance for the NK solve.
+   */
+  Scalar ForcingTerm(Scalar contraction);
+
+  /*!
+   * \brief Backtrack the (already applied) solution update until the residual decreases sufficiently.
+   * \param[in] resNorm - Norm of the residual before the update.
+   * \param[in] eta - Relative tolerance of the linear solve that produced the update.
+   * \param[out] lambda - Length of the accepted step relative to the full update.
+   * \return False if the maximum number of backtracking steps was reached.
+   */
+  bool LineSearch(Scalar resNorm, Scalar eta, Scalar& lambda);
+
 public:
   /*!
    * \brief Constructor.
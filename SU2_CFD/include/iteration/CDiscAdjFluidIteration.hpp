@@ -40,6 +40,7 @@ class CFluidIteration;
 class CDiscAdjFluidIteration final : public CIteration {
  private:
   const bool turbulent;                      /*!< \brief Stores the turbulent flag. */
+  CPrimalCheckpoints* checkpoints = nullptr; /*!< \brief Recomputes the primal states instead of loading restarts. */
 
   /*!
    * \brief load unsteady solution for unsteady problems
@@ -178,4 +179,10 @@ class CDiscAdjFluidIteration final : public CIteration {
   void SetDependencies(CSolver***** solver, CGeometry**** geometry, CNumerics****** numerics, CConfig** config,
                        unsigned short iZone, unsigned short iInst, RECORDING kind_recording) override;
 
+  /*!
+   * \brief Set the source of the primal states of unsteady adjoints (restart files if not set).
+   * \param[in] val_checkpoints - Primal checkpoints.
+   */
+  void SetPrimalCheckpoints(CPrimalCheckpoints* val_checkpoints) override { checkpoints = val_checkpoints; }
+
 };
@@ -151,6 +151,36 @@ class CFluidIteration : public CIteration {
    */
   bool MonitorFixed_CL(COutput* output, CGeometry* geometry, CSolver** solver, CConfig* config);
 
+  /*!
+   * \brief Order of the extrapolation from the previous time levels that is possible at the current time step,
+   *        i.e. the requested order limited by the number of time levels computed (or restarted from) so far.
+   * \param[in] config - Definition of the particular problem.
+   * \return Order of the extrapolation, 0 if not requested or not possible.
+   */
+  unsigned short GetTimeExtrapolationOrder(const CConfig* config) const;
+
+  /*!
+   * \brief Variables of a solver that must remain positive (e.g. density, energy, turbulence variables),
+   *        the extrapolation from the previous time levels is only checked for these.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iSol - Position of the solver (FLOW_SOL, TURB_SOL, etc.).
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] nVar - Number of variables of the solver.
+   * \return Indices of the variables.
+   */
+  vector<unsigned short> GetPositiveVariables(const CConfig* config, unsigned short iSol, unsigned short nDim,
+                                              unsigned short nVar) const;
+
+  /*!
+   * \brief Check if the inner residuals of the flow (and turbulence) equations are small compared to the
+   *        temporal truncation error of the dual time step, in which case there is no point iterating further.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return Boolean indicating whether the inner iterations should stop.
+   */
+  bool MonitorTruncationError(const CGeometry* geometry, CSolver** solver, const CConfig* config) const;
+
   /*!
    * \brief Store old aeroelastic solutions
    * \param[in,out] config - Definition of the particular problem.
@@ -39,6 +39,7 @@
 using namespace std;
 
 class COutput;
+class CPrimalCheckpoints;
 
 /*!
  * \class CIteration
@@ -291,4 +292,10 @@ class CIteration {
 
   virtual void RegisterOutput(CSolver***** solver, CGeometry**** geometry, CConfig** config,
                               unsigned short iZone, unsigned short iInst) {}
+
+  /*!
+   * \brief Set the source of the primal states of unsteady adjoints (restart files if not set).
+   * \param[in] checkpoints - Primal checkpoints.
+   */
+  virtual void SetPrimalCheckpoints(CPrimalCheckpoints* checkpoints) {}
 };
@@ -0,0 +1,122 @@
+/*!
+ * \file CPrimalCheckpoints.hpp
+ * \brief Headers of the in-memory checkpointing of primal states for the unsteady discrete adjoint.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <vector>
+
+#include "../../../Common/include/CConfig.hpp"
+
+class CGeometry;
+class CSolver;
+
+/*!
+ * \class CPrimalCheckpoints
+ * \brief Provides the primal states of a dual time stepping problem to the unsteady discrete adjoint
+ *        without reading one restart file per time step.
+ * \details A budgeted number of checkpoints (the two time levels needed to restart the time integration)
+ *          is kept in memory, the time steps in between are recomputed by the direct iteration. The reverse
+ *          sweep requests the states in decreasing order, checkpoints are placed with the binomial rule of
+ *          Griewank's "revolve", which minimizes the number of recomputed steps for the given budget.
+ *          The converged state of the first time step is read from its restart file (the only file that
+ *          is read), the time level before it is the free-stream, which is the state the adjoint assumes
+ *          before the first time step.
+ */
+class CPrimalCheckpoints {
+public:
+  using StepFunction = std::function<void(long)>;  /*!< \brief Converges one time step of the direct problem. */
+
+private:
+  using Snapshot = std::vector<passivedouble>;
+
+  const unsigned short nMesh;       /*!< \brief Number of multigrid levels (the states are stored on all of them). */
+  const unsigned long nCheckpoints; /*!< \brief Budget of checkpoints, the first time step is not counted. */
+  CConfig* config;                  /*!< \brief Definition of the problem. */
+  CGeometry** geometry;             /*!< \brief Geometry of each multigrid level. */
+  CSolver*** solver;                /*!< \brief Solvers of each multigrid level. */
+  StepFunction computeStep;         /*!< \brief Recomputes a time step from the states at time n and n-1. */
+
+  std::map<long, Snapshot> checkpoints; /*!< \brief Time levels n and n-1 after converging the time step (key). */
+  Snapshot scratch;                     /*!< \brief Adjoint-side states preserved during recomputations. */
+  unsigned long nRecomputed = 0;        /*!< \brief Statistics, total number of recomputed time steps. */
+
+  /*!
+   * \brief Apply a function to the solvers that carry primal states (flow, turbulence, heat) on all levels.
+   */
+  template<class F>
+  void ForEachSolver(F&& func) const;
+
+  /*!
+   * \brief Copy the time levels n and n-1 of all solvers into a snapshot.
+   */
+  void Store(Snapshot& snap) const;
+
+  /*!
+   * \brief Set the solution and/or the time levels n and n-1 of all solvers from a snapshot.
+   * \param[in] snap - Snapshot, the solution is set to its time level n.
+   * \param[in] solution - Set the solution.
+   * \param[in] timeLevels - Set the time levels.
+   */
+  void Restore(const Snapshot& snap, bool solution, bool timeLevels);
+
+  /*!
+   * \brief Store the first time step, read from its restart file, with the free-stream as time level n-1.
+   */
+  void StoreFirstStep();
+
+public:
+  /*!
+   * \brief Binomial placement of the next checkpoint.
+   * \param[in] nSteps - Number of time steps between the last checkpoint and the requested state.
+   * \param[in] nFree - Number of free checkpoints.
+   * \return Offset from the last checkpoint, 0 if no checkpoint should be placed.
+   */
+  static unsigned long CheckpointOffset(unsigned long nSteps, unsigned long nFree);
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] config - Definition of the problem.
+   * \param[in] geometry - Geometry of each multigrid level.
+   * \param[in] solver - Solvers of each multigrid level.
+   * \param[in] step - Function that converges one time step of the direct problem.
+   */
+  CPrimalCheckpoints(CConfig* config, CGeometry** geometry, CSolver*** solver, StepFunction step);
+
+  /*!
+   * \brief Set the solution of all solvers to the converged state of a direct time step.
+   * \note The time levels n and n-1 of the solvers are not modified.
+   * \param[in] iTimeIter - Direct time step, >= 0.
+   */
+  void Load(long iTimeIter);
+
+  /*!
+   * \brief Total number of time steps recomputed so far.
+   */
+  inline unsigned long GetnRecomputed() const { return nRecomputed; }
+
+};
@@ -0,0 +1,391 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Fused computation of gradients and limiters.
+ * \note This file must be included after computeGradientsLeastSquares.hpp
+ *       and computeLimiters.hpp, whose building blocks it uses.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+namespace detail {
+
+/*!
+ * \brief Compute the gradient (Green-Gauss or Least-Squares) and the limiter of a field
+ *        in a single loop over points, see computeGradientsGreenGauss,
+ *        computeGradientsLeastSquares, and computeLimiters_impl.
+ * \note The min/max values over the direct neighbors are gathered while the gradient is
+ *       integrated, and the limiter of each point is computed as soon as its gradient is
+ *       complete (boundary contributions included). The field and the neighbor information
+ *       of a point are therefore read once for both operations, instead of in separate passes.
+ * \note Periodic boundaries are not supported since their corrections to gradients and limiters
+ *       require communication between the two operations (use the separate functions instead).
+ *
+ * Arguments:
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiCommGrad - Type of MPI communication required for the gradient.
+ * \param[in] kindMpiCommLim - Type of MPI communication required for the limiter.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+ * \param[in] varBegin - First variable index for which to compute gradients and limiters.
+ * \param[in] varEnd - End of computation range (nVar = end-begin).
+ * \param[in] field - Variable field.
+ * \param[out] gradient - Gradient of the field.
+ * \param[out] Rmatrix - Least-Squares matrix (not used by Green-Gauss).
+ * \param[out] limiter - Reconstruction limiter for the field.
+ *
+ * Template parameters:
+ * \param nDim - Number of dimensions.
+ * \param LimiterKind - Used to instantiate the right details class.
+ * \param FieldType - Generic object with operator (iPoint,iVar).
+ * \param GradientType - Generic object with operator (iPoint,iVar,iDim).
+ * \param RMatrixType - Generic object with operator (iPoint,iDim,iDim).
+ */
+template<size_t nDim, ENUM_LIMITER LimiterKind, class FieldType, class GradientType, class RMatrixType>
+SU2_MULTIVERSION
+void computeGradientsAndLimiters(CSolver* solver,
+                                 MPI_QUANTITIES kindMpiCommGrad,
+                                 MPI_QUANTITIES kindMpiCommLim,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 ENUM_FLOW_GRADIENT kindGradient,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 RMatrixType& Rmatrix,
+                                 FieldType& limiter)
+{
+  constexpr size_t MAXNVAR = 32;
+
+  if (varEnd > MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  const bool greenGauss = (kindGradient == GREEN_GAUSS);
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+
+#ifdef HAVE_OMP
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+#endif
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    auto nodes = geometry.nodes;
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    /*--- Gradient and min/max values, this is one preaccumulation region
+     *    (cannot preaccumulate if hybrid parallel due to shared reading). ---*/
+
+    if (omp_get_num_threads() == 1) AD::StartPreacc();
+
+    su2double valMax[MAXNVAR], valMin[MAXNVAR];
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      AD::SetPreaccIn(field(iPoint,iVar));
+
+      valMax[iVar] = valMin[iVar] = field(iPoint,iVar);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = 0.0;
+    }
+
+    su2double halfOnVol = 0.0;
+
+    if (greenGauss) {
+      AD::SetPreaccIn(nodes->GetVolume(iPoint));
+      AD::SetPreaccIn(nodes->GetPeriodicVolume(iPoint));
+      halfOnVol = 0.5 / (nodes->GetVolume(iPoint)+nodes->GetPeriodicVolume(iPoint));
+    }
+    else {
+      AD::SetPreaccIn(coord_i, nDim);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          Rmatrix(iPoint, iDim, jDim) = 0.0;
+    }
+
+    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+    {
+      const size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        AD::SetPreaccIn(field(jPoint,iVar));
+
+        valMax[iVar] = max(valMax[iVar], field(jPoint,iVar));
+        valMin[iVar] = min(valMin[iVar], field(jPoint,iVar));
+      }
+
+      if (greenGauss) {
+        /*--- Flip the area vector if the edge points inwards. ---*/
+
+        const su2double weight = (iPoint < jPoint)? halfOnVol : -halfOnVol;
+
+        const auto area = geometry.edges->GetNormal(nodes->GetEdge(iPoint,iNeigh));
+        AD::SetPreaccIn(area, nDim);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          su2double flux = weight * (field(iPoint,iVar) + field(jPoint,iVar));
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            gradient(iPoint, iVar, iDim) += flux * area[iDim];
+        }
+      }
+      else {
+        const auto coord_j = nodes->GetCoord(jPoint);
+        AD::SetPreaccIn(coord_j, nDim);
+
+        su2double dist_ij[nDim] = {0.0};
+        GeometryToolbox::Distance(nDim, coord_j, coord_i, dist_ij);
+
+        su2double weight = 1.0;
+        if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+        if (weight > 0.0)
+        {
+          weight = 1.0 / weight;
+
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            for (size_t jDim = iDim; jDim < nDim; ++jDim)
+              Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+          if (nDim == 3)
+            Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            su2double delta_ij = weight * (field(jPoint,iVar) - field(iPoint,iVar));
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              gradient(iPoint, iVar, iDim) += dist_ij[iDim] * delta_ij;
+          }
+        }
+      }
+    }
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      AD::SetPreaccOut(valMax[iVar]);
+      AD::SetPreaccOut(valMin[iVar]);
+    }
+
+    if (greenGauss)
+    {
+      /*--- Boundary fluxes of this point, instead of a loop over markers after the points. ---*/
+
+      if (nodes->GetBoundary(iPoint))
+      {
+        const su2double volume = nodes->GetVolume(iPoint) + nodes->GetPeriodicVolume(iPoint);
+
+        for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+        {
+          const auto iVertex = nodes->GetVertex(iPoint, iMarker);
+
+          if ((iVertex < 0) ||
+              (config.GetMarker_All_KindBC(iMarker) == INTERNAL_BOUNDARY) ||
+              (config.GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) ||
+              (config.GetMarker_All_KindBC(iMarker) == PERIODIC_BOUNDARY)) continue;
+
+          const auto area = geometry.vertex[iMarker][iVertex]->GetNormal();
+          AD::SetPreaccIn(area, nDim);
+
+          for (size_t iVar = varBegin; iVar < varEnd; iVar++)
+          {
+            su2double flux = field(iPoint,iVar) / volume;
+
+            for (size_t iDim = 0; iDim < nDim; iDim++)
+              gradient(iPoint, iVar, iDim) -= flux * area[iDim];
+          }
+        }
+      }
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          AD::SetPreaccOut(gradient(iPoint,iVar,iDim));
+
+      AD::EndPreacc();
+    }
+    else
+    {
+      /*--- Registers the gradient as output and ends the preaccumulation. ---*/
+
+      solveLeastSquares<nDim, false>(iPoint, varBegin, varEnd, Rmatrix, gradient);
+    }
+
+    /*--- The gradient of iPoint is complete, compute its limiter. ---*/
+
+    if (omp_get_num_threads() == 1) AD::StartPreacc();
+    AD::SetPreaccIn(coord_i, nDim);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      AD::SetPreaccIn(field(iPoint,iVar));
+      AD::SetPreaccIn(valMax[iVar]);
+      AD::SetPreaccIn(valMin[iVar]);
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        AD::SetPreaccIn(gradient(iPoint,iVar,iDim));
+    }
+
+    su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      projMax[iVar] = projMin[iVar] = 0.0;
+
+    for (auto jPoint : nodes->GetPoints(iPoint))
+    {
+      const auto coord_j = nodes->GetCoord(jPoint);
+      AD::SetPreaccIn(coord_j, nDim);
+
+      su2double dist_ij[nDim] = {0.0};
+
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double proj = 0.0;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          proj += dist_ij[iDim] * gradient(iPoint,iVar,iDim);
+
+        projMax[iVar] = max(projMax[iVar], proj);
+        projMin[iVar] = min(projMin[iVar], proj);
+      }
+    }
+
+    su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+    {
+      su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
+                         valMax[iVar] - field(iPoint,iVar));
+
+      su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
+                         valMin[iVar] - field(iPoint,iVar));
+
+      limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+
+      AD::SetPreaccOut(limiter(iPoint,iVar));
+    }
+
+    AD::EndPreacc();
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Obtain the gradients and limiters at halo points from the MPI ranks that own them.
+   *    If no solver was provided we do not communicate. ---*/
+
+  if (solver != nullptr)
+  {
+    solver->InitiateComms(&geometry, &config, kindMpiCommGrad);
+    solver->CompleteComms(&geometry, &config, kindMpiCommGrad);
+
+    solver->InitiateComms(&geometry, &config, kindMpiCommLim);
+    solver->CompleteComms(&geometry, &config, kindMpiCommLim);
+  }
+
+}
+} // end namespace
+
+/*!
+ * \brief Instantiations for 2D and 3D, and for the limiters based on
+ *        CLimiterDetails (see computeLimiters for the other types).
+ */
+template<class FieldType, class GradientType, class RMatrixType>
+void computeGradientsAndLimiters(ENUM_LIMITER LimiterKind,
+                                 CSolver* solver,
+                                 MPI_QUANTITIES kindMpiCommGrad,
+                                 MPI_QUANTITIES kindMpiCommLim,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 ENUM_FLOW_GRADIENT kindGradient,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 RMatrixType& Rmatrix,
+                                 FieldType& limiter)
+{
+  if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
+    SU2_MPI::Error("Too many dimensions to compute gradients and limiters.", CURRENT_FUNCTION);
+
+  passivedouble tapeMemory = 0.0;
+  config.TapeTick(&tapeMemory);
+
+  if (kindGradient != GREEN_GAUSS && kindGradient != LEAST_SQUARES && kindGradient != WEIGHTED_LEAST_SQUARES)
+    SU2_MPI::Error("Unknown gradient method.", CURRENT_FUNCTION);
+
+#define INSTANTIATE(KIND)\
+if (geometry.GetnDim() == 2) {\
+  detail::computeGradientsAndLimiters<2,KIND>(solver, kindMpiCommGrad, kindMpiCommLim, geometry, config, kindGradient,\
+                                              varBegin, varEnd, field, gradient, Rmatrix, limiter);\
+} else {\
+  detail::computeGradientsAndLimiters<3,KIND>(solver, kindMpiCommGrad, kindMpiCommLim, geometry, config, kindGradient,\
+                                              varBegin, varEnd, field, gradient, Rmatrix, limiter);\
+}
+  switch (LimiterKind) {
+    case BARTH_JESPERSEN:
+    {
+      INSTANTIATE(BARTH_JESPERSEN);
+      break;
+    }
+    case VENKATAKRISHNAN:
+    {
+      INSTANTIATE(VENKATAKRISHNAN);
+      break;
+    }
+    case VENKATAKRISHNAN_WANG:
+    {
+      INSTANTIATE(VENKATAKRISHNAN_WANG);
+      break;
+    }
+    case WALL_DISTANCE:
+    {
+      INSTANTIATE(WALL_DISTANCE);
+      break;
+    }
+    case SHARP_EDGES:
+    {
+      INSTANTIATE(SHARP_EDGES);
+      break;
+    }
+    default:
+    {
+      SU2_MPI::Error("Limiter type not supported by the fused computation.", CURRENT_FUNCTION);
+      break;
+    }
+  }
+#undef INSTANTIATE
+  config.TapeTock(tapeMemory, solver ? solver->GetSolverName().c_str() : "GRID", TAPE_REGION::GRADIENT);
+}
@@ -53,6 +53,9 @@ void computeLimiters(ENUM_LIMITER LimiterKind,
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
+  passivedouble tapeMemory = 0.0;
+  config.TapeTick(&tapeMemory);
+
 #define INSTANTIATE(KIND)\
 if (geometry.GetnDim() == 2) {\
   computeLimiters_impl<2,KIND>(solver, kindMpiComm, kindPeriodicComm1, kindPeriodicComm2, geometry,\
@@ -103,4 +106,5 @@ if (geometry.GetnDim() == 2) {\
     }
   }
 #undef INSTANTIATE
+  config.TapeTock(tapeMemory, solver ? solver->GetSolverName().c_str() : "GRID", TAPE_REGION::LIMITER);
 }
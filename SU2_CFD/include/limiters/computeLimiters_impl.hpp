@@ -50,7 +50,7 @@
  * \param[in] varEnd - End of computation range (nVar = end-begin).
  * \param[in] field - Variable field.
  * \param[in] gradient - Gradient of the field.
- * \param[out] fieldMin - Minimum field values over direct neighbors of each point.
+ * \param[out] fieldMin - Minimum field values over direct neighbors of each point (only used with periodicity).
  * \param[out] fieldMax - As above but maximum values.
  * \param[out] limiter - Reconstruction limiter for the field.
  *
@@ -83,8 +83,8 @@ void computeLimiters_impl(CSolver* solver,
   const size_t nPointDomain = geometry.GetnPointDomain();
   const size_t nPoint = geometry.GetnPoint();
 
-  /*--- If we do not have periodicity we can use a
-   *    more efficient access pattern to memory. ---*/
+  /*--- If we do not have periodicity we can use a more efficient access
+   *    pattern to memory, and min/max do not need to be stored. ---*/
 
   const bool periodic = (solver != nullptr) &&
                         (kindPeriodicComm1 != PERIODIC_NONE) &&
@@ -136,6 +136,8 @@ void computeLimiters_impl(CSolver* solver,
     if (omp_get_num_threads() == 1) AD::StartPreacc();
     AD::SetPreaccIn(coord_i, nDim);
 
+    su2double valMax[MAXNVAR], valMin[MAXNVAR];
+
     for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
     {
       AD::SetPreaccIn(field(iPoint,iVar));
@@ -144,11 +146,13 @@ void computeLimiters_impl(CSolver* solver,
         /*--- Started outside loop, so counts as input. ---*/
         AD::SetPreaccIn(fieldMax(iPoint,iVar));
         AD::SetPreaccIn(fieldMin(iPoint,iVar));
+        valMax[iVar] = fieldMax(iPoint,iVar);
+        valMin[iVar] = fieldMin(iPoint,iVar);
       }
       else {
         /*--- Initialize min/max now for iPoint if not periodic. ---*/
-        fieldMax(iPoint,iVar) = field(iPoint,iVar);
-        fieldMin(iPoint,iVar) = field(iPoint,iVar);
+        valMax[iVar] = field(iPoint,iVar);
+        valMin[iVar] = field(iPoint,iVar);
       }
 
       for(size_t iDim = 0; iDim < nDim; ++iDim)
@@ -190,8 +194,8 @@ void computeLimiters_impl(CSolver* solver,
 
         AD::SetPreaccIn(field(jPoint,iVar));
 
-        fieldMax(iPoint,iVar) = max(fieldMax(iPoint,iVar), field(jPoint,iVar));
-        fieldMin(iPoint,iVar) = min(fieldMin(iPoint,iVar), field(jPoint,iVar));
+        valMax[iVar] = max(valMax[iVar], field(jPoint,iVar));
+        valMin[iVar] = min(valMin[iVar], field(jPoint,iVar));
       }
     }
 
@@ -205,10 +209,10 @@ void computeLimiters_impl(CSolver* solver,
     for(size_t iVar = varBegin; iVar < varEnd; ++iVar)
     {
       su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar],
-                         fieldMax(iPoint,iVar) - field(iPoint,iVar));
+                         valMax[iVar] - field(iPoint,iVar));
 
       su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar],
-                         fieldMin(iPoint,iVar) - field(iPoint,iVar));
+                         valMin[iVar] - field(iPoint,iVar));
 
       limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
 
@@ -50,6 +50,7 @@ protected:
   su2double cb2;
   su2double cw1;
   su2double cr1;
+  su2double c5;  /*!< \brief Constant of the compressibility correction (SA_COMP, SA_E_COMP). */
 
   su2double Gamma_BC = 0.0;
   su2double intermittency;
@@ -168,7 +169,7 @@ private:
   su2double norm2_Grad;
   su2double dfv1, dfv2, dShat;
   su2double dr, dg, dfw;
-  su2double aux_cc, CompCorrection, c5;
+  su2double aux_cc, CompCorrection;
   unsigned short iDim, jDim;
 
 public:
@@ -237,7 +238,7 @@ private:
   su2double dfv1, dfv2, dShat;
   su2double dr, dg, dfw;
   su2double Sbar;
-  su2double aux_cc, CompCorrection, c5;
+  su2double aux_cc, CompCorrection;
   unsigned short jDim;
 
 public:
@@ -29,11 +29,93 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/ausm_slau.hpp"
+#include "flow/convection/hllc.hpp"
+#include "flow/convection/fds.hpp"
 #include "flow/convection/centered.hpp"
+#include "flow/convection/boundary.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/convection.hpp"
+#include "scalar/diffusion.hpp"
+#include "scalar/sources.hpp"
+#include "nemo/convection.hpp"
+#include "nemo/diffusion.hpp"
 
 namespace {
 
+/*!
+ * \class CMultiVersionBoundary
+ * \brief Final wrapper of the boundary fluxes (CBoundaryNumericsSIMD). Virtual functions cannot be
+ * multi-versioned, instead the override calls a multi-versioned method into which the (force inlined)
+ * implementation of the scheme is compiled for each instruction set (see SU2_MULTIVERSION).
+ * \note The edge fluxes do this in the scheme classes, whose ComputeFlux is final.
+ */
+template<class Kernel>
+class CMultiVersionBoundary final : public Kernel {
+private:
+  SU2_MULTIVERSION
+  void computeBoundaryFlux(unsigned short iMarker,
+                           Int iVertex,
+                           const CConfig& config,
+                           const CGeometry& geometry,
+                           const CVariable& solution,
+                           const su2activematrix& ghostPrimitive,
+                           Double updateMask,
+                           CSysVector<su2double>& vector,
+                           SparseMatrixType& matrix) const {
+    Kernel::ComputeBoundaryFlux(iMarker, iVertex, config, geometry, solution, ghostPrimitive, updateMask, vector, matrix);
+  }
+
+public:
+  template<class... Ts>
+  CMultiVersionBoundary(Ts&&... args) : Kernel(args...) {}
+
+  void ComputeBoundaryFlux(unsigned short iMarker,
+                           Int iVertex,
+                           const CConfig& config,
+                           const CGeometry& geometry,
+                           const CVariable& solution,
+                           const su2activematrix& ghostPrimitive,
+                           Double updateMask,
+                           CSysVector<su2double>& vector,
+                           SparseMatrixType& matrix) const override {
+    computeBoundaryFlux(iMarker, iVertex, config, geometry, solution, ghostPrimitive, updateMask, vector, matrix);
+  }
+};
+
+/*!
+ * \class CMultiVersionSource
+ * \brief Same as CMultiVersionBoundary for the source terms (CSourceNumericsSIMD).
+ */
+template<class Kernel>
+class CMultiVersionSource final : public Kernel {
+private:
+  SU2_MULTIVERSION
+  void computeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const {
+    Kernel::ComputeSource(iPoint, config, geometry, solution, updateMask, vector, matrix);
+  }
+
+public:
+  template<class... Ts>
+  CMultiVersionSource(Ts&&... args) : Kernel(args...) {}
+
+  void ComputeSource(Int iPoint,
+                     const CConfig& config,
+                     const CGeometry& geometry,
+                     const CVariable& solution,
+                     Double updateMask,
+                     CSysVector<su2double>& vector,
+                     SparseMatrixType& matrix) const override {
+    computeSource(iPoint, config, geometry, solution, updateMask, vector, matrix);
+  }
+};
+
 /*!
  * \brief Upwind factory implementation for ideal gas.
  */
@@ -44,6 +126,27 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case L2ROE:
+      obj = new CL2RoeScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case LMROE:
+      obj = new CLMRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case AUSMPLUSUP:
+      obj = new CAUSMPlusUpScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case AUSMPLUSUP2:
+      obj = new CAUSMPlusUp2Scheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case SLAU:
+      obj = new CSLAUScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
   }
   return obj;
 }
@@ -81,6 +184,34 @@ CNumericsSIMD* createCenteredNumerics(const CConfig& config, int iMesh, const CV
   return obj;
 }
 
+/*!
+ * \brief Factory implementation for incompressible flow.
+ */
+template<class ViscousDecorator>
+CNumericsSIMD* createIncompressibleNumerics(const CConfig& config, int iMesh, const CVariable* turbVars) {
+  CNumericsSIMD* obj = nullptr;
+  switch (config.GetKind_ConvNumScheme_Flow()) {
+    case SPACE_UPWIND:
+      if (config.GetKind_Upwind_Flow() == FDS)
+        obj = new CFDSIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+
+    case SPACE_CENTERED:
+      switch ((iMesh==MESH_0)? config.GetKind_Centered_Flow() : LAX) {
+        case LAX:
+          obj = new CLaxIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        case JST:
+          obj = new CJSTIncScheme<ViscousDecorator>(config, iMesh, turbVars);
+          break;
+        default:
+          break;
+      }
+      break;
+  }
+  return obj;
+}
+
 /*!
  * \brief Generic factory implementation.
  */
@@ -90,6 +221,12 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
                          (config.GetKind_FluidModel() == IDEAL_GAS);
 
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+    if (config.GetViscous())
+      return createIncompressibleNumerics<CIncompressibleViscousFlux<nDim> >(config, iMesh, turbVars);
+    return createIncompressibleNumerics<CNoViscousFlux<nDim> >(config, iMesh, turbVars);
+  }
+
   switch (config.GetKind_ConvNumScheme_Flow()) {
     case SPACE_UPWIND:
       if (config.GetViscous()) {
@@ -122,6 +259,174 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Factory implementation for transported scalars (turbulence models).
+ */
+template<int nDim>
+CNumericsSIMD* createScalarNumerics(const CConfig& config, int iMesh, const CVariable* flowVars,
+                                    const su2double* constants) {
+  CNumericsSIMD* obj = nullptr;
+  if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND) return obj;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA:
+    case TURB_MODEL::SA_E:
+    case TURB_MODEL::SA_COMP:
+    case TURB_MODEL::SA_E_COMP:
+      obj = new CUpwScalarScheme<CSADiffusion<nDim>, false>(config, iMesh, flowVars);
+      break;
+    case TURB_MODEL::SA_NEG:
+      obj = new CUpwScalarScheme<CSANegDiffusion<nDim>, false>(config, iMesh, flowVars);
+      break;
+    case TURB_MODEL::SST:
+    case TURB_MODEL::SST_SUST:
+      if (constants)
+        obj = new CUpwScalarScheme<CSSTDiffusion<nDim>, true>(config, iMesh, flowVars, constants);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Factory implementation for NEMO flows, the number of species is fixed at compile time.
+ */
+template<size_t nSpecies, int nDim>
+CNumericsSIMD* createNEMONumerics(const CConfig& config, int iMesh, CNEMOGas* fluidModel) {
+  CNumericsSIMD* obj = nullptr;
+  if (config.GetKind_ConvNumScheme_Flow() != SPACE_UPWIND) return obj;
+
+  /*--- The viscous fluxes use the species enthalpies of the SU2TCLib gas model. ---*/
+  const bool viscous = config.GetViscous();
+  if (viscous && config.GetKind_FluidModel() != SU2_NONEQ) return obj;
+
+  switch (config.GetKind_Upwind_Flow()) {
+    case AUSM:
+      if (viscous)
+        obj = new CNEMOAUSMScheme<CNEMOViscousFlux<nSpecies,nDim> >(config, iMesh, fluidModel);
+      else
+        obj = new CNEMOAUSMScheme<CNoNEMOViscousFlux<nSpecies,nDim> >(config, iMesh, fluidModel);
+      break;
+    case AUSMPLUSUP2:
+      if (viscous)
+        obj = new CNEMOAUSMPlusUp2Scheme<CNEMOViscousFlux<nSpecies,nDim> >(config, iMesh, fluidModel);
+      else
+        obj = new CNEMOAUSMPlusUp2Scheme<CNoNEMOViscousFlux<nSpecies,nDim> >(config, iMesh, fluidModel);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Dispatch the number of species of the common mixtures (e.g. Argon, N2, air-5).
+ */
+template<int nDim>
+CNumericsSIMD* createNEMONumerics(const CConfig& config, int iMesh, CNEMOGas* fluidModel) {
+  if (config.GetIonization()) return nullptr;
+
+  switch (config.GetnSpecies()) {
+    case 1: return createNEMONumerics<1,nDim>(config, iMesh, fluidModel);
+    case 2: return createNEMONumerics<2,nDim>(config, iMesh, fluidModel);
+    case 5: return createNEMONumerics<5,nDim>(config, iMesh, fluidModel);
+    default: return nullptr;
+  }
+}
+
+/*!
+ * \brief Factory implementation for the convective fluxes of boundary conditions,
+ * mirrors the choice of boundary numerics in CDriver (Roe for centered schemes).
+ */
+template<int nDim>
+CBoundaryNumericsSIMD* createBoundaryNumerics(const CConfig& config, int iMesh) {
+  CBoundaryNumericsSIMD* obj = nullptr;
+  const bool ideal_gas = (config.GetKind_FluidModel() == STANDARD_AIR) ||
+                         (config.GetKind_FluidModel() == IDEAL_GAS);
+
+  /*--- The legacy boundary numerics do not use the low-dissipation Roe/SLAU variants. ---*/
+  if (config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE || !ideal_gas ||
+      config.GetKind_RoeLowDiss() != NO_ROELOWDISS) return obj;
+
+  using Decorator = CNoViscousFlux<nDim>;
+
+  switch (config.GetKind_ConvNumScheme_Flow()) {
+    case SPACE_CENTERED:
+      obj = new CMultiVersionBoundary<CBoundaryScheme<CRoeScheme<Decorator>,nDim> >(config, iMesh);
+      break;
+
+    case SPACE_UPWIND:
+      switch (config.GetKind_Upwind_Flow()) {
+        case ROE:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CRoeScheme<Decorator>,nDim> >(config, iMesh);
+          break;
+        case L2ROE:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CL2RoeScheme<Decorator>,nDim> >(config, iMesh);
+          break;
+        case LMROE:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CLMRoeScheme<Decorator>,nDim> >(config, iMesh);
+          break;
+        case AUSMPLUSUP:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CAUSMPlusUpScheme<Decorator>,nDim> >(config, iMesh);
+          break;
+        case AUSMPLUSUP2:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CAUSMPlusUp2Scheme<Decorator>,nDim> >(config, iMesh);
+          break;
+        case SLAU:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CSLAUScheme<Decorator,false>,nDim> >(config, iMesh);
+          break;
+        case SLAU2:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CSLAUScheme<Decorator,true>,nDim> >(config, iMesh);
+          break;
+        case HLLC:
+          obj = new CMultiVersionBoundary<CBoundaryScheme<CHLLCScheme<Decorator>,nDim> >(config, iMesh);
+          break;
+        default:
+          break;
+      }
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Factory implementation for the source terms of the turbulence models.
+ */
+template<int nDim>
+CSourceNumericsSIMD* createSourceNumerics(const CConfig& config, int iMesh, const CVariable* flowVars,
+                                          const su2double* constants, const su2double* solutionInf) {
+  CSourceNumericsSIMD* obj = nullptr;
+
+  switch (config.GetKind_Turb_Model()) {
+    case TURB_MODEL::SA:
+      /*--- The BC transition model stores the intermittency in the turbulence variables. ---*/
+      if (config.GetKind_Trans_Model() != BC)
+        obj = new CMultiVersionSource<CSASource<nDim, TURB_MODEL::SA> >(config, iMesh, flowVars);
+      break;
+    case TURB_MODEL::SA_E:
+      obj = new CMultiVersionSource<CSASource<nDim, TURB_MODEL::SA_E> >(config, iMesh, flowVars);
+      break;
+    case TURB_MODEL::SA_COMP:
+      obj = new CMultiVersionSource<CSASource<nDim, TURB_MODEL::SA_COMP> >(config, iMesh, flowVars);
+      break;
+    case TURB_MODEL::SA_E_COMP:
+      obj = new CMultiVersionSource<CSASource<nDim, TURB_MODEL::SA_E_COMP> >(config, iMesh, flowVars);
+      break;
+    case TURB_MODEL::SA_NEG:
+      obj = new CMultiVersionSource<CSASource<nDim, TURB_MODEL::SA_NEG> >(config, iMesh, flowVars);
+      break;
+    case TURB_MODEL::SST:
+    case TURB_MODEL::SST_SUST:
+      if (constants && solutionInf && !config.GetAxisymmetric() && !config.GetUsing_UQ())
+        obj = new CMultiVersionSource<CSSTSource<nDim> >(config, iMesh, flowVars, constants, solutionInf);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
 } // namespace
 
 /*!
@@ -130,11 +435,53 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
  * numerical methods.
  */
 CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars) {
-  if ((Double::Size < 4) && (SU2_MPI::GetRank() == MASTER_NODE)) {
-    cout << "WARNING: SU2 was not compiled for an AVX-capable architecture." << endl;
+  /*--- Report the instruction set only once, not for every solver and grid level. ---*/
+  static bool reported = false;
+  if (!reported && (SU2_MPI::GetRank() == MASTER_NODE)) {
+    reported = true;
+#ifdef USE_SIMD_DISPATCH
+    __builtin_cpu_init();
+    const char* isa = __builtin_cpu_supports("avx512f")? "AVX-512" : __builtin_cpu_supports("avx2")? "AVX2" : "SSE2";
+    cout << "Vectorized numerics: " << isa << " instructions selected at runtime." << endl;
+#else
+    if (Double::Size < 4) {
+      cout << "WARNING: SU2 was not compiled for an AVX-capable architecture." << endl;
+    }
+#endif
   }
   if (nDim == 2) return createNumerics<2>(config, iMesh, turbVars);
   if (nDim == 3) return createNumerics<3>(config, iMesh, turbVars);
 
   return nullptr;
 }
+
+CNumericsSIMD* CNumericsSIMD::CreateScalarNumerics(const CConfig& config, int nDim, int iMesh,
+                                                   const CVariable* flowVars, const su2double* constants) {
+  if (nDim == 2) return createScalarNumerics<2>(config, iMesh, flowVars, constants);
+  if (nDim == 3) return createScalarNumerics<3>(config, iMesh, flowVars, constants);
+
+  return nullptr;
+}
+
+CNumericsSIMD* CNumericsSIMD::CreateNEMONumerics(const CConfig& config, int nDim, int iMesh, CNEMOGas* fluidModel) {
+  if (nDim == 2) return createNEMONumerics<2>(config, iMesh, fluidModel);
+  if (nDim == 3) return createNEMONumerics<3>(config, iMesh, fluidModel);
+
+  return nullptr;
+}
+
+CBoundaryNumericsSIMD* CBoundaryNumericsSIMD::CreateBoundaryNumerics(const CConfig& config, int nDim, int iMesh) {
+  if (nDim == 2) return createBoundaryNumerics<2>(config, iMesh);
+  if (nDim == 3) return createBoundaryNumerics<3>(config, iMesh);
+
+  return nullptr;
+}
+
+CSourceNumericsSIMD* CSourceNumericsSIMD::CreateSourceNumerics(const CConfig& config, int nDim, int iMesh,
+                                                               const CVariable* flowVars, const su2double* constants,
+                                                               const su2double* solutionInf) {
+  if (nDim == 2) return createSourceNumerics<2>(config, iMesh, flowVars, constants, solutionInf);
+  if (nDim == 3) return createSourceNumerics<3>(config, iMesh, flowVars, constants, solutionInf);
+
+  return nullptr;
+}
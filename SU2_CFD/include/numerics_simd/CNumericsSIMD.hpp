@@ -28,6 +28,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/vectorization.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 /*!
  * \enum UpdateType
@@ -49,6 +50,7 @@ template<class T> class CSysMatrix;
 class CConfig;
 class CGeometry;
 class CVariable;
+class CNEMOGas;
 
 #ifdef CODI_FORWARD_TYPE
 using SparseMatrixType = CSysMatrix<su2double>;
@@ -96,4 +98,112 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the convection and diffusion of transported scalars.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Model constants (SST).
+   */
+  static CNumericsSIMD* CreateScalarNumerics(const CConfig& config, int nDim, int iMesh,
+                                             const CVariable* flowVars, const su2double* constants = nullptr);
+
+  /*!
+   * \brief Factory method for thermochemical non-equilibrium flows.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \param[in] fluidModel - Gas model, provides the constant properties of the species.
+   * \return nullptr if the number of species, scheme, or gas model are not supported.
+   */
+  static CNumericsSIMD* CreateNEMONumerics(const CConfig& config, int nDim, int iMesh, CNEMOGas* fluidModel);
+
+};
+
+/*!
+ * \class CBoundaryNumericsSIMD
+ * \brief Interface of the convective fluxes of boundary conditions, computed in batches of vertices.
+ */
+class CBoundaryNumericsSIMD {
+public:
+  /*!
+   * \brief Interface for the convective flux across boundary faces, between the
+   *        boundary points and the ghost states imposed by the boundary conditions.
+   * \param[in] iMarker - Boundary marker.
+   * \param[in] iVertex - The vertices of the marker for flux computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] ghostPrimitive - Primitive variables of the ghost state of each vertex.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the fluxes (added to the boundary points).
+   * \param[in,out] matrix - Target for the flux Jacobians (added to the diagonal blocks).
+   */
+  virtual void ComputeBoundaryFlux(unsigned short iMarker,
+                                   Int iVertex,
+                                   const CConfig& config,
+                                   const CGeometry& geometry,
+                                   const CVariable& solution,
+                                   const su2activematrix& ghostPrimitive,
+                                   Double updateMask,
+                                   CSysVector<su2double>& vector,
+                                   SparseMatrixType& matrix) const = 0;
+
+  /*! \brief Destructor of the class. */
+  virtual ~CBoundaryNumericsSIMD(void) = default;
+
+  /*!
+   * \brief Factory method, the scheme is that of the boundary numerics of the legacy
+   *        classes (first order, inviscid).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \return nullptr if the scheme or gas model are not supported.
+   */
+  static CBoundaryNumericsSIMD* CreateBoundaryNumerics(const CConfig& config, int nDim, int iMesh);
+
+};
+
+/*!
+ * \class CSourceNumericsSIMD
+ * \brief Interface of the source terms of transported scalars (turbulence models), computed in batches of points.
+ */
+class CSourceNumericsSIMD {
+public:
+  /*!
+   * \brief Interface for source term computation.
+   * \param[in] iPoint - The points for source computation.
+   * \param[in] config - Problem definitions.
+   * \param[in] geometry - Problem geometry.
+   * \param[in] solution - Solution variables.
+   * \param[in] updateMask - SIMD array of 1's and 0's, the latter prevent the update.
+   * \param[in,out] vector - Target for the sources (subtracted).
+   * \param[in,out] matrix - Target for the source Jacobians (subtracted from the diagonal blocks).
+   */
+  virtual void ComputeSource(Int iPoint,
+                             const CConfig& config,
+                             const CGeometry& geometry,
+                             const CVariable& solution,
+                             Double updateMask,
+                             CSysVector<su2double>& vector,
+                             SparseMatrixType& matrix) const = 0;
+
+  /*! \brief Destructor of the class. */
+  virtual ~CSourceNumericsSIMD(void) = default;
+
+  /*!
+   * \brief Factory method for the source terms of the turbulence models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] constants - Model constants (SST).
+   * \param[in] solutionInf - Free-stream values of the model variables (SST sustaining terms).
+   * \return nullptr if the model or some of its options are not supported.
+   */
+  static CSourceNumericsSIMD* CreateSourceNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* flowVars,
+                                                   const su2double* constants = nullptr,
+                                                   const su2double* solutionInf = nullptr);
+
 };
@@ -0,0 +1,446 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM and SLAU families of convective schemes.
+ * \author P. Gomes, A. Bueno, F. Palacios
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMSLAUBase
+ * \brief Base class for schemes of the general form
+ * F = ||A|| ( 0.5*mdot*(psi_i+psi_j) - 0.5*|mdot|*(psi_j-psi_i) + N*p ),
+ * derived classes implement the face mass flux (mdot) and pressure (p) in a
+ * const "massAndPressureFluxes" method. The Jacobians are approximated with
+ * those of the Roe scheme (accurate Jacobians are not available here).
+ * \note The base class is a decorator implementing "viscousTerms", see CRoeBase.
+ */
+template<class Derived, class Base>
+class CAUSMSLAUBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool muscl;
+  const ENUM_LIMITER typeLimiter;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMSLAUBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+  /*!
+   * \brief Inviscid flux and Jacobians between the states V.i and V.j, used for
+   * edges and for boundaries (where V.j is the ghost state and jPoint = iPoint).
+   * \note Grid motion is not accounted for, as in the legacy AUSM/SLAU classes.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void inviscidFlux(const CPair<PrimVarType>& V,
+                                const VectorDbl<nDim>& normal,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                Double,
+                                Int iPoint,
+                                Int jPoint,
+                                const CEulerVariable& solution,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    /*--- Face mass flux and pressure from derived class (static polymorphism). ---*/
+
+    Double mdot, pressure;
+    const auto derived = static_cast<const Derived*>(this);
+    derived->massAndPressureFluxes(V, unitNormal, iPoint, jPoint, solution, mdot, pressure);
+
+    /*--- Assemble the flux, psi = (1, velocity, enthalpy). ---*/
+
+    const Double mdotAbs = abs(mdot);
+
+    flux(0) = mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = 0.5*mdot*(V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                     0.5*mdotAbs*(V.i.velocity(iDim) - V.j.velocity(iDim)) +
+                     unitNormal(iDim)*pressure;
+    }
+    flux(nVar-1) = 0.5*mdot*(V.i.enthalpy() + V.j.enthalpy()) +
+                   0.5*mdotAbs*(V.i.enthalpy() - V.j.enthalpy());
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Approximate Jacobians. ---*/
+
+    if (implicit) {
+      CPair<CCompressibleConservatives<nDim> > U;
+      U.i = compressibleConservatives(V.i);
+      U.j = compressibleConservatives(V.j);
+      approximateRoeJacobians(gamma, V, U, normal, area, unitNormal, jac_i, jac_j);
+    }
+  }
+
+  /*!
+   * \brief Implementation of the general AUSM/SLAU flux.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
+   */
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Inviscid flux and Jacobians. ---*/
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    inviscidFlux(V, normal, area, unitNormal, Double(0.0), iPoint, jPoint,
+                 solution, implicit, flux, jac_i, jac_j);
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
+};
+
+/*!
+ * \brief Interface speed of sound, Mach number splittings, and pressure
+ * diffusion shared by the AUSM+up and AUSM+up2 schemes (Liou, JCP 2006).
+ */
+struct CAUSMPlusUpSplitting {
+  Double projVel_i, projVel_j, aF, rhoF, MFsq, fa;
+  Double mLP, mRM, pLP, pRM, mdot;
+};
+
+/*!
+ * \brief Compute the quantities common to AUSM+up and AUSM+up2.
+ */
+template<size_t nDim, class PrimVarType>
+FORCEINLINE CAUSMPlusUpSplitting ausmPlusUpSplitting(Double gamma, Double Minf,
+                                                           const CPair<PrimVarType>& V,
+                                                           const VectorDbl<nDim>& unitNormal) {
+  constexpr passivedouble Kp = 0.25, sigma = 1.0, beta = 1.0/8.0;
+
+  CAUSMPlusUpSplitting s;
+
+  s.projVel_i = dot(V.i.velocity(), unitNormal);
+  s.projVel_j = dot(V.j.velocity(), unitNormal);
+
+  /*--- Interface speed of sound. ---*/
+
+  const Double astarL = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+  const Double astarR = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+  const Double ahatL = astarL*astarL / max(astarL, s.projVel_i);
+  const Double ahatR = astarR*astarR / max(astarR,-s.projVel_j);
+
+  s.aF = min(ahatL, ahatR);
+
+  /*--- Left and right Mach numbers, reference Mach, and scaling. ---*/
+
+  const Double mL = s.projVel_i / s.aF;
+  const Double mR = s.projVel_j / s.aF;
+
+  s.MFsq = 0.5*(mL*mL + mR*mR);
+  const Double Mrefsq = min(1.0, max(s.MFsq, Minf*Minf));
+  s.fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+  const Double alpha = 3.0/16.0*(-4+5*s.fa*s.fa);
+
+  /*--- Polynomial splittings (subsonic) and upwind values (supersonic),
+   *    the branches are evaluated for all lanes and then blended. ---*/
+
+  const Double subL = abs(mL) <= 1.0;
+  const Double subR = abs(mR) <= 1.0;
+
+  Double p1 = 0.25*pow(mL+1, 2);
+  Double p2 = pow(mL*mL-1, 2);
+  s.mLP = subL * (p1 + beta*p2) + (1-subL) * 0.5*(mL+abs(mL));
+  s.pLP = subL * (p1*(2-mL) + alpha*mL*p2) + (1-subL) * (mL > 0.0);
+
+  p1 = 0.25*pow(mR-1, 2);
+  p2 = pow(mR*mR-1, 2);
+  s.mRM = subR * (-p1 - beta*p2) + (1-subR) * 0.5*(mR-abs(mR));
+  s.pRM = subR * (p1*(2+mR) - alpha*mR*p2) + (1-subR) * (mR < 0.0);
+
+  /*--- Mass flux with pressure diffusion term. ---*/
+
+  s.rhoF = 0.5*(V.i.density() + V.j.density());
+  const Double Mp = -(Kp/s.fa) * max(1-sigma*s.MFsq, 0.0) *
+                    (V.j.pressure()-V.i.pressure()) / (s.rhoF*s.aF*s.aF);
+
+  const Double mF = s.mLP + s.mRM + Mp;
+  s.mdot = s.aF * (max(mF, 0.0)*V.i.density() + min(mF, 0.0)*V.j.density());
+
+  return s;
+}
+
+/*!
+ * \class CAUSMPlusUpScheme
+ * \brief AUSM+up scheme.
+ */
+template<class Decorator>
+class CAUSMPlusUpScheme : public CAUSMSLAUBase<CAUSMPlusUpScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMPlusUpScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPlusUpScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure of AUSM+up.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int, Int, const CEulerVariable&,
+                                         Double& mdot, Double& pressure) const {
+    constexpr passivedouble Ku = 0.75;
+
+    const auto s = ausmPlusUpSplitting(gamma, Minf, V, unitNormal);
+
+    const Double Pu = -Ku * s.fa * s.pLP * s.pRM * 2 * s.rhoF * s.aF * (s.projVel_j - s.projVel_i);
+
+    mdot = s.mdot;
+    pressure = s.pLP*V.i.pressure() + s.pRM*V.j.pressure() + Pu;
+  }
+};
+
+/*!
+ * \class CAUSMPlusUp2Scheme
+ * \brief AUSM+up2 scheme (Kitamura and Shima, JCP 2013).
+ */
+template<class Decorator>
+class CAUSMPlusUp2Scheme : public CAUSMSLAUBase<CAUSMPlusUp2Scheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMPlusUp2Scheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPlusUp2Scheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up2 requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux and (modified) pressure of AUSM+up2.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int, Int, const CEulerVariable&,
+                                         Double& mdot, Double& pressure) const {
+
+    const auto s = ausmPlusUpSplitting(gamma, Minf, V, unitNormal);
+
+    const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+
+    mdot = s.mdot;
+    pressure = 0.5*(V.j.pressure() + V.i.pressure()) +
+               0.5*(s.pLP - s.pRM)*(V.i.pressure() - V.j.pressure()) +
+               sqrt(sqVel)*(s.pLP + s.pRM - 1)*s.rhoF*s.aF;
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \brief SLAU (Shima and Kitamura, AIAA J. 2011) and, if SLAU2=true,
+ * SLAU2 (Kitamura and Shima, JCP 2013) schemes.
+ */
+template<class Decorator, bool SLAU2>
+class CSLAUScheme : public CAUSMSLAUBase<CSLAUScheme<Decorator,SLAU2>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CSLAUScheme<Decorator,SLAU2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const ENUM_ROELOWDISS typeDissip;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    typeDissip(static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss())) {
+  }
+
+  /*!
+   * \brief Face mass flux and pressure of SLAU/SLAU2.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Int iPoint, Int jPoint,
+                                         const CEulerVariable& solution,
+                                         Double& mdot, Double& pressure) const {
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure()/V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure()/V.j.density();
+
+    const Double c_i = sqrt(abs(gamma*(gamma-1)*(energy_i - 0.5*sqVel_i)));
+    const Double c_j = sqrt(abs(gamma*(gamma-1)*(energy_j - 0.5*sqVel_j)));
+
+    /*--- Interface speed of sound, and left/right Mach number. ---*/
+
+    const Double aF = 0.5*(c_i + c_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double sqVelMean = sqrt(0.5*(sqVel_i + sqVel_j));
+    const Double machTilde = min(1.0, sqVelMean / aF);
+    const Double chi = pow(1-machTilde, 2);
+    const Double fRho = -max(min(mL, 0.0), -1.0) * min(max(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double rho_i = V.i.density(), rho_j = V.j.density();
+    const Double vnMag = (rho_i*abs(projVel_i) + rho_j*abs(projVel_j)) / (rho_i + rho_j);
+    const Double vnMagL = (1-fRho)*vnMag + fRho*abs(projVel_i);
+    const Double vnMagR = (1-fRho)*vnMag + fRho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5*(rho_i*(projVel_i+vnMagL) + rho_j*(projVel_j-vnMagR) -
+                (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double subR = abs(mR) < 1.0;
+    const Double betaL = subL * 0.25*(2-mL)*pow(mL+1, 2) + (1-subL) * (mL >= 0.0);
+    const Double betaR = subR * 0.25*(2+mR)*pow(mR-1, 2) + (1-subR) * (mR < 0.0);
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    const Double pMean = 0.5*(V.i.pressure() + V.j.pressure());
+
+    pressure = pMean + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!SLAU2) pressure += dissipation*(1-chi)*(betaL+betaR-1)*pMean;
+    else pressure += dissipation*sqVelMean*(betaL+betaR-1)*aF*0.5*(rho_i+rho_j);
+  }
+};
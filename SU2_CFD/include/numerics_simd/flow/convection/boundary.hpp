@@ -0,0 +1,133 @@
+/*!
+ * \file boundary.hpp
+ * \brief Convective fluxes of boundary conditions (ghost state approach).
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CBoundaryScheme
+ * \brief Wraps a compressible scheme to compute the flux between the points of a boundary
+ * marker and the ghost states set by the boundary conditions (e.g. far-field, inlet), in
+ * batches of vertices. The flux and Jacobians are those of "inviscidFlux" of the scheme,
+ * without reconstruction or viscous terms (those are still added by the boundary conditions).
+ * \note Only the Jacobian w.r.t. the boundary point is used, as in the legacy BC routines.
+ */
+template<class Scheme, size_t nDim>
+class CBoundaryScheme : public Scheme, public CBoundaryNumericsSIMD {
+protected:
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarFlux = nDim+4;
+
+  const bool dynamicGrid;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to the scheme.
+   */
+  template<class... Ts>
+  CBoundaryScheme(const CConfig& config, Ts&... args) : Scheme(config, args...),
+    dynamicGrid(config.GetDynamic_Grid()) {
+  }
+
+  /*!
+   * \brief Implementation of the boundary flux.
+   */
+  FORCEINLINE void ComputeBoundaryFlux(unsigned short iMarker,
+                                       Int iVertex,
+                                       const CConfig& config,
+                                       const CGeometry& geometry,
+                                       const CVariable& solution_,
+                                       const su2activematrix& ghostPrimitive,
+                                       Double updateMask,
+                                       CSysVector<su2double>& vector,
+                                       SparseMatrixType& matrix) const override {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    /*--- Boundary points and normals (negated for the outward convention),
+     *    the vertices are not stored contiguously so these are gathered by lane. ---*/
+
+    Int iPoint;
+    VectorDbl<nDim> normal;
+    for (size_t k = 0; k < Double::Size; ++k) {
+      const auto vertex = geometry.vertex[iMarker][iVertex[k]];
+      iPoint[k] = vertex->GetNode();
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        AD::SetPreaccIn(vertex->GetNormal(iDim));
+        normal(iDim)[k] = -vertex->GetNormal(iDim);
+      }
+    }
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Domain and ghost states. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVarFlux> > V;
+    V.i.all = gatherVariables<nPrimVarFlux>(iPoint, solution.GetPrimitive());
+    V.j.all = gatherVariables<nPrimVarFlux>(iVertex, ghostPrimitive);
+
+    /*--- Grid motion, the ghost moves with the boundary point. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      projGridVel = dot(gatherVariables<nDim>(iPoint, geometry.nodes->GetGridVel()), unitNormal);
+    }
+
+    /*--- Flux and Jacobians of the wrapped scheme. ---*/
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    this->inviscidFlux(V, normal, area, unitNormal, projGridVel, iPoint, iPoint,
+                       solution, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and the diagonal of the system matrix. ---*/
+
+    vector.AddBlock(iPoint, flux, updateMask);
+    if (implicit) {
+      auto wasActive = AD::BeginPassive();
+      matrix.AddBlock2Diag(iPoint, jac_i, updateMask);
+      AD::EndPassive(wasActive);
+    }
+  }
+};
@@ -32,6 +32,7 @@
 #include "../variables.hpp"
 #include "common.hpp"
 #include "../../../variables/CEulerVariable.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
 #include "../../../../../Common/include/geometry/CGeometry.hpp"
 
 /*!
@@ -50,6 +51,7 @@ protected:
   const su2double gamma;
   const su2double fixFactor;
   const bool dynamicGrid;
+  const bool frozenJacobian;
   const su2double stretchParam = 0.3;
 
   /*!
@@ -59,38 +61,28 @@ protected:
   CCenteredBase(const CConfig& config, Ts&... args) : Base(config, args...),
     gamma(config.GetGamma()),
     fixFactor(config.GetCent_Jac_Fix_Factor()),
-    dynamicGrid(config.GetDynamic_Grid()) {
+    dynamicGrid(config.GetDynamic_Grid()),
+    frozenJacobian(config.GetFrozen_ConvJac_Disc()) {
   }
 
-  /*!
-   * \brief Special treatment needed to fetch integer data.
-   */
-  template<class T, size_t N>
-  FORCEINLINE static Double numNeighbor(simd::Array<T,N> idx, const CGeometry& geometry) {
-    Double n;
-    for (size_t k=0; k<N; ++k) n[k] = geometry.nodes->GetnNeighbor(idx[k]);
-    return n;
-  }
-  FORCEINLINE static Double numNeighbor(unsigned long idx, const CGeometry& geometry) {
-    return geometry.nodes->GetnNeighbor(idx);
-  }
-
-public:
   /*!
    * \brief Implementation of the base centered flux.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
    */
-  void ComputeFlux(Int iEdge,
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
                    const CConfig& config,
                    const CGeometry& geometry,
                    const CVariable& solution_,
                    UpdateType updateType,
                    Double updateMask,
                    CSysVector<su2double>& vector,
-                   SparseMatrixType& matrix) const final {
+                   SparseMatrixType& matrix) const {
 
-    /*--- Start preaccumulation, inputs are registered
-     *    automatically in "gatherVariables". ---*/
-    AD::StartPreacc();
+    /*--- Start preaccumulation, inputs are registered automatically in "gatherVariables",
+     *    unless the inviscid flux is recorded as an external function. ---*/
+    CFrozenJacobianFlux<nDim> extFunc(frozenJacobian, iEdge, geometry.edges->GetNormal());
+    if (!extFunc.isActive()) AD::StartPreacc();
 
     const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
     const auto& solution = static_cast<const CEulerVariable&>(solution_);
@@ -113,6 +105,8 @@ public:
     V.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
     V.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
 
+    extFunc.begin(V);
+
     CCompressiblePrimitives<nDim,nPrimVar> avgV;
     for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
       avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
@@ -165,9 +159,21 @@ public:
 
     const auto derived = static_cast<const Derived*>(this);
 
-    derived->finalizeFlux(flux, jac_i, jac_j, implicit, area, projVel, avgV, V,
+    /*--- The Jacobians recorded for the reverse sweep (frozen Jacobian) must not be scaled. ---*/
+    const su2double jacFactor = extFunc.isActive() ? su2double(1.0) : fixFactor;
+
+    derived->finalizeFlux(flux, jac_i, jac_j, implicit, jacFactor, area, projVel, avgV, V,
                           diffU, iPoint, jPoint, geometry, solution, unitNormal);
 
+    extFunc.end(V, flux, jac_i, jac_j, Base::nPrimVar > 0);
+
+    if (extFunc.isActive()) {
+      /*--- The average was computed without recording, the viscous terms need it. ---*/
+      for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+        avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+      }
+    }
+
     /*--- Add the contributions from the base class (static decorator). ---*/
 
     Base::viscousTerms(iEdge, iPoint, jPoint, avgV, V, solution_, geometry,
@@ -182,6 +188,21 @@ public:
     updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
                        updateMask, flux, jac_i, jac_j, vector, matrix);
   }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
 };
 
 /*!
@@ -195,7 +216,6 @@ private:
   using Base::nDim;
   using Base::nVar;
   using Base::gamma;
-  using Base::fixFactor;
   using Base::stretchParam;
   const su2double kappa2;
   const su2double kappa4;
@@ -219,6 +239,7 @@ public:
                                 MatrixDbl<nVar>& jac_i,
                                 MatrixDbl<nVar>& jac_j,
                                 bool implicit,
+                                su2double jacFactor,
                                 Double area,
                                 Double projVel,
                                 const PrimVarType& avgV,
@@ -235,8 +256,8 @@ public:
 
     /*--- Compute dissipation coefficients. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double sc2 = 3 * (ni+nj) / (ni*nj);
     const Double sc4 = 0.25*pow(sc2, 2);
 
@@ -255,8 +276,8 @@ public:
     }
 
     if (implicit) {
-      const Double dissip_i = fixFactor * (eps2 + eps4*(ni+1)) * lambda;
-      const Double dissip_j = -fixFactor * (eps2 + eps4*(nj+1)) * lambda;
+      const Double dissip_i = jacFactor * (eps2 + eps4*(ni+1)) * lambda;
+      const Double dissip_j = -jacFactor * (eps2 + eps4*(nj+1)) * lambda;
       scalarDissipationJacobian(V.i, gamma, dissip_i, jac_i);
       scalarDissipationJacobian(V.j, gamma, dissip_j, jac_j);
     }
@@ -274,7 +295,6 @@ private:
   using Base::nDim;
   using Base::nVar;
   using Base::gamma;
-  using Base::fixFactor;
   const su2double kappa2;
   const su2double kappa4;
   const su2double entropyFix;
@@ -299,6 +319,7 @@ public:
                                 MatrixDbl<nVar>& jac_i,
                                 MatrixDbl<nVar>& jac_j,
                                 bool implicit,
+                                su2double jacFactor,
                                 Double area,
                                 Double projVel,
                                 const PrimVarType& avgV,
@@ -313,8 +334,8 @@ public:
 
     /*--- Compute scalar dissipation. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double sc2 = 3 * (ni+nj) / (ni*nj);
     const Double sc4 = 0.25*pow(sc2, 2);
 
@@ -334,7 +355,7 @@ public:
     MatrixDbl<nVar> scalarJac;
     if (implicit) {
       scalarJac = Double(0.0);
-      Double factor = fixFactor * (eps2 + 0.5*eps4*(ni+nj+2));
+      Double factor = jacFactor * (eps2 + 0.5*eps4*(ni+nj+2));
       scalarDissipationJacobian(avgV, gamma, factor, scalarJac);
     }
 
@@ -400,7 +421,6 @@ private:
   using Base::nDim;
   using Base::nVar;
   using Base::gamma;
-  using Base::fixFactor;
   using Base::stretchParam;
   const su2double kappa2;
 
@@ -422,6 +442,7 @@ public:
                                 MatrixDbl<nVar>& jac_i,
                                 MatrixDbl<nVar>& jac_j,
                                 bool implicit,
+                                su2double jacFactor,
                                 Double area,
                                 Double projVel,
                                 const PrimVarType& avgV,
@@ -438,8 +459,8 @@ public:
 
     /*--- Compute dissipation coefficient. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double sc2 = 3 * (ni+nj) / (ni*nj);
 
     const auto si = gatherVariables(iPoint, solution.GetSensor());
@@ -453,8 +474,8 @@ public:
     }
 
     if (implicit) {
-      scalarDissipationJacobian(V.i, gamma, fixFactor*dissip, jac_i);
-      scalarDissipationJacobian(V.j, gamma, -fixFactor*dissip, jac_j);
+      scalarDissipationJacobian(V.i, gamma, jacFactor*dissip, jac_i);
+      scalarDissipationJacobian(V.j, gamma, -jacFactor*dissip, jac_j);
     }
   }
 };
@@ -470,7 +491,6 @@ private:
   using Base::nDim;
   using Base::nVar;
   using Base::gamma;
-  using Base::fixFactor;
   using Base::stretchParam;
   const su2double kappa0;
 
@@ -492,6 +512,7 @@ public:
                                 MatrixDbl<nVar>& jac_i,
                                 MatrixDbl<nVar>& jac_j,
                                 bool implicit,
+                                su2double jacFactor,
                                 Double area,
                                 Double projVel,
                                 const PrimVarType& avgV,
@@ -508,8 +529,8 @@ public:
 
     /*--- Compute dissipation coefficient. ---*/
 
-    const auto ni = Base::numNeighbor(iPoint, geometry);
-    const auto nj = Base::numNeighbor(jPoint, geometry);
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
     const Double dissip = kappa0 * nDim * (ni+nj) / (ni*nj) * lambda;
 
     /*--- Update flux and Jacobians with dissipation term. ---*/
@@ -519,8 +540,320 @@ public:
     }
 
     if (implicit) {
-      scalarDissipationJacobian(V.i, gamma, fixFactor*dissip, jac_i);
-      scalarDissipationJacobian(V.j, gamma, -fixFactor*dissip, jac_j);
+      scalarDissipationJacobian(V.i, gamma, jacFactor*dissip, jac_i);
+      scalarDissipationJacobian(V.j, gamma, -jacFactor*dissip, jac_j);
+    }
+  }
+};
+
+/*!
+ * \class CCenteredIncBase
+ * \brief Base class for centered schemes for incompressible flow (artificial
+ * compressibility), derived classes implement the preconditioned dissipation
+ * term in a const "finalizeFlux" method.
+ * \note See CRoeBase for the role of Base.
+ */
+template<class Derived, class Base>
+class CCenteredIncBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const su2double fixFactor;
+  const bool dynamicGrid;
+  const bool variableDensity;
+  const bool energy;
+  const su2double stretchParam = 0.3;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CCenteredIncBase(const CConfig& config, Ts&... args) : Base(config, args...),
+    fixFactor(config.GetCent_Inc_Jac_Fix_Factor()),
+    dynamicGrid(config.GetDynamic_Grid()),
+    variableDensity(config.GetKind_DensityModel() == INC_DENSITYMODEL::VARIABLE),
+    energy(config.GetEnergy_Equation()) {
+  }
+
+  /*!
+   * \brief Implementation of the base centered flux.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
+   */
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Primitive variables. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V;
+    V.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    CIncompressiblePrimitives<nDim,nPrimVar> avgV;
+    for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+    const Double avgdRhodT = variableDensity? Double(-avgV.density() / avgV.temperature()) : Double(0.0);
+
+    /*--- Inviscid flux and Jacobians at the mean state. ---*/
+
+    const Double avgEnthalpy = 0.5 * (V.i.cp()*V.i.temperature() + V.j.cp()*V.j.temperature());
+
+    auto flux = incInviscidProjFlux(avgV, avgEnthalpy, normal);
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = incInviscidProjJac(avgV, avgV.cp(), avgdRhodT, normal, 0.5);
+      jac_j = jac_i;
+    }
+
+    /*--- Grid motion, the conservative variables are (rho, rho v, rho cp T). ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+
+      flux(0) -= projGridVel * avgV.density();
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        flux(iDim+1) -= projGridVel * 0.5*(V.i.density()*V.i.velocity(iDim) +
+                                           V.j.density()*V.j.velocity(iDim));
+      }
+      flux(nDim+1) -= projGridVel * 0.5*(V.i.density()*V.i.cp()*V.i.temperature() +
+                                         V.j.density()*V.j.cp()*V.j.temperature());
+      if (implicit) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_i(iDim+1,iDim+1) -= 0.5 * projGridVel * V.i.density();
+          jac_j(iDim+1,iDim+1) -= 0.5 * projGridVel * V.j.density();
+        }
+        jac_i(nDim+1,nDim+1) -= 0.5 * projGridVel * V.i.density() * V.i.cp();
+        jac_j(nDim+1,nDim+1) -= 0.5 * projGridVel * V.j.density() * V.j.cp();
+      }
+    }
+
+    /*--- Local spectral radius of the preconditioned system, corrected for stretching. ---*/
+
+    const Double lambda_i = abs(dot(V.i.velocity(), normal) - projGridVel) + sqrt(V.i.betaInc2())*area;
+    const Double lambda_j = abs(dot(V.j.velocity(), normal) - projGridVel) + sqrt(V.j.betaInc2())*area;
+    const Double lambda = correctedSpectralRadius(iPoint, jPoint, 0.5*(lambda_i+lambda_j),
+                                                  stretchParam, solution);
+
+    /*--- Preconditioner and differences of primitive variables (p, v, T). ---*/
+
+    const auto precon = incPreconditioner(avgV, avgV.cp(), avgdRhodT);
+
+    VectorDbl<nVar> diffV;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      diffV(iVar) = V.i.all(iVar) - V.j.all(iVar);
+    }
+
+    /*--- Finalize in derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    derived->finalizeFlux(flux, jac_i, jac_j, implicit, lambda, precon,
+                          diffV, iPoint, jPoint, geometry, solution);
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, avgV, V, solution_, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    if (!energy) removeEnergyTerms(implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
+
+protected:
+  /*!
+   * \brief Add the preconditioned scalar dissipation "precon x dissip" to the flux,
+   * and "precon x coeff" to the Jacobians.
+   */
+  FORCEINLINE static void preconditionedDissipation(const MatrixDbl<nVar>& precon,
+                                                    const VectorDbl<nVar>& dissip,
+                                                    bool implicit,
+                                                    Double coeff_i,
+                                                    Double coeff_j,
+                                                    VectorDbl<nVar>& flux,
+                                                    MatrixDbl<nVar>& jac_i,
+                                                    MatrixDbl<nVar>& jac_j) {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        flux(iVar) += precon(iVar,jVar) * dissip(jVar);
+        if (implicit) {
+          jac_i(iVar,jVar) += precon(iVar,jVar) * coeff_i;
+          jac_j(iVar,jVar) -= precon(iVar,jVar) * coeff_j;
+        }
+      }
+    }
+  }
+};
+
+/*!
+ * \class CJSTIncScheme
+ * \brief JST scheme with scalar (preconditioned) dissipation for incompressible flow.
+ */
+template<class Decorator>
+class CJSTIncScheme : public CCenteredIncBase<CJSTIncScheme<Decorator>,Decorator> {
+private:
+  using Base = CCenteredIncBase<CJSTIncScheme<Decorator>,Decorator>;
+  using Base::nVar;
+  using Base::fixFactor;
+  const su2double kappa2;
+  const su2double kappa4;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CJSTIncScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    kappa2(config.GetKappa_2nd_Flow()),
+    kappa4(config.GetKappa_4th_Flow()) {
+  }
+
+  /*!
+   * \brief Updates flux and Jacobians with JST dissipation.
+   */
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j,
+                                bool implicit,
+                                Double lambda,
+                                const MatrixDbl<nVar>& precon,
+                                const VectorDbl<nVar>& diffV,
+                                Int iPoint,
+                                Int jPoint,
+                                const CGeometry& geometry,
+                                const CIncEulerVariable& solution) const {
+
+    /*--- Compute dissipation coefficients. ---*/
+
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
+    const Double sc2 = 3 * (ni+nj) / (ni*nj);
+    const Double sc4 = 0.25*pow(sc2, 2);
+
+    const auto si = gatherVariables(iPoint, solution.GetSensor());
+    const auto sj = gatherVariables(jPoint, solution.GetSensor());
+    const Double eps2 = kappa2 * 0.5*(si+sj) * sc2;
+    const Double eps4 = max(0.0, kappa4-eps2) * sc4;
+
+    /*--- Update flux and Jacobians with dissipation terms. ---*/
+
+    const auto lapl_i = gatherVariables<nVar>(iPoint, solution.GetUndivided_Laplacian());
+    const auto lapl_j = gatherVariables<nVar>(jPoint, solution.GetUndivided_Laplacian());
+
+    VectorDbl<nVar> dissip;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dissip(iVar) = (eps2*diffV(iVar) - eps4*(lapl_i(iVar)-lapl_j(iVar))) * lambda;
     }
+
+    const Double coeff_i = fixFactor * (eps2 + eps4*(ni+1)) * lambda;
+    const Double coeff_j = fixFactor * (eps2 + eps4*(nj+1)) * lambda;
+
+    Base::preconditionedDissipation(precon, dissip, implicit, coeff_i, coeff_j, flux, jac_i, jac_j);
+  }
+};
+
+/*!
+ * \class CLaxIncScheme
+ * \brief Lax–Friedrichs 1st order scheme for incompressible flow.
+ */
+template<class Decorator>
+class CLaxIncScheme : public CCenteredIncBase<CLaxIncScheme<Decorator>,Decorator> {
+private:
+  using Base = CCenteredIncBase<CLaxIncScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::fixFactor;
+  const su2double kappa0;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CLaxIncScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    kappa0(config.GetKappa_1st_Flow()) {
+  }
+
+  /*!
+   * \brief Updates flux and Jacobians with 1st order (preconditioned) dissipation.
+   */
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j,
+                                bool implicit,
+                                Double lambda,
+                                const MatrixDbl<nVar>& precon,
+                                const VectorDbl<nVar>& diffV,
+                                Int iPoint,
+                                Int jPoint,
+                                const CGeometry& geometry,
+                                const CIncEulerVariable&) const {
+
+    const auto ni = numNeighbor(iPoint, geometry);
+    const auto nj = numNeighbor(jPoint, geometry);
+    const Double dissipCoeff = kappa0 * nDim * (ni+nj) / (ni*nj) * lambda;
+
+    VectorDbl<nVar> dissip;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dissip(iVar) = dissipCoeff * diffV(iVar);
+    }
+
+    const Double coeff = fixFactor * dissipCoeff;
+
+    Base::preconditionedDissipation(precon, dissip, implicit, coeff, coeff, flux, jac_i, jac_j);
   }
 };
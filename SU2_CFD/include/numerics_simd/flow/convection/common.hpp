@@ -27,6 +27,9 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+
 #include "../../CNumericsSIMD.hpp"
 #include "../../util.hpp"
 #include "../variables.hpp"
@@ -317,6 +320,52 @@ FORCEINLINE MatrixDbl<nDim+2> inviscidProjJac(Double gamma, RandomAccessIterator
   return jac;
 }
 
+/*!
+ * \brief Approximate Jacobians of an upwind flux (compressible flow, ideal gas),
+ * central part from the inviscid flux Jacobians plus the Roe dissipation matrix.
+ * \note Used by schemes that do not have (cheap) exact Jacobians, e.g. AUSM-type and HLLC.
+ */
+template<size_t nDim, class PrimVarType, class ConsVarType>
+FORCEINLINE void approximateRoeJacobians(Double gamma,
+                                         const CPair<PrimVarType>& V,
+                                         const CPair<ConsVarType>& U,
+                                         const VectorDbl<nDim>& normal,
+                                         Double area,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         MatrixDbl<nDim+2>& jac_i,
+                                         MatrixDbl<nDim+2>& jac_j) {
+  constexpr size_t nVar = nDim+2;
+
+  jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+  jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+  auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+  auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                      roeAvg.projVel, roeAvg.speedSound, unitNormal);
+  auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                            roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+  VectorDbl<nVar> lambda;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    lambda(iDim) = abs(roeAvg.projVel);
+  }
+  lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+  lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      Double projModJacTensor = 0.0;
+      for (size_t kVar = 0; kVar < nVar; ++kVar) {
+        projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+      }
+      const Double dDdU = 0.5 * projModJacTensor * area;
+      jac_i(iVar,jVar) += dDdU;
+      jac_j(iVar,jVar) -= dDdU;
+    }
+  }
+}
+
 /*!
  * \brief (Low) Dissipation coefficient for Roe schemes.
  */
@@ -388,6 +437,20 @@ FORCEINLINE Double correctedSpectralRadius(Int iPoint,
   return 4*phi_i*phi_j / (phi_i + phi_j) * avgLambda;
 }
 
+/*!
+ * \brief Number of neighbors of a point, special treatment needed to fetch integer data.
+ */
+template<class T, size_t N, class GeometryType>
+FORCEINLINE Double numNeighbor(simd::Array<T,N> idx, const GeometryType& geometry) {
+  Double n;
+  for (size_t k=0; k<N; ++k) n[k] = geometry.nodes->GetnNeighbor(idx[k]);
+  return n;
+}
+template<class GeometryType>
+FORCEINLINE Double numNeighbor(unsigned long idx, const GeometryType& geometry) {
+  return geometry.nodes->GetnNeighbor(idx);
+}
+
 /*!
  * \brief Update of a flux Jacobian due to a scalar dissipation term.
  */
@@ -409,3 +472,286 @@ FORCEINLINE void scalarDissipationJacobian(const VariableType& V,
     jac(nVar-1,0) += dissipConst * pow(V.velocity(iDim), 2);
   }
 }
+
+/*!
+ * \brief Inviscid projected flux, incompressible flow.
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE VectorDbl<nDim+2> incInviscidProjFlux(const PrimVarType& V,
+                                                  Double enthalpy,
+                                                  const VectorDbl<nDim>& normal) {
+  Double mdot = V.density() * dot(V.velocity(), normal);
+  VectorDbl<nDim+2> flux;
+  flux(0) = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    flux(iDim+1) = mdot*V.velocity(iDim) + V.pressure()*normal(iDim);
+  }
+  flux(nDim+1) = mdot * enthalpy;
+  return flux;
+}
+
+/*!
+ * \brief Jacobian of the inviscid projected flux w.r.t. the primitive
+ * variables (p, v, T), incompressible flow.
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incInviscidProjJac(const PrimVarType& V,
+                                                 Double cp,
+                                                 Double dRhodT,
+                                                 const VectorDbl<nDim>& normal,
+                                                 Double scale) {
+  const Double rho = V.density();
+  const Double projVel = dot(V.velocity(), normal);
+  const Double enthalpy = cp * V.temperature();
+  const Double invBeta2 = 1 / V.betaInc2();
+
+  MatrixDbl<nDim+2> jac;
+  jac(0,0) = scale * projVel * invBeta2;
+  jac(nDim+1,0) = scale * enthalpy * projVel * invBeta2;
+  jac(0,nDim+1) = scale * dRhodT * projVel;
+  jac(nDim+1,nDim+1) = scale * cp * (V.temperature()*dRhodT + rho) * projVel;
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    jac(0,iDim+1) = scale * rho * normal(iDim);
+    jac(iDim+1,0) = scale * (normal(iDim) + V.velocity(iDim)*projVel*invBeta2);
+    jac(nDim+1,iDim+1) = scale * enthalpy * rho * normal(iDim);
+    jac(iDim+1,nDim+1) = scale * dRhodT * V.velocity(iDim) * projVel;
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      jac(iDim+1,jDim+1) = scale * rho * normal(jDim) * V.velocity(iDim);
+    }
+    jac(iDim+1,iDim+1) += scale * rho * projVel;
+  }
+  return jac;
+}
+
+/*!
+ * \brief Low speed preconditioning matrix (transformation from primitive
+ * to conservative variables with artificial compressibility).
+ */
+template<class PrimVarType, size_t nDim = PrimVarType::nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditioner(const PrimVarType& V,
+                                                Double cp,
+                                                Double dRhodT) {
+  const Double rho = V.density();
+  const Double invBeta2 = 1 / V.betaInc2();
+
+  MatrixDbl<nDim+2> precon;
+  precon(0,0) = invBeta2;
+  precon(nDim+1,0) = cp * V.temperature() * invBeta2;
+  precon(0,nDim+1) = dRhodT;
+  precon(nDim+1,nDim+1) = cp * (dRhodT*V.temperature() + rho);
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    precon(iDim+1,0) = V.velocity(iDim) * invBeta2;
+    precon(0,iDim+1) = 0.0;
+    precon(nDim+1,iDim+1) = 0.0;
+    precon(iDim+1,nDim+1) = V.velocity(iDim) * dRhodT;
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      precon(iDim+1,jDim+1) = (iDim == jDim) ? rho : Double(0.0);
+    }
+  }
+  return precon;
+}
+
+/*!
+ * \brief Inverse of the preconditioner times the absolute value of the
+ * preconditioned projected Jacobian, incompressible flow.
+ * \note Equivalent to CNumerics::GetPreconditionedProjJac.
+ */
+template<size_t nDim>
+FORCEINLINE MatrixDbl<nDim+2> incPreconditionedProjJac(Double density,
+                                                       const VectorDbl<nDim+2>& lambda,
+                                                       Double betaInc2,
+                                                       const VectorDbl<nDim>& unitNormal) {
+  const Double sqrtBeta = sqrt(betaInc2);
+  const Double sumLambda = lambda(nDim) + lambda(nDim+1);
+  const Double diffLambda = lambda(nDim+1) - lambda(nDim);
+
+  MatrixDbl<nDim+2> mat;
+  mat(0,0) = 0.5 * sumLambda;
+  mat(nDim+1,0) = 0.0;
+  mat(0,nDim+1) = 0.0;
+  mat(nDim+1,nDim+1) = lambda(nDim-1);
+
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    mat(iDim+1,0) = 0.5 * unitNormal(iDim) * diffLambda / (sqrtBeta*density);
+    mat(0,iDim+1) = 0.5 * sqrtBeta * unitNormal(iDim) * density * diffLambda;
+    mat(nDim+1,iDim+1) = 0.0;
+    mat(iDim+1,nDim+1) = 0.0;
+
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      if (iDim == jDim) {
+        mat(iDim+1,jDim+1) = 0.5 * sumLambda * pow(unitNormal(iDim),2);
+        for (size_t kDim = 0; kDim < nDim; ++kDim) {
+          if (kDim != iDim) mat(iDim+1,jDim+1) += 2 * lambda(0) * pow(unitNormal(kDim),2);
+        }
+      } else {
+        mat(iDim+1,jDim+1) = 0.5 * unitNormal(iDim) * unitNormal(jDim) * (sumLambda - 2*lambda(0));
+      }
+    }
+  }
+  return mat;
+}
+
+/*!
+ * \brief Remove the contributions of the energy equation, when it is not solved.
+ */
+template<size_t nVar>
+FORCEINLINE void removeEnergyTerms(bool implicit,
+                                   VectorDbl<nVar>& flux,
+                                   MatrixDbl<nVar>& jac_i,
+                                   MatrixDbl<nVar>& jac_j) {
+  flux(nVar-1) = 0.0;
+  if (!implicit) return;
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    jac_i(iVar,nVar-1) = 0.0;
+    jac_j(iVar,nVar-1) = 0.0;
+    jac_i(nVar-1,iVar) = 0.0;
+    jac_j(nVar-1,iVar) = 0.0;
+  }
+}
+
+/*!
+ * \class CFrozenJacobianFlux
+ * \brief Records the inviscid part of a compressible edge flux as one AD external function instead of
+ * its operations (option FROZEN_CONV_JACOBIAN_DISC). The reverse sweep applies the flux Jacobians of the
+ * implicit system, chained with the derivatives of the conservative w.r.t. the primitive variables, i.e.
+ * the dependencies on gradients, limiters, sensors, and on the dissipation matrix are frozen. The
+ * Jacobians of the centered schemes are recorded without CENTRAL_JACOBIAN_FIX_FACTOR.
+ * \note Only used while the tape is recording the solution variables (passive geometry), otherwise the
+ * schemes use preaccumulation.
+ */
+template<size_t nDim>
+class CFrozenJacobianFlux {
+private:
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrim = nDim+4; /*!< \brief Temperature, velocity, pressure, density, enthalpy. */
+  using Data = std::array<passivedouble, Double::Size*2*nVar*nPrim>;
+
+  bool active = false;
+  bool wasActive = false;
+#ifdef CODI_REVERSE_TYPE
+  std::unique_ptr<AD::ExtFuncHelper> helper; /*!< \brief Only constructed for the edges that are recorded. */
+
+  /*!
+   * \brief Reverse sweep, x_b = (dF/dV)^T y_b for each SIMD lane and side of the edge.
+   */
+  static void reverse(const passivedouble*, passivedouble* x_b, size_t,
+                      const passivedouble*, const passivedouble* y_b, size_t,
+                      AD::CheckpointHandler* checkpoint) {
+    Data dFdV;
+    checkpoint->getDataByIndex(dFdV, 0);
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      for (size_t iSide = 0; iSide < 2; ++iSide) {
+        for (size_t iPrim = 0; iPrim < nPrim; ++iPrim) {
+          passivedouble sum = 0.0;
+          for (size_t iVar = 0; iVar < nVar; ++iVar) {
+            sum += y_b[k*nVar+iVar] * dFdV[((k*2+iSide)*nVar+iVar)*nPrim+iPrim];
+          }
+          x_b[(k*2+iSide)*nPrim+iPrim] = sum;
+        }
+      }
+    }
+  }
+#endif
+
+public:
+  /*!
+   * \brief Decide if the flux of the edges is recorded as an external function.
+   * \param[in] enabled - The option is set.
+   * \param[in] iEdge - The edges for flux computation.
+   * \param[in] normals - Edge normals, to detect the recording of the geometry.
+   */
+  template<class Container>
+  FORCEINLINE CFrozenJacobianFlux(bool enabled, Int iEdge, const Container& normals) {
+#ifdef CODI_REVERSE_TYPE
+    active = enabled && AD::TapeActive() && !normals(iEdge[0],0).isActive();
+    if (active) helper.reset(new AD::ExtFuncHelper(true));
+#endif
+  }
+
+  /*!
+   * \brief Whether the flux is recorded as an external function.
+   */
+  FORCEINLINE bool isActive() const { return active; }
+
+  /*!
+   * \brief Register the primitive variables of the points as inputs and stop recording.
+   * \param[in] V - Primitive variables of the points (not reconstructed).
+   */
+  template<class PrimVarType>
+  FORCEINLINE void begin(const CPair<PrimVarType>& V) {
+#ifdef CODI_REVERSE_TYPE
+    if (!active) return;
+    helper->disableInputPrimalStore();
+    helper->disableOutputPrimalStore();
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      for (const auto* Vk : {&V.i, &V.j}) {
+        for (size_t iPrim = 0; iPrim < nPrim; ++iPrim) helper->addInput(Vk->all(iPrim)[k]);
+      }
+    }
+    wasActive = AD::BeginPassive();
+#endif
+  }
+
+  /*!
+   * \brief Resume recording, register the flux as output and the Jacobians for the reverse sweep.
+   * \param[in] V - Primitive variables of the points, as passed to "begin".
+   * \param[in,out] flux - Inviscid flux, becomes active.
+   * \param[in] jac_i - Jacobian w.r.t. the conservative variables of iPoint.
+   * \param[in] jac_j - Jacobian w.r.t. the conservative variables of jPoint.
+   * \param[in] viscous - Start preaccumulation for the viscous terms, that are added to the flux.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void end(const CPair<PrimVarType>& V,
+                       VectorDbl<nVar>& flux,
+                       const MatrixDbl<nVar>& jac_i,
+                       const MatrixDbl<nVar>& jac_j,
+                       bool viscous) {
+#ifdef CODI_REVERSE_TYPE
+    if (!active) return;
+    AD::EndPassive(wasActive);
+
+    /*--- dU/dV for U = (rho, rho*vel, rho*h-p) and V = (T, vel, p, rho, h). ---*/
+
+    Data dFdV;
+    for (size_t k = 0; k < Double::Size; ++k) {
+      for (size_t iSide = 0; iSide < 2; ++iSide) {
+        const auto& Vk = iSide? V.j : V.i;
+        const auto& jac = iSide? jac_j : jac_i;
+        const auto rho = SU2_TYPE::GetValue(Vk.density()[k]);
+
+        for (size_t iVar = 0; iVar < nVar; ++iVar) {
+          auto* row = &dFdV[((k*2+iSide)*nVar+iVar)*nPrim];
+          const auto dFdE = SU2_TYPE::GetValue(jac(iVar,nDim+1)[k]);
+
+          row[0] = 0.0;
+          row[nDim+1] = -dFdE;
+          row[nDim+2] = SU2_TYPE::GetValue(jac(iVar,0)[k]) + dFdE * SU2_TYPE::GetValue(Vk.enthalpy()[k]);
+          row[nDim+3] = dFdE * rho;
+          for (size_t iDim = 0; iDim < nDim; ++iDim) {
+            const auto dFdM = SU2_TYPE::GetValue(jac(iVar,iDim+1)[k]);
+            row[iDim+1] = dFdM * rho;
+            row[nDim+2] += dFdM * SU2_TYPE::GetValue(Vk.velocity(iDim)[k]);
+          }
+        }
+      }
+    }
+
+    for (size_t k = 0; k < Double::Size; ++k) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) helper->addOutput(flux(iVar)[k]);
+    }
+    helper->addUserData(dFdV);
+    helper->addToTape(reverse);
+
+    if (viscous) {
+      AD::StartPreacc();
+      AD::SetPreaccIn(V.i.all, PrimVarType::nVar, Double::Size);
+      AD::SetPreaccIn(V.j.all, PrimVarType::nVar, Double::Size);
+      AD::SetPreaccIn(flux, nVar, Double::Size);
+    }
+#endif
+  }
+};
@@ -0,0 +1,275 @@
+/*!
+ * \file fds.hpp
+ * \brief Flux difference splitting (FDS) scheme for incompressible flow.
+ * \author P. Gomes, T. Economon
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CIncEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CFDSIncScheme
+ * \brief Preconditioned flux difference splitting scheme for incompressible flow,
+ * with the artificial compressibility formulation (see CUpwFDSInc_Flow).
+ */
+template<class Decorator>
+class CFDSIncScheme : public Decorator {
+protected:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = nDim+2;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nDim+8);
+
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool variableDensity;
+  const bool energy;
+  const ENUM_LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CFDSIncScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    variableDensity(config.GetKind_DensityModel() == INC_DENSITYMODEL::VARIABLE),
+    energy(config.GetEnergy_Equation()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+protected:
+  /*!
+   * \brief Implementation of the preconditioned FDS flux.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
+   */
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CIncEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties, for the dissipation matrix small components
+     *    of the unit normal are clipped to EPS as in the scalar implementation. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal, clippedNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+      const Double small = abs(unitNormal(iDim)) < EPS;
+      clippedNormal(iDim) = small*EPS + (1-small)*unitNormal(iDim);
+    }
+
+    /*--- Reconstructed primitives, cp is not reconstructed. ---*/
+
+    CPair<CIncompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CIncompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Check for non-physical reconstructions (negative temperature or density),
+     *    the lanes where they occur use the cell-average values (first order) as
+     *    in CIncEulerSolver::Upwind_Residual. The pressure is the dynamic pressure
+     *    and therefore it is not checked. As in the legacy scheme the point flags
+     *    are updated, which keeps the points flagged in previous iterations first
+     *    order, the padding lanes (zero mask) are not used to update the flags. ---*/
+
+    if (muscl && energy) {
+      Double nonPhys_i = max(Double(V.i.temperature() < 0.0), Double(V.i.density() < 0.0));
+      Double nonPhys_j = max(Double(V.j.temperature() < 0.0), Double(V.j.density() < 0.0));
+      for (size_t k = 0; k < Double::Size; ++k) {
+        if (updateMask[k] == 0.0) continue;
+        solution.SetNon_Physical(iPoint[k], nonPhys_i[k] != 0.0);
+        solution.SetNon_Physical(jPoint[k], nonPhys_j[k] != 0.0);
+        nonPhys_i[k] = solution.GetNon_Physical(iPoint[k]);
+        nonPhys_j[k] = solution.GetNon_Physical(jPoint[k]);
+      }
+      for (size_t iVar = 0; iVar < nPrimVarGrad; ++iVar) {
+        V.i.all(iVar) += nonPhys_i * (V1st.i.all(iVar) - V.i.all(iVar));
+        V.j.all(iVar) += nonPhys_j * (V1st.j.all(iVar) - V.j.all(iVar));
+      }
+    }
+
+    const Double cp_i = V1st.i.cp(), cp_j = V1st.j.cp();
+
+    /*--- Mean state and density derivatives (ideal gas law for variable density). ---*/
+
+    CIncompressiblePrimitives<nDim,nPrimVarGrad> avgV;
+    for (size_t iVar = 0; iVar < nPrimVarGrad; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+    const Double avgCp = 0.5 * (cp_i + cp_j);
+
+    Double dRhodT_i = 0.0, dRhodT_j = 0.0, avgdRhodT = 0.0;
+    if (variableDensity) {
+      dRhodT_i = -V.i.density() / V.i.temperature();
+      dRhodT_j = -V.j.density() / V.j.temperature();
+      avgdRhodT = -avgV.density() / avgV.temperature();
+    }
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+
+    /*--- Eigenvalues of the preconditioned system (times area). ---*/
+
+    const Double projVel = dot(avgV.velocity(), normal) - projGridVel;
+    const Double soundSpeed = sqrt(avgV.betaInc2()) * area;
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(projVel);
+    }
+    lambda(nDim) = abs(projVel - soundSpeed);
+    lambda(nDim+1) = abs(projVel + soundSpeed);
+
+    /*--- Preconditioner and |A_precon| = P x |Lambda| x inv(P). ---*/
+
+    const auto precon = incPreconditioner(avgV, avgCp, avgdRhodT);
+    const auto invPreconA = incPreconditionedProjJac(avgV.density(), lambda, avgV.betaInc2(), clippedNormal);
+
+    MatrixDbl<nVar> dissip;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        dissip(iVar,jVar) = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          dissip(iVar,jVar) += precon(iVar,kVar) * invPreconA(kVar,jVar);
+        }
+        dissip(iVar,jVar) *= 0.5;
+      }
+    }
+
+    /*--- Flux, average of left and right fluxes minus dissipation, the primitive
+     *    variables of the incompressible solver are (p, v, T), i.e. the first nVar. ---*/
+
+    const auto flux_i = incInviscidProjFlux(V.i, cp_i*V.i.temperature(), normal);
+    const auto flux_j = incInviscidProjFlux(V.j, cp_j*V.j.temperature(), normal);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = 0.5 * (flux_i(iVar) + flux_j(iVar));
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        flux(iVar) -= dissip(iVar,jVar) * (V.j.all(jVar) - V.i.all(jVar));
+      }
+    }
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = incInviscidProjJac(V.i, cp_i, dRhodT_i, normal, 0.5);
+      jac_j = incInviscidProjJac(V.j, cp_j, dRhodT_j, normal, 0.5);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) += dissip(iVar,jVar);
+          jac_j(iVar,jVar) -= dissip(iVar,jVar);
+        }
+      }
+    }
+
+    /*--- Correct for grid motion, the conservative variables are (rho, rho v, rho cp T). ---*/
+
+    if (dynamicGrid) {
+      flux(0) -= projGridVel * 0.5*(V.i.density() + V.j.density());
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        flux(iDim+1) -= projGridVel * 0.5*(V.i.density()*V.i.velocity(iDim) +
+                                           V.j.density()*V.j.velocity(iDim));
+      }
+      flux(nDim+1) -= projGridVel * 0.5*(V.i.density()*cp_i*V.i.temperature() +
+                                         V.j.density()*cp_j*V.j.temperature());
+      if (implicit) {
+        for (size_t iDim = 0; iDim < nDim; ++iDim) {
+          jac_i(iDim+1,iDim+1) -= 0.5 * projGridVel * V.i.density();
+          jac_j(iDim+1,iDim+1) -= 0.5 * projGridVel * V.j.density();
+        }
+        jac_i(nDim+1,nDim+1) -= 0.5 * projGridVel * V.i.density() * cp_i;
+        jac_j(nDim+1,nDim+1) -= 0.5 * projGridVel * V.j.density() * cp_j;
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    if (!energy) removeEnergyTerms(implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
+};
@@ -0,0 +1,256 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \author P. Gomes, G. Gori, F. Palacios
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \brief HLLC scheme (Toro, Spruce, and Speares, Shock Waves 1994), ideal gas.
+ * \note The four states of the Riemann fan are evaluated for all SIMD lanes and then
+ * blended, the Jacobians are approximated with those of the Roe scheme.
+ */
+template<class Base>
+class CHLLCScheme : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const ENUM_LIMITER typeLimiter;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
+  }
+
+protected:
+  /*!
+   * \brief Inviscid flux and Jacobians between the states V.i and V.j, used for
+   * edges and for boundaries (where V.j is the ghost state and jPoint = iPoint).
+   */
+  template<class PrimVarType>
+  FORCEINLINE void inviscidFlux(const CPair<PrimVarType>& V,
+                                const VectorDbl<nDim>& normal,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                Double projGridVel,
+                                Int, Int,
+                                const CEulerVariable&,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    /*--- Speeds of sound and projected velocities, corrected for grid motion. ---*/
+
+    Double c_i = sqrt((gamma-1) * (V.i.enthalpy() - 0.5*squaredNorm<nDim>(V.i.velocity())));
+    Double c_j = sqrt((gamma-1) * (V.j.enthalpy() - 0.5*squaredNorm<nDim>(V.j.velocity())));
+
+    Double projVel_i = dot(V.i.velocity(), unitNormal);
+    Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    if (dynamicGrid) {
+      c_i -= projGridVel;
+      c_j += projGridVel;
+      projVel_i -= projGridVel;
+      projVel_j -= projGridVel;
+    }
+
+    /*--- Roe averaged variables and wave speed estimates. ---*/
+
+    const auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+    const Double roeProjVel = roeAvg.projVel - projGridVel;
+    const Double roeSpeedSound = roeAvg.speedSound - projGridVel;
+
+    const Double sL = min(roeProjVel - roeSpeedSound, Double(projVel_i - c_i));
+    const Double sR = max(roeProjVel + roeSpeedSound, Double(projVel_j + c_j));
+
+    /*--- Speed of the contact surface and pressure on both sides of it. ---*/
+
+    const Double rho_i = V.i.density(), rho_j = V.j.density();
+    const Double p_i = V.i.pressure(), p_j = V.j.pressure();
+
+    const Double RHO = rho_j*(sR-projVel_j) - rho_i*(sL-projVel_i);
+    const Double sM = (p_i - p_j - rho_i*projVel_i*(sL-projVel_i) + rho_j*projVel_j*(sR-projVel_j)) / RHO;
+    const Double pStar = rho_j*(projVel_j-sR)*(projVel_j-sM) + p_j;
+
+    /*--- Left/right fluxes and fluxes from the left/right star states. ---*/
+
+    const auto starFlux = [&](const Double& s, const Double& projVel, const Double& p,
+                              const CCompressibleConservatives<nDim>& Ucons, size_t iVar) {
+      const Double rhoS = (s-projVel) / (s-sM);
+      Double Ustar;
+      if (iVar == 0) Ustar = rhoS * Ucons.density();
+      else if (iVar < nVar-1) Ustar = rhoS * (Ucons.momentum(iVar-1) + (pStar-p)/(s-projVel)*unitNormal(iVar-1));
+      else Ustar = rhoS * (Ucons.rhoEnergy() - (p*projVel - pStar*sM)/(s-projVel));
+
+      Double F = sM * Ustar;
+      if (iVar > 0 && iVar < nVar-1) F += pStar * unitNormal(iVar-1);
+      if (iVar == nVar-1) F += sM * pStar + pStar * projGridVel;
+      return F;
+    };
+
+    const auto fullFlux = [&](const Double& projVel, const Double& p,
+                              const CCompressibleConservatives<nDim>& Ucons, size_t iVar) {
+      Double F = projVel * (iVar < nVar-1 ? Ucons.all(iVar) : Ucons.rhoEnergy()+p);
+      if (iVar > 0 && iVar < nVar-1) F += p * unitNormal(iVar-1);
+      return F;
+    };
+
+    const Double useLeft = sM > 0.0;
+    const Double supL = sL > 0.0;
+    const Double supR = sR < 0.0;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double fluxL = supL * fullFlux(projVel_i, p_i, U.i, iVar) +
+                           (1-supL) * starFlux(sL, projVel_i, p_i, U.i, iVar);
+      const Double fluxR = supR * fullFlux(projVel_j, p_j, U.j, iVar) +
+                           (1-supR) * starFlux(sR, projVel_j, p_j, U.j, iVar);
+      flux(iVar) = area * (useLeft * fluxL + (1-useLeft) * fluxR);
+    }
+
+    /*--- Approximate Jacobians. ---*/
+
+    if (implicit) {
+      approximateRoeJacobians(gamma, V, U, normal, area, unitNormal, jac_i, jac_j);
+    }
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
+   */
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+    }
+
+    /*--- Inviscid flux and Jacobians. ---*/
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    inviscidFlux(V, normal, area, unitNormal, projGridVel, iPoint, jPoint,
+                 solution, implicit, flux, jac_i, jac_j);
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
+};
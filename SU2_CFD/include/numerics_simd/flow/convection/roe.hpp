@@ -59,6 +59,7 @@ protected:
   const bool finestGrid;
   const bool dynamicGrid;
   const bool muscl;
+  const bool frozenJacobian;
   const ENUM_LIMITER typeLimiter;
 
   /*!
@@ -72,51 +73,27 @@ protected:
     finestGrid(iMesh == MESH_0),
     dynamicGrid(config.GetDynamic_Grid()),
     muscl(finestGrid && config.GetMUSCL_Flow()),
+    frozenJacobian(config.GetFrozen_ConvJac_Disc()),
     typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())) {
   }
 
-public:
   /*!
-   * \brief Implementation of the base Roe flux.
+   * \brief Inviscid flux and Jacobians between the states V.i and V.j, used for
+   * edges and for boundaries (where V.j is the ghost state and jPoint = iPoint).
    */
-  void ComputeFlux(Int iEdge,
-                   const CConfig& config,
-                   const CGeometry& geometry,
-                   const CVariable& solution_,
-                   UpdateType updateType,
-                   Double updateMask,
-                   CSysVector<su2double>& vector,
-                   SparseMatrixType& matrix) const final {
-
-    /*--- Start preaccumulation, inputs are registered
-     *    automatically in "gatherVariables". ---*/
-    AD::StartPreacc();
-
-    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
-    const auto& solution = static_cast<const CEulerVariable&>(solution_);
-
-    const auto iPoint = geometry.edges->GetNode(iEdge,0);
-    const auto jPoint = geometry.edges->GetNode(iEdge,1);
-
-    /*--- Geometric properties. ---*/
-
-    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
-
-    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
-    const auto area = norm(normal);
-    VectorDbl<nDim> unitNormal;
-    for (size_t iDim = 0; iDim < nDim; ++iDim) {
-      unitNormal(iDim) = normal(iDim) / area;
-    }
-
-    /*--- Reconstructed primitives. ---*/
-
-    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
-    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
-    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
-
-    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
-                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+  template<class PrimVarType>
+  FORCEINLINE void inviscidFlux(const CPair<PrimVarType>& V,
+                                const VectorDbl<nDim>& normal,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                Double projGridVel,
+                                Int iPoint,
+                                Int jPoint,
+                                const CEulerVariable& solution,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
 
     /*--- Compute conservative variables. ---*/
 
@@ -135,13 +112,7 @@ public:
 
     /*--- Grid motion. ---*/
 
-    Double projGridVel = 0.0, projVel = roeAvg.projVel;
-    if (dynamicGrid) {
-      const auto& gridVel = geometry.nodes->GetGridVel();
-      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
-                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
-      projVel -= projGridVel;
-    }
+    const Double projVel = roeAvg.projVel - projGridVel;
 
     /*--- Convective eigenvalues. ---*/
 
@@ -165,12 +136,10 @@ public:
     auto flux_i = inviscidProjFlux(V.i, U.i, normal);
     auto flux_j = inviscidProjFlux(V.j, U.j, normal);
 
-    VectorDbl<nVar> flux;
     for (size_t iVar = 0; iVar < nVar; ++iVar) {
       flux(iVar) = kappa * (flux_i(iVar) + flux_j(iVar));
     }
 
-    MatrixDbl<nVar> jac_i, jac_j;
     if (implicit) {
       jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, kappa);
       jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, kappa);
@@ -196,6 +165,72 @@ public:
 
     derived->finalizeFlux(flux, jac_i, jac_j, implicit, area, unitNormal, V,
                           U, roeAvg, lambda, pMat, iPoint, jPoint, solution);
+  }
+
+  /*!
+   * \brief Implementation of the base Roe flux.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
+   */
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const {
+
+    /*--- Start preaccumulation, inputs are registered automatically in "gatherVariables",
+     *    unless the inviscid flux is recorded as an external function. ---*/
+    CFrozenJacobianFlux<nDim> extFunc(frozenJacobian, iEdge, geometry.edges->GetNormal());
+    if (!extFunc.isActive()) AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    extFunc.begin(V1st);
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+    }
+
+    /*--- Inviscid flux and Jacobians. ---*/
+
+    VectorDbl<nVar> flux;
+    MatrixDbl<nVar> jac_i, jac_j;
+    inviscidFlux(V, normal, area, unitNormal, projGridVel, iPoint, jPoint,
+                 solution, implicit, flux, jac_i, jac_j);
+
+    extFunc.end(V1st, flux, jac_i, jac_j, Base::nPrimVar > 0);
 
     /*--- Add the contributions from the base class (static decorator). ---*/
 
@@ -211,6 +246,21 @@ public:
     updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
                        updateMask, flux, jac_i, jac_j, vector, matrix);
   }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
 };
 
 /*!
@@ -295,3 +345,109 @@ public:
     }
   }
 };
+
+/*!
+ * \class CLowMachRoeScheme
+ * \brief Low-Mach variants of the Roe scheme, the velocity jumps of the
+ * characteristic amplitudes are scaled by a clamped local Mach number.
+ * \note With ScaleShear=true this is L2Roe (Oßwald et al., IJNMF 2015), otherwise
+ * LMRoe (Rieper, JCP 2011). The Jacobians of the standard Roe scheme are used.
+ */
+template<class Decorator, bool ScaleShear>
+class CLowMachRoeScheme : public CRoeBase<CLowMachRoeScheme<Decorator,ScaleShear>,Decorator> {
+private:
+  using Base = CRoeBase<CLowMachRoeScheme<Decorator,ScaleShear>,Decorator>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::gamma;
+  using Base::kappa;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CLowMachRoeScheme(const CConfig& config, Ts&... args) : Base(config, args...) {}
+
+  /*!
+   * \brief Updates flux and Jacobians with low-Mach Roe dissipation.
+   */
+  template<class PrimVarType, class ConsVarType, class... Ts>
+  FORCEINLINE void finalizeFlux(VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j,
+                                bool implicit,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                const CPair<PrimVarType>& V,
+                                const CPair<ConsVarType>& U,
+                                const CRoeVariables<nDim>& roeAvg,
+                                const VectorDbl<nVar>& lambda,
+                                const MatrixDbl<nVar>& pMat,
+                                Int iPoint,
+                                Int jPoint,
+                                const CEulerVariable& solution,
+                                Ts&...) const {
+    /*--- Clamped Mach number. ---*/
+
+    const Double M_i = sqrt(squaredNorm<nDim>(V.i.velocity()) / abs(gamma*V.i.pressure()/V.i.density()));
+    const Double M_j = sqrt(squaredNorm<nDim>(V.j.velocity()) / abs(gamma*V.j.pressure()/V.j.density()));
+    const Double zeta = max(0.05, min(max(M_i, M_j), 1.0));
+    const Double zetaShear = ScaleShear? zeta : Double(1.0);
+
+    /*--- Wave amplitudes (characteristics). ---*/
+
+    VectorDbl<nDim> deltaVel;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      deltaVel(iDim) = V.j.velocity(iDim) - V.i.velocity(iDim);
+    }
+    const Double projDeltaVel = zeta * dot(deltaVel, unitNormal);
+    const Double deltaP = V.j.pressure() - V.i.pressure();
+    const Double deltaRho = V.j.density() - V.i.density();
+    const Double rhoC = roeAvg.density * roeAvg.speedSound;
+
+    VectorDbl<nVar> deltaWave;
+    deltaWave(0) = deltaRho - deltaP / pow(roeAvg.speedSound, 2);
+    if (nDim == 2) {
+      deltaWave(1) = (unitNormal(1)*deltaVel(0) - unitNormal(0)*deltaVel(1)) * zetaShear;
+    } else {
+      deltaWave(1) = (unitNormal(0)*deltaVel(nDim-1) - unitNormal(nDim-1)*deltaVel(0)) * zetaShear;
+      deltaWave(2) = (unitNormal(1)*deltaVel(0) - unitNormal(0)*deltaVel(1)) * zetaShear;
+    }
+    deltaWave(nDim) = projDeltaVel + deltaP / rhoC;
+    deltaWave(nDim+1) = -projDeltaVel + deltaP / rhoC;
+
+    /*--- Update flux. ---*/
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t kVar = 0; kVar < nVar; ++kVar) {
+        flux(iVar) -= (1-kappa) * area * lambda(kVar) * deltaWave(kVar) * pMat(iVar,kVar);
+      }
+    }
+
+    if (!implicit) return;
+
+    /*--- Approximate the Jacobians with those of the standard Roe scheme. ---*/
+
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        const Double dDdU = projModJacTensor * (1-kappa) * area;
+        jac_i(iVar,jVar) += dDdU;
+        jac_j(iVar,jVar) -= dDdU;
+      }
+    }
+  }
+};
+
+template<class Decorator>
+using CL2RoeScheme = CLowMachRoeScheme<Decorator,true>;
+
+template<class Decorator>
+using CLMRoeScheme = CLowMachRoeScheme<Decorator,false>;
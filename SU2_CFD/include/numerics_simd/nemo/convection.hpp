@@ -0,0 +1,503 @@
+/*!
+ * \file convection.hpp
+ * \brief AUSM-family convective fluxes of thermochemical non-equilibrium flows.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "variables.hpp"
+#include "../flow/convection/common.hpp"
+#include "../../variables/CNEMOEulerVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief Returns 1 for the lanes where the reconstructed state is not physical,
+ * the criteria are those of CNEMOEulerSolver::CheckNonPhys.
+ */
+template<class PrimVarType>
+FORCEINLINE Double nonPhysicalNEMO(const PrimVarType& V) {
+  constexpr passivedouble Tmin = 50.0, Tmax = 8e4;
+
+  Double nonPhys = V.pressure() < 0.0;
+  nonPhys = max(nonPhys, Double(V.speedSound() < 0.0));
+  nonPhys = max(nonPhys, Double(V.temperature() < Tmin));
+  nonPhys = max(nonPhys, Double(V.temperature() > Tmax));
+  nonPhys = max(nonPhys, Double(V.temperatureVe() < Tmin));
+  nonPhys = max(nonPhys, Double(V.temperatureVe() > Tmax));
+  for (size_t iSpecies = 0; iSpecies < PrimVarType::nSpecies; ++iSpecies) {
+    nonPhys = max(nonPhys, Double(V.partialDensity(iSpecies) < 0.0));
+  }
+  return nonPhys;
+}
+
+/*!
+ * \brief Convective vector of the AUSM schemes, [rho_s, rho u, rho h, rho e_ve] times "a".
+ */
+template<size_t nVar, class PrimVarType>
+FORCEINLINE VectorDbl<nVar> convectiveVectorNEMO(const PrimVarType& V,
+                                                 const VectorDbl<PrimVarType::nSpecies>& eve,
+                                                 Double a) {
+  constexpr size_t nSpecies = PrimVarType::nSpecies;
+  constexpr size_t nDim = PrimVarType::nDim;
+
+  VectorDbl<nVar> Fc;
+  Double rhoEve = 0.0;
+  for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+    Fc(iSpecies) = V.partialDensity(iSpecies) * a;
+    rhoEve += V.partialDensity(iSpecies) * eve(iSpecies);
+  }
+  const Double rhoA = V.density() * a;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    Fc(nSpecies+iDim) = rhoA * V.velocity(iDim);
+  }
+  Fc(nSpecies+nDim) = rhoA * V.enthalpy();
+  Fc(nSpecies+nDim+1) = rhoEve * a;
+  return Fc;
+}
+
+/*!
+ * \brief Mach numbers, sound speeds, and split mass and pressure fluxes of the AUSM schemes.
+ */
+struct CNEMOAUSMSplitting {
+  Double aL, aR, mL, mR, mF, pF;
+};
+
+/*!
+ * \brief Add the Jacobian of the AUSM flux w.r.t. the conservatives of one side of
+ * the face, this is the Jacobian of the legacy classes (CUpwAUSM_NEMO) with the branches
+ * replaced by masks. Derivatives of the sound speed are approximate (frozen dP/dU).
+ * \param[in] sign - +1 for the left (i) side, -1 for the right (j) side.
+ * \param[in] upwind - Mask for the lanes where this side is upwind (mass flux terms).
+ * \param[in] split - Mask for the lanes where the split pressure flux is differentiated.
+ */
+template<size_t nVar, class PrimVarType>
+FORCEINLINE void ausmJacobianNEMO(passivedouble sign,
+                                  Double m,
+                                  Double mF,
+                                  Double a,
+                                  Double projVel,
+                                  Double upwind,
+                                  Double split,
+                                  const PrimVarType& V,
+                                  const VectorDbl<nVar>& dPdU,
+                                  const VectorDbl<nVar>& Fc,
+                                  const VectorDbl<nVar>& FcLR,
+                                  const VectorDbl<PrimVarType::nDim>& unitNormal,
+                                  const CNEMOSpeciesConstants<PrimVarType::nSpecies>& species,
+                                  MatrixDbl<nVar>& jac) {
+  constexpr size_t nSpecies = PrimVarType::nSpecies;
+  constexpr size_t nDim = PrimVarType::nDim;
+  constexpr size_t iEnergy = nSpecies+nDim;
+
+  const Double rho = V.density();
+  const Double P = V.pressure();
+  const Double dPdE = dPdU(iEnergy);
+
+  /*--- Pressure, sound speed, and Mach number derivatives. ---*/
+
+  VectorDbl<nVar> dP, da, dM;
+  for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+    dP(iSpecies) = dPdU(iSpecies);
+    da(iSpecies) = 0.5/a * ((species.gasConst[iSpecies] - species.cvtr[iSpecies]*dPdE) * P / (rho*V.rhoCvtr()) +
+                            (1+dPdE) * (dPdU(iSpecies) - P/rho) / rho);
+  }
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dP(nSpecies+iDim) = -V.velocity(iDim) * dPdE;
+  }
+  dP(iEnergy) = dPdE;
+  dP(iEnergy+1) = dPdU(iEnergy+1);
+
+  const Double k = 0.5 * (1+dPdE) / (rho*a);
+  for (size_t iVar = nSpecies; iVar < nVar; ++iVar) {
+    da(iVar) = k * dP(iVar);
+  }
+
+  const Double velOnA2 = projVel / (a*a);
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    dM(iVar) = -velOnA2 * da(iVar);
+  }
+  for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+    dM(iSpecies) -= projVel / (rho*a);
+  }
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    dM(nSpecies+iDim) += unitNormal(iDim) / (rho*a);
+  }
+
+  /*--- Mass flux terms of the upwind side. ---*/
+
+  const Double mFu = upwind * mF;
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    const Double FcOnA = mFu * Fc(iVar) / a;
+    for (size_t jVar = 0; jVar < nVar; ++jVar) {
+      jac(iVar,jVar) += FcOnA * da(jVar);
+    }
+    jac(iVar,iVar) += mFu * a;
+  }
+  for (size_t jVar = 0; jVar < nVar; ++jVar) {
+    jac(iEnergy,jVar) += mFu * a * dP(jVar);
+  }
+
+  /*--- Split Mach number and pressure, polynomial (subsonic) or upwind. ---*/
+
+  const Double sub = abs(m) <= 1.0;
+  const Double mS = m + sign;
+  const Double dmSub = 0.5 * sign * mS;
+  const Double dpSub1 = 0.25 * mS * mS * (2 - sign*m);
+  const Double dpSub2 = 0.25 * mS * P * (3 - 3*sign*m);
+
+  for (size_t jVar = 0; jVar < nVar; ++jVar) {
+    const Double dm = split * (sub * dmSub * dM(jVar) + (1-sub) * dM(jVar));
+    const Double dp = split * (sub * (dpSub1 * dP(jVar) + dpSub2 * dM(jVar)) + (1-sub) * dP(jVar));
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac(iVar,jVar) += dm * FcLR(iVar);
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac(nSpecies+iDim,jVar) += dp * unitNormal(iDim);
+    }
+  }
+}
+
+/*!
+ * \class CNEMOAUSMBase
+ * \brief Base class for the AUSM schemes of NEMO flows, derived classes implement the
+ * splitting of the face Mach number and pressure in a const "machSplitting" method.
+ * The mixture properties of all lanes are evaluated here, from the species constants
+ * of the fluid model, the species count is a template parameter of the decorator.
+ * \note The base class is a decorator implementing "viscousTerms", see CNEMOViscousFlux.
+ */
+template<class Derived, class Base>
+class CNEMOAUSMBase : public Base {
+protected:
+  using Base::nDim;
+  using Base::nSpecies;
+  static constexpr size_t nVar = nSpecies+nDim+2;
+  static constexpr size_t nPrimVarGrad = nSpecies+nDim+8;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const bool finestGrid;
+  const bool muscl;
+  const ENUM_LIMITER typeLimiter;
+  const CNEMOSpeciesConstants<nSpecies> species;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CNEMOAUSMBase(const CConfig& config, unsigned iMesh, CNEMOGas* fluidModel, Ts&... args) :
+    Base(config, iMesh, fluidModel, args...),
+    finestGrid(iMesh == MESH_0),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(static_cast<ENUM_LIMITER>(config.GetKind_SlopeLimit_Flow())),
+    species(fluidModel) {
+  }
+
+  /*!
+   * \brief Implementation of the AUSM flux and its Jacobians.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
+   */
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CNEMOEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives, lanes with non-physical
+     *    reconstructions revert to first order. ---*/
+
+    CPair<CNEMOPrimitives<nSpecies,nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CNEMOPrimitives<nSpecies,nDim,nPrimVarGrad> >(
+                  iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    if (muscl) {
+      const Double nonPhys_i = nonPhysicalNEMO(V.i);
+      const Double nonPhys_j = nonPhysicalNEMO(V.j);
+      for (size_t iVar = 0; iVar < nPrimVarGrad; ++iVar) {
+        V.i.all(iVar) += nonPhys_i * (V1st.i.all(iVar) - V.i.all(iVar));
+        V.j.all(iVar) += nonPhys_j * (V1st.j.all(iVar) - V.j.all(iVar));
+      }
+    }
+
+    CPair<VectorDbl<nSpecies> > eve;
+    eve.i = reconstructedEve<nSpecies>(iPoint, muscl, V1st.i, V.i, solution);
+    eve.j = reconstructedEve<nSpecies>(jPoint, muscl, V1st.j, V.j, solution);
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Split Mach numbers and pressure from derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+    const auto s = derived->machSplitting(V, projVel_i, projVel_j, iPoint, jPoint, solution);
+
+    /*--- Assemble the flux. ---*/
+
+    const auto FcL = convectiveVectorNEMO<nVar>(V.i, eve.i, s.aL);
+    const auto FcR = convectiveVectorNEMO<nVar>(V.j, eve.j, s.aR);
+
+    const Double mFP = 0.5 * (s.mF + abs(s.mF));
+    const Double mFM = 0.5 * (s.mF - abs(s.mF));
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = mFP * FcL(iVar) + mFM * FcR(iVar);
+    }
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(nSpecies+iDim) += s.pF * unitNormal(iDim);
+    }
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) *= area;
+    }
+
+    /*--- Jacobians, with the node values of dP/dU. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      const Double upwindL = s.mF >= 0.0;
+      const Double upwindR = 1 - upwindL;
+      const Double subF = abs(s.mF) <= 1.0;
+
+      VectorDbl<nVar> FcLR;
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        FcLR(iVar) = upwindL * FcL(iVar) + upwindR * FcR(iVar);
+      }
+
+      jac_i = Double(0.0);
+      jac_j = Double(0.0);
+
+      ausmJacobianNEMO(1.0, s.mL, s.mF, s.aL, projVel_i, upwindL, max(upwindL, subF), V.i,
+                       gatherVariables<nVar>(iPoint, solution.GetdPdU()), FcL, FcLR, unitNormal, species, jac_i);
+      ausmJacobianNEMO(-1.0, s.mR, s.mF, s.aR, projVel_j, upwindR, max(upwindR, subF), V.j,
+                       gatherVariables<nVar>(jPoint, solution.GetdPdU()), FcR, FcLR, unitNormal, species, jac_j);
+
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        for (size_t jVar = 0; jVar < nVar; ++jVar) {
+          jac_i(iVar,jVar) *= area;
+          jac_j(iVar,jVar) *= area;
+        }
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
+};
+
+/*!
+ * \class CNEMOAUSMScheme
+ * \brief AUSM scheme (Liou and Steffen, 1993) for NEMO flows.
+ */
+template<class Decorator>
+class CNEMOAUSMScheme : public CNEMOAUSMBase<CNEMOAUSMScheme<Decorator>,Decorator> {
+private:
+  using Base = CNEMOAUSMBase<CNEMOAUSMScheme<Decorator>,Decorator>;
+
+public:
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CNEMOAUSMScheme(Ts&... args) : Base(args...) {}
+
+  /*!
+   * \brief Mach number and pressure splitting of AUSM, the supersonic
+   * pressure splitting is written without division by the Mach number.
+   */
+  template<class PrimVarType, class VariableType>
+  FORCEINLINE CNEMOAUSMSplitting machSplitting(const CPair<PrimVarType>& V,
+                                               Double projVel_i,
+                                               Double projVel_j,
+                                               Int, Int, const VariableType&) const {
+    CNEMOAUSMSplitting s;
+    s.aL = V.i.speedSound();
+    s.aR = V.j.speedSound();
+    s.mL = projVel_i / s.aL;
+    s.mR = projVel_j / s.aR;
+
+    const Double subL = abs(s.mL) <= 1.0;
+    const Double subR = abs(s.mR) <= 1.0;
+
+    const Double p1 = 0.25*pow(s.mL+1, 2);
+    const Double p2 = 0.25*pow(s.mR-1, 2);
+
+    s.mF = subL * p1 + (1-subL) * 0.5*(s.mL+abs(s.mL)) -
+           subR * p2 + (1-subR) * 0.5*(s.mR-abs(s.mR));
+
+    s.pF = V.i.pressure() * (subL * p1*(2-s.mL) + (1-subL) * (s.mL > 0.0)) +
+           V.j.pressure() * (subR * p2*(2+s.mR) + (1-subR) * (s.mR < 0.0));
+    return s;
+  }
+};
+
+/*!
+ * \class CNEMOAUSMPlusUp2Scheme
+ * \brief AUSM+up2 scheme (Kitamura and Shima, 2013) for NEMO flows.
+ * \note The ratio of specific heats is that of the nodes (not reconstructed).
+ */
+template<class Decorator>
+class CNEMOAUSMPlusUp2Scheme : public CNEMOAUSMBase<CNEMOAUSMPlusUp2Scheme<Decorator>,Decorator> {
+private:
+  using Base = CNEMOAUSMBase<CNEMOAUSMPlusUp2Scheme<Decorator>,Decorator>;
+  using Base::nDim;
+  const su2double Minf;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CNEMOAUSMPlusUp2Scheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up2 requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Mach number and pressure splitting of AUSM+up2, with the interface speed of sound.
+   */
+  template<class PrimVarType, class VariableType>
+  FORCEINLINE CNEMOAUSMSplitting machSplitting(const CPair<PrimVarType>& V,
+                                               Double projVel_i,
+                                               Double projVel_j,
+                                               Int iPoint,
+                                               Int jPoint,
+                                               const VariableType& solution) const {
+    constexpr passivedouble Kp = 0.25, sigma = 1.0, beta = 1.0/8.0;
+
+    const Double gamma_i = gatherVariables(iPoint, solution.GetGamma());
+    const Double gamma_j = gatherVariables(jPoint, solution.GetGamma());
+
+    /*--- Interface speed of sound. ---*/
+
+    const Double astarL = sqrt(2*(gamma_i-1)/(gamma_i+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma_j-1)/(gamma_j+1)*V.j.enthalpy());
+
+    const Double ahatL = astarL*astarL / max(astarL, projVel_i);
+    const Double ahatR = astarR*astarR / max(astarR,-projVel_j);
+
+    CNEMOAUSMSplitting s;
+    s.aL = s.aR = min(ahatL, ahatR);
+
+    /*--- Left and right Mach numbers, reference Mach, and scaling. ---*/
+
+    const Double aF = s.aL;
+    const Double mL = s.mL = projVel_i / aF;
+    const Double mR = s.mR = projVel_j / aF;
+
+    const Double MFsq = 0.5*(mL*mL + mR*mR);
+    const Double Mrefsq = min(1.0, max(MFsq, Minf*Minf));
+    const Double fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4+5*fa*fa);
+
+    /*--- Polynomial splittings (subsonic) and upwind values (supersonic). ---*/
+
+    const Double subL = abs(mL) <= 1.0;
+    const Double subR = abs(mR) <= 1.0;
+
+    Double p1 = 0.25*pow(mL+1, 2);
+    Double p2 = pow(mL*mL-1, 2);
+    const Double mLP = subL * (p1 + beta*p2) + (1-subL) * 0.5*(mL+abs(mL));
+    const Double pLP = subL * (p1*(2-mL) + alpha*mL*p2) + (1-subL) * (mL > 0.0);
+
+    p1 = 0.25*pow(mR-1, 2);
+    p2 = pow(mR*mR-1, 2);
+    const Double mRM = subR * (-p1 - beta*p2) + (1-subR) * 0.5*(mR-abs(mR));
+    const Double pRM = subR * (p1*(2+mR) - alpha*mR*p2) + (1-subR) * (mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    const Double rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa) * max(1-sigma*MFsq, 0.0) *
+                      (V.j.pressure()-V.i.pressure()) / (rhoF*aF*aF);
+
+    s.mF = mLP + mRM + Mp;
+
+    /*--- Modified pressure flux. ---*/
+
+    const Double uFsq = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+    const Double pFi = sqrt(uFsq) * (pLP+pRM-1) * rhoF * aF;
+
+    s.pF = 0.5*(V.j.pressure()+V.i.pressure()) +
+           0.5*(pLP-pRM)*(V.i.pressure()-V.j.pressure()) + pFi;
+    return s;
+  }
+};
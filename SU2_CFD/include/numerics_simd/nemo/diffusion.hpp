@@ -0,0 +1,221 @@
+/*!
+ * \file diffusion.hpp
+ * \brief Viscous fluxes of thermochemical non-equilibrium flows.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "variables.hpp"
+#include "../flow/diffusion/common.hpp"
+#include "../flow/diffusion/viscous_fluxes.hpp"
+#include "../../variables/CNEMONSVariable.hpp"
+
+/*!
+ * \class CNoNEMOViscousFlux
+ * \brief "Do-nothing" decorator of the NEMO schemes, see CNoViscousFlux,
+ * it also defines the number of species for the decorated class.
+ */
+template<size_t NSPECIES, size_t NDIM>
+class CNoNEMOViscousFlux : public CNoViscousFlux<NDIM> {
+protected:
+  static constexpr size_t nSpecies = NSPECIES;
+
+  template<class... Ts>
+  CNoNEMOViscousFlux(Ts&... args) : CNoViscousFlux<NDIM>(args...) {}
+};
+
+/*!
+ * \class CNEMOViscousFlux
+ * \brief Decorator class to add the viscous fluxes of NEMO flows (species diffusion,
+ * shear stress, and heat conduction of the two temperatures), see CAvgGradCorrected_NEMO.
+ * \note Only the fluxes are computed, the Jacobians are not available in the legacy classes either.
+ */
+template<size_t NSPECIES, size_t NDIM>
+class CNEMOViscousFlux : public CNumericsSIMD {
+protected:
+  static constexpr size_t nSpecies = NSPECIES;
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nPrimVar = nSpecies+nDim+10;
+  static constexpr size_t nPrimVarGrad = nSpecies+nDim+8;
+
+  const su2double prandtlTurb;
+  const bool correct;
+  const CNEMOSpeciesConstants<nSpecies> species;
+
+  /*!
+   * \brief Constructor, initialize constants and booleans.
+   */
+  template<class... Ts>
+  CNEMOViscousFlux(const CConfig& config, int iMesh, CNEMOGas* fluidModel, Ts&...) :
+    prandtlTurb(config.GetPrandtl_Turb()),
+    correct(iMesh == MESH_0),
+    species(fluidModel) {
+  }
+
+  /*!
+   * \brief Add viscous contributions to the flux.
+   */
+  template<class PrimVarType, size_t nVar>
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const CPair<PrimVarType>& V,
+                                const CVariable& solution_,
+                                const VectorDbl<nDim>& vector_ij,
+                                const CGeometry& geometry,
+                                const CConfig& config,
+                                Double area,
+                                const VectorDbl<nDim>& unitNormal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                MatrixDbl<nVar>& jac_i,
+                                MatrixDbl<nVar>& jac_j) const {
+
+    static_assert(PrimVarType::nVar <= nPrimVar,"");
+    static_assert(nVar == nSpecies+nDim+2,"");
+
+    const auto& solution = static_cast<const CNEMONSVariable&>(solution_);
+    const auto& gradient = solution.GetGradient_Primitive();
+
+    constexpr size_t RHO_INDEX = nSpecies+nDim+3;
+
+    /*--- Compute distance and handle zero without "ifs" by making it large. ---*/
+
+    auto dist2_ij = squaredNorm(vector_ij);
+    Double mask = dist2_ij < EPS*EPS;
+    dist2_ij += mask / (EPS*EPS);
+
+    /*--- Mass fractions and their gradients (from those of the species densities),
+     *    the other gradients are simply averaged and then corrected. ---*/
+
+    const auto grad_i = gatherVariables<nPrimVarGrad,nDim>(iPoint, gradient);
+    const auto grad_j = gatherVariables<nPrimVarGrad,nDim>(jPoint, gradient);
+
+    CPair<CNEMOPrimitives<nSpecies,nDim,nPrimVarGrad> > W;
+    MatrixDbl<nPrimVarGrad,nDim> avgGrad;
+
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      W.i.all(iSpecies) = V.i.partialDensity(iSpecies) / V.i.density();
+      W.j.all(iSpecies) = V.j.partialDensity(iSpecies) / V.j.density();
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        avgGrad(iSpecies,iDim) = 0.5 * ((grad_i(iSpecies,iDim) - W.i.all(iSpecies)*grad_i(RHO_INDEX,iDim)) / V.i.density() +
+                                        (grad_j(iSpecies,iDim) - W.j.all(iSpecies)*grad_j(RHO_INDEX,iDim)) / V.j.density());
+      }
+    }
+    for (size_t iVar = nSpecies; iVar < nPrimVarGrad; ++iVar) {
+      W.i.all(iVar) = V.i.all(iVar);
+      W.j.all(iVar) = V.j.all(iVar);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        avgGrad(iVar,iDim) = 0.5 * (grad_i(iVar,iDim) + grad_j(iVar,iDim));
+      }
+    }
+    if(correct) correctGradient(W, vector_ij, dist2_ij, avgGrad);
+
+    /*--- Average primitives and transport properties. ---*/
+
+    CNEMOPrimitives<nSpecies,nDim,nPrimVar> avgV;
+    for (size_t iVar = 0; iVar < nPrimVar; ++iVar) {
+      avgV.all(iVar) = 0.5 * (V.i.all(iVar) + V.j.all(iVar));
+    }
+    VectorDbl<nSpecies> avgY;
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      avgY(iSpecies) = 0.5 * (W.i.all(iSpecies) + W.j.all(iSpecies));
+    }
+
+    auto Ds = gatherVariables<nSpecies>(iPoint, solution.GetDiffusionCoeff());
+    auto eve = gatherVariables<nSpecies>(iPoint, solution.GetEve());
+    const auto Ds_j = gatherVariables<nSpecies>(jPoint, solution.GetDiffusionCoeff());
+    const auto eve_j = gatherVariables<nSpecies>(jPoint, solution.GetEve());
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      Ds(iSpecies) = 0.5 * (Ds(iSpecies) + Ds_j(iSpecies));
+      eve(iSpecies) = 0.5 * (eve(iSpecies) + eve_j(iSpecies));
+    }
+    Double ktr = 0.5 * (gatherVariables(iPoint, solution.GetThermalConductivity()) +
+                        gatherVariables(jPoint, solution.GetThermalConductivity()));
+    Double kve = 0.5 * (gatherVariables(iPoint, solution.GetThermalConductivity_ve()) +
+                        gatherVariables(jPoint, solution.GetThermalConductivity_ve()));
+
+    /*--- Scale the conductivities with the eddy viscosity (legacy approach). ---*/
+
+    Double mass = 0.0;
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      mass += avgY(iSpecies) * species.molarMass[iSpecies];
+    }
+    const Double Cptr = avgV.rhoCvtr() / avgV.density() + 1000.0*UNIVERSAL_GAS_CONSTANT / mass;
+    const Double kturb = Cptr * avgV.eddyVisc() / prandtlTurb;
+    kve *= 1 + kturb / ktr;
+    ktr += kturb;
+
+    /*--- Stress tensor, velocity gradients are rows 1 to nDim for "stressTensor". ---*/
+
+    MatrixDbl<nDim+1,nDim> velGrad;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jDim = 0; jDim < nDim; ++jDim) {
+        velGrad(iDim+1,jDim) = avgGrad(nSpecies+2+iDim,jDim);
+      }
+    }
+    const auto tau = stressTensor(avgV.laminarVisc() + avgV.eddyVisc(), velGrad);
+
+    /*--- Projected flux. ---*/
+
+    const Double rho = avgV.density();
+    constexpr size_t iEnergy = nSpecies+nDim;
+
+    Double projGradT = 0.0, projGradTve = 0.0, projRhoDGradY = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      projGradT += avgGrad(nSpecies,iDim) * unitNormal(iDim);
+      projGradTve += avgGrad(nSpecies+1,iDim) * unitNormal(iDim);
+    }
+
+    VectorDbl<nVar> viscFlux;
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      viscFlux(iSpecies) = rho * Ds(iSpecies) * dot(avgGrad[iSpecies], unitNormal);
+      projRhoDGradY += viscFlux(iSpecies);
+    }
+
+    viscFlux(iEnergy) = ktr * projGradT + kve * projGradTve;
+    viscFlux(iEnergy+1) = kve * projGradTve;
+
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      viscFlux(iSpecies) -= avgY(iSpecies) * projRhoDGradY;
+
+      const Double hs = (species.gasConst[iSpecies] + species.cvtr[iSpecies]) * avgV.temperature() +
+                        species.formation[iSpecies] + eve(iSpecies);
+      viscFlux(iEnergy) += viscFlux(iSpecies) * hs;
+      viscFlux(iEnergy+1) += viscFlux(iSpecies) * eve(iSpecies);
+    }
+
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      viscFlux(nSpecies+iDim) = dot(tau[iDim], unitNormal);
+      viscFlux(iEnergy) += viscFlux(nSpecies+iDim) * avgV.velocity(iDim);
+    }
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= viscFlux(iVar) * area;
+    }
+  }
+};
@@ -0,0 +1,118 @@
+/*!
+ * \file variables.hpp
+ * \brief Types to store the variables of thermochemical non-equilibrium flows.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../fluid/CNEMOGas.hpp"
+
+/*!
+ * \brief Type to store NEMO primitive variables and access them by name,
+ * the layout is that of CNEMOEulerVariable, [rho_s, T, Tve, u, P, rho, h, a, rhoCvtr, rhoCvve, ...].
+ */
+template<size_t nSpecies_, size_t nDim_, size_t nVar_>
+struct CNEMOPrimitives {
+  static constexpr size_t nSpecies = nSpecies_;
+  static constexpr size_t nDim = nDim_;
+  static constexpr size_t nVar = nVar_;
+  VectorDbl<nVar> all;
+  FORCEINLINE Double& partialDensity(size_t iSpecies) { return all(iSpecies); }
+  FORCEINLINE Double& temperature() { return all(nSpecies); }
+  FORCEINLINE Double& temperatureVe() { return all(nSpecies+1); }
+  FORCEINLINE Double& velocity(size_t iDim) { return all(nSpecies+2+iDim); }
+  FORCEINLINE Double& pressure() { return all(nSpecies+nDim+2); }
+  FORCEINLINE Double& density() { return all(nSpecies+nDim+3); }
+  FORCEINLINE Double& enthalpy() { return all(nSpecies+nDim+4); }
+  FORCEINLINE Double& speedSound() { return all(nSpecies+nDim+5); }
+  FORCEINLINE Double& rhoCvtr() { return all(nSpecies+nDim+6); }
+  FORCEINLINE Double& rhoCvve() { return all(nSpecies+nDim+7); }
+  FORCEINLINE const Double& partialDensity(size_t iSpecies) const { return all(iSpecies); }
+  FORCEINLINE const Double& temperature() const { return all(nSpecies); }
+  FORCEINLINE const Double& temperatureVe() const { return all(nSpecies+1); }
+  FORCEINLINE const Double& velocity(size_t iDim) const { return all(nSpecies+2+iDim); }
+  FORCEINLINE const Double* velocity() const { return &velocity(0); }
+  FORCEINLINE const Double& pressure() const { return all(nSpecies+nDim+2); }
+  FORCEINLINE const Double& density() const { return all(nSpecies+nDim+3); }
+  FORCEINLINE const Double& enthalpy() const { return all(nSpecies+nDim+4); }
+  FORCEINLINE const Double& speedSound() const { return all(nSpecies+nDim+5); }
+  FORCEINLINE const Double& rhoCvtr() const { return all(nSpecies+nDim+6); }
+  FORCEINLINE const Double& rhoCvve() const { return all(nSpecies+nDim+7); }
+
+  /*--- Un-reconstructed variables. ---*/
+  FORCEINLINE Double& laminarVisc() { return all(nSpecies+nDim+8); }
+  FORCEINLINE Double& eddyVisc() { return all(nSpecies+nDim+9); }
+  FORCEINLINE const Double& laminarVisc() const { return all(nSpecies+nDim+8); }
+  FORCEINLINE const Double& eddyVisc() const { return all(nSpecies+nDim+9); }
+};
+
+/*!
+ * \brief Constant properties of the species of the mixture, copied from the fluid model
+ * so that mixture properties can be evaluated for all SIMD lanes without calls to it.
+ */
+template<size_t nSpecies>
+struct CNEMOSpeciesConstants {
+  su2double gasConst[nSpecies];   /*!< \brief Specific gas constant, Ru/Ms. */
+  su2double molarMass[nSpecies];  /*!< \brief Molar mass. */
+  su2double cvtr[nSpecies];       /*!< \brief Specific heat of the trans.-rot. modes. */
+  su2double formation[nSpecies];  /*!< \brief Formation enthalpy. */
+
+  explicit CNEMOSpeciesConstants(CNEMOGas* fluidModel) {
+    const su2double Ru = 1000.0*UNIVERSAL_GAS_CONSTANT;
+    const auto& Ms = fluidModel->GetSpeciesMolarMass();
+    const auto& Cvtr = fluidModel->GetSpeciesCvTraRot();
+    const auto& Hf = fluidModel->GetSpeciesFormationEnthalpy();
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      molarMass[iSpecies] = Ms[iSpecies];
+      gasConst[iSpecies] = Ru / Ms[iSpecies];
+      cvtr[iSpecies] = Cvtr[iSpecies];
+      formation[iSpecies] = Hf[iSpecies];
+    }
+  }
+};
+
+/*!
+ * \brief Vib.-el. energy of the species at reconstructed states, linearized about the
+ * node values (eve(Tve) ~ eve_i + Cvve_i (Tve - Tve_i)), this avoids one evaluation of the
+ * fluid model per lane and is consistent to second order.
+ */
+template<size_t nSpecies, class PrimVarType1st, class PrimVarType, class VarType>
+FORCEINLINE VectorDbl<nSpecies> reconstructedEve(Int iPoint,
+                                                 bool muscl,
+                                                 const PrimVarType1st& V1st,
+                                                 const PrimVarType& V,
+                                                 const VarType& solution) {
+  auto eve = gatherVariables<nSpecies>(iPoint, solution.GetEve());
+  if (muscl) {
+    const auto cvve = gatherVariables<nSpecies>(iPoint, solution.GetCvve());
+    const Double dTve = V.temperatureVe() - V1st.temperatureVe();
+    for (size_t iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+      eve(iSpecies) += cvve(iSpecies) * dTve;
+    }
+  }
+  return eve;
+}
@@ -0,0 +1,235 @@
+/*!
+ * \file convection.hpp
+ * \brief Upwind convection of transported scalars (turbulence models).
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../variables/CScalarVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \brief MUSCL reconstruction of a pair of variables, point-based limiter or none.
+ * \note Flat indexing of the gradients is used as matrices with one row are vectors.
+ */
+template<size_t nVar, size_t nDim, class Limiter_t, class Gradient_t>
+FORCEINLINE void musclScalars(Int iPoint,
+                              Int jPoint,
+                              const VectorDbl<nDim>& vector_ij,
+                              bool limited,
+                              const Limiter_t& limiter,
+                              const Gradient_t& gradient,
+                              CPair<VectorDbl<nVar> >& vars) {
+  const auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradient);
+  const auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradient);
+
+  CPair<VectorDbl<nVar> > lim;
+  if (limited) {
+    lim.i = gatherVariables<nVar>(iPoint, limiter);
+    lim.j = gatherVariables<nVar>(jPoint, limiter);
+  }
+  for (size_t iVar = 0; iVar < nVar; ++iVar) {
+    Double proj_i = 0.0, proj_j = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      proj_i += grad_i.data()[iVar*nDim+iDim] * vector_ij(iDim);
+      proj_j += grad_j.data()[iVar*nDim+iDim] * vector_ij(iDim);
+    }
+    if (limited) {
+      proj_i *= lim.i(iVar);
+      proj_j *= lim.j(iVar);
+    }
+    vars.i(iVar) += 0.5 * proj_i;
+    vars.j(iVar) -= 0.5 * proj_j;
+  }
+}
+
+/*!
+ * \class CUpwScalarScheme
+ * \brief First order upwind convection of nVar scalars by the (reconstructed) flow
+ * velocity, the diffusion of the model is added by the decorator (e.g. CSADiffusion).
+ * \tparam Base - Decorator, defines nDim and the number of scalars (nVar).
+ * \tparam Conservative - The transported quantity is density times the solution (e.g. SST).
+ */
+template<class Base, bool Conservative>
+class CUpwScalarScheme : public Base {
+protected:
+  using Base::nDim;
+  using Base::nVar;
+  /*--- Velocity and density are the only primitives reconstructed, their
+   *    positions are the same in compressible and incompressible flow. ---*/
+  static constexpr size_t nPrimVarRecon = nDim+3;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarRecon);
+
+  const CFlowVariable* flowVars;
+  const bool implicit;
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool musclFlow;
+  const bool limiter;
+  const bool limiterFlow;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   * \note The reconstruction options follow CScalarSolver::Upwind_Residual.
+   */
+  template<class... Ts>
+  CUpwScalarScheme(const CConfig& config, int iMesh, const CVariable* flowVars_, Ts&... args) :
+    Base(config, iMesh, flowVars_, args...),
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)),
+    implicit(config.GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(config.GetMUSCL_Turb() && (iMesh == MESH_0 || !config.GetMG_Turbulence())),
+    musclFlow(muscl && config.GetMUSCL_Flow() && (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND)),
+    limiter(config.GetKind_SlopeLimit_Turb() != NO_LIMITER),
+    limiterFlow((config.GetKind_SlopeLimit_Flow() != NO_LIMITER) &&
+                (config.GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE)) {
+  }
+
+protected:
+  /*!
+   * \brief Implementation of the upwind scalar flux.
+   * \note Compiled for each instruction set (see SU2_MULTIVERSION).
+   */
+  SU2_MULTIVERSION
+  void computeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CScalarVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- First order flow primitives and scalars, the diffusion uses these. ---*/
+
+    CPair<VectorDbl<nPrimVar> > V1st;
+    V1st.i = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    V1st.j = gatherVariables<nPrimVar>(jPoint, flowVars->GetPrimitive());
+
+    CPair<VectorDbl<nVar> > S1st;
+    S1st.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    S1st.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    /*--- Reconstructed velocity, density, and scalars. ---*/
+
+    CPair<VectorDbl<nPrimVarRecon> > V;
+    for (size_t iVar = 0; iVar < nPrimVarRecon; ++iVar) {
+      V.i(iVar) = V1st.i(iVar);
+      V.j(iVar) = V1st.j(iVar);
+    }
+    if (musclFlow) {
+      musclScalars(iPoint, jPoint, vector_ij, limiterFlow, flowVars->GetLimiter_Primitive(),
+                   flowVars->GetGradient_Reconstruction(), V);
+    }
+
+    auto S = S1st;
+    if (muscl) {
+      musclScalars(iPoint, jPoint, vector_ij, limiter, solution.GetLimiter(),
+                   solution.GetGradient_Reconstruction(), S);
+    }
+
+    /*--- Upwind flux with the average projected velocity, corrected for grid motion. ---*/
+
+    Double q_ij = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      q_ij += 0.5 * (V.i(iDim+1) + V.j(iDim+1)) * normal(iDim);
+    }
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      q_ij -= 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), normal)+
+                   dot(gatherVariables<nDim>(jPoint,gridVel), normal));
+    }
+    const Double a0 = 0.5 * (q_ij + abs(q_ij));
+    const Double a1 = 0.5 * (q_ij - abs(q_ij));
+
+    const Double w_i = Conservative? V.i(nDim+2) : Double(1.0);
+    const Double w_j = Conservative? V.j(nDim+2) : Double(1.0);
+
+    VectorDbl<nVar> flux;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0*w_i*S.i(iVar) + a1*w_j*S.j(iVar);
+    }
+
+    /*--- The Jacobians are diagonal (w.r.t. the conservative scalars),
+     *    flat indexing is used as a 1x1 matrix is a vector. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      jac_i = Double(0.0);
+      jac_j = Double(0.0);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_i.data()[iVar*(nVar+1)] = a0;
+        jac_j.data()[iVar*(nVar+1)] = a1;
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::diffusionTerms(iEdge, iPoint, jPoint, V1st, S1st, solution, vector_ij,
+                         normal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+
+public:
+  /*!
+   * \brief Virtual functions cannot be multi-versioned, forward to the implementation.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+    computeFlux(iEdge, config, geometry, solution, updateType, updateMask, vector, matrix);
+  }
+};
@@ -0,0 +1,295 @@
+/*!
+ * \file diffusion.hpp
+ * \brief Decorator classes for the diffusion of transported scalars (turbulence models).
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+
+/*!
+ * \class CNoScalarDiffusion
+ * \brief "Do-nothing" decorator for scalar convection schemes, see CNoViscousFlux.
+ * \tparam NDIM - Number of dimensions.
+ * \tparam NVAR - Number of transported scalars.
+ */
+template<size_t NDIM, size_t NVAR>
+class CNoScalarDiffusion : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+  static constexpr size_t nPrimVar = 0;
+
+  template<class... Ts>
+  CNoScalarDiffusion(Ts&...) {}
+
+  template<class... Ts>
+  void diffusionTerms(Ts&...) const {}
+};
+
+/*!
+ * \class CScalarDiffusionBase
+ * \brief Decorator class to add the diffusion of transported scalars, the projected
+ * average gradients (with edge correction) are computed here, the fluxes and
+ * Jacobians (TSL approximation) are computed by the derived model classes.
+ * \note The primitives are those of the flow solver, without reconstruction. The
+ * gradient correction is applied on all grid levels, as for CAvgGrad_Scalar.
+ */
+template<size_t NDIM, size_t NVAR, class Derived>
+class CScalarDiffusionBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+  /*--- Enough for the eddy viscosity of compressible and incompressible flow. ---*/
+  static constexpr size_t nPrimVar = nDim+7;
+
+  const size_t idxLamVisc;
+  const size_t idxEddyVisc;
+
+  /*!
+   * \brief Constructor, the position of the viscosities depends on the regime.
+   */
+  template<class... Ts>
+  CScalarDiffusionBase(const CConfig& config, int, Ts&...) :
+    idxLamVisc(config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE? nDim+4 : nDim+5),
+    idxEddyVisc(idxLamVisc+1) {
+  }
+
+  /*!
+   * \brief Add diffusion contributions to the flux and Jacobians.
+   */
+  template<class PrimitiveType, class VariableType>
+  FORCEINLINE void diffusionTerms(Int iEdge,
+                                  Int iPoint,
+                                  Int jPoint,
+                                  const CPair<PrimitiveType>& V,
+                                  const CPair<VectorDbl<nVar> >& S,
+                                  const VariableType& solution,
+                                  const VectorDbl<nDim>& vector_ij,
+                                  const VectorDbl<nDim>& normal,
+                                  bool implicit,
+                                  VectorDbl<nVar>& flux,
+                                  MatrixDbl<nVar>& jac_i,
+                                  MatrixDbl<nVar>& jac_j) const {
+
+    /*--- Projection of the edge vector, guarding against coincident points. ---*/
+
+    const Double projVector = dot(vector_ij, normal) / max(squaredNorm(vector_ij), EPS);
+
+    /*--- Projected average gradients, with and without correction (flat
+     *    indexing is used as matrices with one row are vectors). ---*/
+
+    const auto& gradient = solution.GetGradient();
+    auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradient);
+    auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradient);
+
+    VectorDbl<nVar> projNormal, projCorrected;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      VectorDbl<nDim> avgGrad;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        avgGrad(iDim) = 0.5 * (grad_i.data()[iVar*nDim+iDim] + grad_j.data()[iVar*nDim+iDim]);
+      }
+      projNormal(iVar) = dot(avgGrad, normal);
+      projCorrected(iVar) = projNormal(iVar) - (dot(avgGrad, vector_ij) - (S.j(iVar) - S.i(iVar))) * projVector;
+    }
+
+    static_cast<const Derived*>(this)->finalizeDiffusion(iPoint, jPoint, V, S, solution, projNormal,
+                                                         projCorrected, projVector, implicit, flux, jac_i, jac_j);
+  }
+};
+
+/*!
+ * \class CSADiffusion
+ * \brief Diffusion of the SA variable.
+ */
+template<size_t NDIM>
+class CSADiffusion : public CScalarDiffusionBase<NDIM, 1, CSADiffusion<NDIM> > {
+private:
+  using Base = CScalarDiffusionBase<NDIM, 1, CSADiffusion<NDIM> >;
+  friend Base;
+  using Base::idxLamVisc;
+  const su2double sigma = 2.0/3.0;
+
+protected:
+  using Base::nVar;
+
+  template<class... Ts>
+  CSADiffusion(const CConfig& config, int iMesh, Ts&... args) : Base(config, iMesh, args...) {}
+
+  /*!
+   * \brief Effective viscosity, flux, and Jacobians.
+   */
+  template<class PrimitiveType, class VariableType>
+  FORCEINLINE void finalizeDiffusion(Int iPoint, Int jPoint,
+                                     const CPair<PrimitiveType>& V,
+                                     const CPair<VectorDbl<nVar> >& S,
+                                     const VariableType&,
+                                     const VectorDbl<nVar>&,
+                                     const VectorDbl<nVar>& projCorrected,
+                                     const Double& projVector,
+                                     bool implicit,
+                                     VectorDbl<nVar>& flux,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+
+    const Double nu_i = V.i(idxLamVisc) / V.i(NDIM+2);
+    const Double nu_j = V.j(idxLamVisc) / V.j(NDIM+2);
+    const Double nu_e = 0.5 * (nu_i + nu_j + S.i(0) + S.j(0));
+
+    flux(0) -= nu_e * projCorrected(0) / sigma;
+
+    if (implicit) {
+      jac_i.data()[0] -= (0.5*projCorrected(0) - nu_e*projVector) / sigma;
+      jac_j.data()[0] -= (0.5*projCorrected(0) + nu_e*projVector) / sigma;
+    }
+  }
+};
+
+/*!
+ * \class CSANegDiffusion
+ * \brief Diffusion of the SA variable, negative model.
+ * \note As in CAvgGrad_TurbSA_Neg, the flux uses the uncorrected projected gradient.
+ */
+template<size_t NDIM>
+class CSANegDiffusion : public CScalarDiffusionBase<NDIM, 1, CSANegDiffusion<NDIM> > {
+private:
+  using Base = CScalarDiffusionBase<NDIM, 1, CSANegDiffusion<NDIM> >;
+  friend Base;
+  using Base::idxLamVisc;
+  const su2double sigma = 2.0/3.0;
+  const su2double cn1 = 16.0;
+
+protected:
+  using Base::nVar;
+
+  template<class... Ts>
+  CSANegDiffusion(const CConfig& config, int iMesh, Ts&... args) : Base(config, iMesh, args...) {}
+
+  /*!
+   * \brief Effective viscosity, flux, and Jacobians.
+   */
+  template<class PrimitiveType, class VariableType>
+  FORCEINLINE void finalizeDiffusion(Int iPoint, Int jPoint,
+                                     const CPair<PrimitiveType>& V,
+                                     const CPair<VectorDbl<nVar> >& S,
+                                     const VariableType&,
+                                     const VectorDbl<nVar>& projNormal,
+                                     const VectorDbl<nVar>& projCorrected,
+                                     const Double& projVector,
+                                     bool implicit,
+                                     VectorDbl<nVar>& flux,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+
+    const Double nu_ij = 0.5 * (V.i(idxLamVisc) / V.i(NDIM+2) + V.j(idxLamVisc) / V.j(NDIM+2));
+    const Double nu_tilde_ij = 0.5 * (S.i(0) + S.j(0));
+
+    /*--- Clipping Xi to non-positive values gives fn = 1 for the positive branch. ---*/
+    const Double Xi = min(nu_tilde_ij, 0.0) / nu_ij;
+    const Double fn = (cn1 + Xi*Xi*Xi) / (cn1 - Xi*Xi*Xi);
+    const Double nu_e = nu_ij + fn * nu_tilde_ij;
+
+    flux(0) -= nu_e * projNormal(0) / sigma;
+
+    if (implicit) {
+      jac_i.data()[0] -= (0.5*projCorrected(0) - nu_e*projVector) / sigma;
+      jac_j.data()[0] -= (0.5*projCorrected(0) + nu_e*projVector) / sigma;
+    }
+  }
+};
+
+/*!
+ * \class CSSTDiffusion
+ * \brief Diffusion of k and omega with F1-blended diffusion coefficients.
+ */
+template<size_t NDIM>
+class CSSTDiffusion : public CScalarDiffusionBase<NDIM, 2, CSSTDiffusion<NDIM> > {
+private:
+  using Base = CScalarDiffusionBase<NDIM, 2, CSSTDiffusion<NDIM> >;
+  friend Base;
+  using Base::idxLamVisc;
+  using Base::idxEddyVisc;
+
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+
+protected:
+  using Base::nVar;
+
+  /*!
+   * \brief Constructor, the model constants are those of CTurbSSTSolver.
+   */
+  template<class... Ts>
+  CSSTDiffusion(const CConfig& config, int iMesh, const CVariable* flowVars,
+                const su2double* constants, Ts&... args) :
+    Base(config, iMesh, flowVars, args...),
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]) {
+  }
+
+  /*!
+   * \brief Blended diffusion coefficients, flux, and Jacobians.
+   */
+  template<class PrimitiveType, class VariableType>
+  FORCEINLINE void finalizeDiffusion(Int iPoint, Int jPoint,
+                                     const CPair<PrimitiveType>& V,
+                                     const CPair<VectorDbl<nVar> >&,
+                                     const VariableType& solution,
+                                     const VectorDbl<nVar>&,
+                                     const VectorDbl<nVar>& projCorrected,
+                                     const Double& projVector,
+                                     bool implicit,
+                                     VectorDbl<nVar>& flux,
+                                     MatrixDbl<nVar>& jac_i,
+                                     MatrixDbl<nVar>& jac_j) const {
+
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    const auto diffusivity = [&](const PrimitiveType& Vk, const Double& F1k, su2double sigma1, su2double sigma2) {
+      return Vk(idxLamVisc) + (F1k*sigma1 + (1-F1k)*sigma2) * Vk(idxEddyVisc);
+    };
+    VectorDbl<nVar> diff;
+    diff(0) = 0.5 * (diffusivity(V.i, F1_i, sigma_k1, sigma_k2) + diffusivity(V.j, F1_j, sigma_k1, sigma_k2));
+    diff(1) = 0.5 * (diffusivity(V.i, F1_i, sigma_om1, sigma_om2) + diffusivity(V.j, F1_j, sigma_om1, sigma_om2));
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= diff(iVar) * projCorrected(iVar);
+    }
+
+    if (implicit) {
+      const Double projOnRho_i = projVector / V.i(NDIM+2);
+      const Double projOnRho_j = projVector / V.j(NDIM+2);
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_i(iVar,iVar) += diff(iVar) * projOnRho_i;
+        jac_j(iVar,iVar) -= diff(iVar) * projOnRho_j;
+      }
+    }
+  }
+};
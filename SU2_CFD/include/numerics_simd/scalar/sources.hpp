@@ -0,0 +1,427 @@
+/*!
+ * \file sources.hpp
+ * \brief Point-batched source terms of the turbulence models.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CFlowVariable.hpp"
+#include "../../variables/CTurbSAVariable.hpp"
+#include "../../variables/CTurbSSTVariable.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CScalarSourceBase
+ * \brief Common parts of the point-batched source terms, gathering of the model-independent
+ * inputs, and update of the residual and of the diagonal blocks of the Jacobian.
+ * \note The inputs are read directly from the containers of the variables, the legacy
+ * classes (CSourcePieceWise_TurbSA/SST) receive them one point at a time via setters.
+ */
+template<size_t NDIM, size_t NVAR>
+class CScalarSourceBase : public CSourceNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+  /*--- Enough for the eddy viscosity of compressible and incompressible flow. ---*/
+  static constexpr size_t nPrimVar = nDim+7;
+
+  const CFlowVariable* flowVars;
+  const size_t idxLamVisc;
+  const bool implicit;
+
+  /*!
+   * \brief Constructor, the position of the viscosities depends on the regime.
+   */
+  CScalarSourceBase(const CConfig& config, const CVariable* flowVars_) :
+    flowVars(static_cast<const CFlowVariable*>(flowVars_)),
+    idxLamVisc(config.GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE? nDim+4 : nDim+5),
+    implicit(config.GetKind_TimeIntScheme_Turb() == EULER_IMPLICIT) {
+  }
+
+  /*!
+   * \brief Magnitude of the vorticity (which has 3 components also in 2D).
+   */
+  FORCEINLINE Double vorticityMagnitude(Int iPoint) const {
+    return sqrt(squaredNorm(gatherVariables<3>(iPoint, flowVars->GetVorticity())));
+  }
+
+  /*!
+   * \brief Subtract the source from the residual, and its Jacobian from the diagonal blocks.
+   */
+  FORCEINLINE void updateLinearSystem(Int iPoint,
+                                      Double updateMask,
+                                      VectorDbl<nVar>& residual,
+                                      MatrixDbl<nVar>& jacobian,
+                                      CSysVector<su2double>& vector,
+                                      SparseMatrixType& matrix) const {
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      residual(iVar) = -residual(iVar);
+    }
+    vector.AddBlock(iPoint, residual, updateMask);
+    if (implicit) {
+      for (size_t i = 0; i < nVar*nVar; ++i) {
+        jacobian.data()[i] = -jacobian.data()[i];
+      }
+      auto wasActive = AD::BeginPassive();
+      matrix.AddBlock2Diag(iPoint, jacobian, updateMask);
+      AD::EndPassive(wasActive);
+    }
+  }
+};
+
+/*!
+ * \class CSASource
+ * \brief Source terms of the Spalart-Allmaras model and of its variants, see
+ * CSourcePieceWise_TurbSA, CSourcePieceWise_TurbSA_E, CSourcePieceWise_TurbSA_COMP,
+ * CSourcePieceWise_TurbSA_E_COMP, and CSourcePieceWise_TurbSA_Neg.
+ * \note The "if"s of the legacy classes (e.g. wall distance, negative SA) are replaced by masks.
+ * \tparam Model - The SA variant.
+ */
+template<size_t NDIM, TURB_MODEL Model>
+class CSASource : public CScalarSourceBase<NDIM, 1> {
+protected:
+  using Base = CScalarSourceBase<NDIM, 1>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::nPrimVar;
+  using Base::flowVars;
+  using Base::idxLamVisc;
+
+  static constexpr bool edwards = (Model == TURB_MODEL::SA_E) || (Model == TURB_MODEL::SA_E_COMP);
+  static constexpr bool compCorrection = (Model == TURB_MODEL::SA_COMP) || (Model == TURB_MODEL::SA_E_COMP);
+  static constexpr bool negative = (Model == TURB_MODEL::SA_NEG);
+  static constexpr bool roughness = (Model == TURB_MODEL::SA);
+
+  /*--- Closure constants. ---*/
+  const su2double cv1_3 = pow(7.1, 3);
+  const su2double k2 = pow(0.41, 2);
+  const su2double cb1 = 0.1355;
+  const su2double cw2 = 0.3;
+  const su2double ct3 = 1.2;
+  const su2double cw3_6 = pow(2.0, 6);
+  const su2double cb2_sigma = 0.622 / (2.0/3.0);
+  const su2double cw1 = cb1/k2 + (1.0+0.622)/(2.0/3.0);
+  const su2double cr1 = 0.5;
+  const su2double c5 = 3.5;
+
+  const su2double gamma;
+  const bool rotatingFrame;
+  const bool hybridRANSLES;
+
+public:
+  /*!
+   * \brief Constructor, store some constants.
+   */
+  template<class... Ts>
+  CSASource(const CConfig& config, int, const CVariable* flowVars_, Ts&...) :
+    Base(config, flowVars_),
+    gamma(config.GetGamma()),
+    rotatingFrame(config.GetRotating_Frame()),
+    hybridRANSLES(config.GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
+  }
+
+  /*!
+   * \brief Implementation of the SA source terms.
+   */
+  FORCEINLINE void ComputeSource(Int iPoint,
+                                 const CConfig& config,
+                                 const CGeometry& geometry,
+                                 const CVariable& solution_,
+                                 Double updateMask,
+                                 CSysVector<su2double>& vector,
+                                 SparseMatrixType& matrix) const override {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CTurbSAVariable&>(solution_);
+
+    const auto V = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    const Double density = V(nDim+2);
+    const Double nu = V(idxLamVisc) / density;
+
+    const Double nuTilde = gatherVariables<1>(iPoint, solution.GetSolution())(0);
+    const auto gradNuTilde = gatherVariables<1,nDim>(iPoint, solution.GetGradient());
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+
+    /*--- Wall distance (modified for roughness), or DES length scale. ---*/
+
+    Double dist, roughHeight = 0.0;
+    if (hybridRANSLES) {
+      dist = gatherVariables(iPoint, solution.GetDES_LengthScale());
+    } else {
+      roughHeight = gatherVariables(iPoint, geometry.nodes->GetRoughnessHeight());
+      dist = gatherVariables(iPoint, geometry.nodes->GetWall_Distance()) + 0.03 * roughHeight;
+    }
+
+    /*--- Points too close to the wall have no source, guard the divisions. ---*/
+
+    const Double distMask = dist > 1e-10;
+    dist = max(dist, 1e-10);
+    const Double dist2 = dist * dist;
+
+    /*--- Vorticity magnitude, or strain rate for the Edwards variants. ---*/
+
+    MatrixDbl<nDim+1,nDim> gradV;
+    if (edwards || compCorrection) {
+      gradV = gatherVariables<nDim+1,nDim>(iPoint, flowVars->GetGradient_Primitive());
+    }
+
+    Double Omega;
+    if (edwards) {
+      Double Sbar = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        for (size_t jDim = 0; jDim < nDim; ++jDim) {
+          Sbar += (gradV(1+iDim,jDim) + gradV(1+jDim,iDim)) * gradV(1+iDim,jDim);
+        }
+      }
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        Sbar -= 2.0/3.0 * gradV(1+iDim,iDim) * gradV(1+iDim,iDim);
+      }
+      Omega = sqrt(max(Sbar, 0.0));
+    } else {
+      Omega = this->vorticityMagnitude(iPoint);
+    }
+
+    if (rotatingFrame) {
+      const Double strainMag = gatherVariables(iPoint, flowVars->GetStrainMag());
+      Omega += 2.0 * min(0.0, strainMag - Omega);
+    }
+
+    /*--- Standard model, for negative SA this branch is evaluated with nuTilde clipped to 0. ---*/
+
+    const Double nuT = negative? max(nuTilde, 0.0) : nuTilde;
+
+    Double Ji = nuT / nu;
+    if (roughness) Ji += cr1 * roughHeight / (dist + EPS);
+    const Double Ji_2 = Ji * Ji;
+    const Double Ji_3 = Ji_2 * Ji;
+    const Double fv1 = Ji_3 / (Ji_3 + cv1_3);
+    Double fv2;
+    if (roughness) fv2 = 1.0 - nuT / (nu + nuT * fv1);
+    else fv2 = 1.0 - Ji / (1.0 + Ji * fv1);
+    const Double inv_k2_d2 = 1.0 / (k2 * dist2);
+
+    Double Shat;
+    if (edwards) Shat = max(Omega * (1.0 / max(Ji, 1e-16) + fv1), 1e-16);
+    else Shat = Omega + nuT * fv2 * inv_k2_d2;
+    Shat = max(Shat, 1e-10);
+    const Double inv_Shat = 1.0 / Shat;
+
+    const Double production = cb1 * Shat * nuT * volume;
+
+    Double r = min(nuT * inv_Shat * inv_k2_d2, 10.0);
+    const Double rClipped = r == 10.0;
+    if (edwards) r = tanh(r) / tanh(1.0);
+
+    const Double r_2 = r * r;
+    const Double r_5 = r_2 * r_2 * r;
+    const Double g = r + cw2 * (r_5 * r - r);
+    const Double g_2 = g * g;
+    const Double g_6 = g_2 * g_2 * g_2;
+    const Double glim = pow((1.0 + cw3_6) / (g_6 + cw3_6), 1.0/6.0);
+    const Double fw = g * glim;
+
+    const Double destruction = cw1 * fw * nuT * nuT / dist2 * volume;
+
+    const Double crossProduction = cb2_sigma * squaredNorm<nDim>(gradNuTilde.data()) * volume;
+
+    Double source = production - destruction + crossProduction;
+
+    /*--- Implicit part. ---*/
+
+    const Double den1 = Ji_3 + cv1_3, den2 = 1.0 + Ji * fv1;
+    const Double dfv1 = 3.0 * Ji_2 * cv1_3 / (nu * den1 * den1);
+    const Double dfv2 = -(1.0/nu - Ji_2 * dfv1) / (den2 * den2);
+
+    Double dShat;
+    if (edwards) dShat = -Omega / (pow(max(Ji, 1e-16), 2) * nu) + Omega * dfv1;
+    else dShat = (fv2 + nuT * dfv2) * inv_k2_d2;
+    dShat *= Shat > 1e-10;
+
+    Double jacobian = cb1 * (nuT * dShat + Shat) * volume;
+
+    Double dr = (Shat - nuT * dShat) * inv_Shat * inv_Shat * inv_k2_d2;
+    if (edwards) {
+      const Double tanh_r = tanh(r);
+      dr = (1.0 - tanh_r * tanh_r) * dr / tanh(1.0);
+    }
+    else dr *= 1.0 - rClipped;
+    const Double dg = dr * (1.0 + cw2 * (6.0 * r_5 - 1.0));
+    const Double dfw = dg * glim * (1.0 - g_6 / (g_6 + cw3_6));
+    jacobian -= cw1 * (dfw * nuT + 2.0 * fw) * nuT / dist2 * volume;
+
+    /*--- Compressibility correction. ---*/
+
+    if (compCorrection) {
+      Double aux_cc = 0.0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        for (size_t jDim = 0; jDim < nDim; ++jDim) {
+          aux_cc += gradV(1+iDim,jDim) * gradV(1+iDim,jDim);
+        }
+      }
+      const Double soundSpeed2 = V(nDim+1) * gamma / density;
+      source -= c5 * nuTilde * nuTilde / soundSpeed2 * aux_cc * volume;
+      jacobian -= 2.0 * c5 * nuTilde / soundSpeed2 * aux_cc * volume;
+    }
+
+    /*--- Negative SA, blend with the branch for negative nuTilde. ---*/
+
+    if (negative) {
+      const Double negMask = nuTilde <= 0.0;
+      const Double sourceNeg = cb1 * (1.0 - ct3) * Omega * nuTilde * volume +
+                               cw1 * nuTilde * nuTilde / dist2 * volume + crossProduction;
+      const Double jacobianNeg = cb1 * (1.0 - ct3) * Omega * volume + 2.0 * cw1 * nuTilde / dist2 * volume;
+      source = negMask * sourceNeg + (1.0 - negMask) * source;
+      jacobian = negMask * jacobianNeg + (1.0 - negMask) * jacobian;
+    }
+
+    VectorDbl<nVar> residual;
+    residual(0) = distMask * source;
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(residual);
+
+    MatrixDbl<nVar> jac;
+    jac.data()[0] = distMask * jacobian;
+
+    this->updateLinearSystem(iPoint, updateMask, residual, jac, vector, matrix);
+  }
+};
+
+/*!
+ * \class CSSTSource
+ * \brief Source terms of the Menter SST model, see CSourcePieceWise_TurbSST.
+ * \note The axisymmetric and uncertainty quantification (perturbed Reynolds stress)
+ * terms are not included, CSourceNumericsSIMD::CreateSourceNumerics excludes those options.
+ */
+template<size_t NDIM>
+class CSSTSource : public CScalarSourceBase<NDIM, 2> {
+protected:
+  using Base = CScalarSourceBase<NDIM, 2>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::nPrimVar;
+  using Base::flowVars;
+  using Base::idxLamVisc;
+
+  const su2double beta_1, beta_2, beta_star, a1, alfa_1, alfa_2;
+  const su2double kAmb, omegaAmb;
+  const bool sustainingTerms;
+
+public:
+  /*!
+   * \brief Constructor, store the model constants and the ambient values of k and omega.
+   */
+  CSSTSource(const CConfig& config, int, const CVariable* flowVars_, const su2double* constants,
+             const su2double* solutionInf) :
+    Base(config, flowVars_),
+    beta_1(constants[4]), beta_2(constants[5]), beta_star(constants[6]),
+    a1(constants[7]), alfa_1(constants[8]), alfa_2(constants[9]),
+    kAmb(solutionInf[0]), omegaAmb(solutionInf[1]),
+    sustainingTerms(config.GetKind_Turb_Model() == TURB_MODEL::SST_SUST) {
+  }
+
+  /*!
+   * \brief Implementation of the SST source terms.
+   */
+  FORCEINLINE void ComputeSource(Int iPoint,
+                                 const CConfig& config,
+                                 const CGeometry& geometry,
+                                 const CVariable& solution_,
+                                 Double updateMask,
+                                 CSysVector<su2double>& vector,
+                                 SparseMatrixType& matrix) const override {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const auto& solution = static_cast<const CTurbSSTVariable&>(solution_);
+
+    const auto V = gatherVariables<nPrimVar>(iPoint, flowVars->GetPrimitive());
+    const Double density = V(nDim+2);
+    const Double eddyVisc = V(idxLamVisc+1);
+
+    const auto turbVars = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    const Double k = turbVars(0), omega = turbVars(1);
+
+    const Double F1 = gatherVariables(iPoint, solution.GetF1blending());
+    const Double F2 = gatherVariables(iPoint, solution.GetF2blending());
+    const Double CDkw = gatherVariables(iPoint, solution.GetCrossDiff());
+    const Double strainMag = gatherVariables(iPoint, flowVars->GetStrainMag());
+    const Double vorticityMag = this->vorticityMagnitude(iPoint);
+    const Double volume = gatherVariables(iPoint, geometry.nodes->GetVolume());
+    const Double distMask = gatherVariables(iPoint, geometry.nodes->GetWall_Distance()) > 1e-10;
+
+    const auto gradV = gatherVariables<nDim+1,nDim>(iPoint, flowVars->GetGradient_Primitive());
+    Double diverg = 0.0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) diverg += gradV(iDim+1,iDim);
+
+    /*--- Blended constants. ---*/
+
+    const Double alfa_blended = F1 * alfa_1 + (1.0 - F1) * alfa_2;
+    const Double beta_blended = F1 * beta_1 + (1.0 - F1) * beta_2;
+
+    /*--- Production. ---*/
+
+    Double pk = eddyVisc * strainMag * strainMag - 2.0/3.0 * density * k * diverg;
+    pk = max(min(pk, 20.0 * beta_star * density * omega * k), 0.0);
+
+    const Double zeta = max(omega, vorticityMag * F2 / a1);
+
+    Double pw = strainMag * strainMag - 2.0/3.0 * zeta * diverg;
+    pw = alfa_blended * density * max(pw, 0.0);
+
+    if (sustainingTerms) {
+      pk = max(pk, beta_star * density * kAmb * omegaAmb);
+      pw = max(pw, beta_blended * density * omegaAmb * omegaAmb);
+    }
+
+    /*--- Production, dissipation, and cross diffusion. ---*/
+
+    VectorDbl<nVar> residual;
+    residual(0) = distMask * (pk - beta_star * density * omega * k) * volume;
+    residual(1) = distMask * (pw - beta_blended * density * omega * omega + (1.0 - F1) * CDkw) * volume;
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(residual);
+
+    /*--- Implicit part. ---*/
+
+    MatrixDbl<nVar> jac;
+    jac(0,0) = -distMask * beta_star * omega * volume;
+    jac(0,1) = -distMask * beta_star * k * volume;
+    jac(1,0) = 0.0;
+    jac(1,1) = -distMask * 2.0 * beta_blended * omega * volume;
+
+    this->updateLinearSystem(iPoint, updateMask, residual, jac, vector, matrix);
+  }
+};
@@ -31,6 +31,7 @@
 #include "CSolver.hpp"
 
 class CNumericsSIMD;
+class CBoundaryNumericsSIMD;
 
 template <class VariableType, ENUM_REGIME FlowRegime>
 class CFVMFlowSolverBase : public CSolver {
@@ -82,6 +83,27 @@ class CFVMFlowSolverBase : public CSolver {
 
   unsigned long ErrorCounter = 0;    /*!< \brief Counter for number of un-physical states. */
 
+  /*--- Multirate local time stepping (LEVELS_TIME_ACCURATE_LTS), see SetTimeLevels. ---*/
+
+  unsigned short nTimeLevels = 1;          /*!< \brief Maximum number of time levels, 1 means no local time stepping. */
+  unsigned long nTimeLevelSubSteps = 1;    /*!< \brief Number of sub-steps (of size Min_Delta_Time) per time step. */
+  unsigned long TimeLevelSubStep = 0;      /*!< \brief Current sub-step. */
+  su2vector<unsigned short> TimeLevel;     /*!< \brief Level of each point, it is updated every 2^level sub-steps. */
+  CSysVector<su2double> TimeLevelResidual; /*!< \brief Residual accumulated over the sub-steps of each point. */
+
+  /*--- Active set mode (ACTIVE_SET), see UpdateActiveSet. ---*/
+
+  bool activeSet = false;               /*!< \brief Whether the residuals are restricted to the active points. */
+  bool ActiveSetFullEval = true;        /*!< \brief Whether all points are active in the current iteration. */
+  su2double ActiveSetRatio = 0.0;       /*!< \brief Ratio of the local residuals to ActiveSetRefRes below which a point is converged. */
+  unsigned short ActiveSetBuffer = 0;   /*!< \brief Layers of neighbors of the not converged points that are also active. */
+  unsigned long ActiveSetFreq = 1;      /*!< \brief Frequency of the full evaluations. */
+  su2vector<bool> ActivePoint;          /*!< \brief Whether a point is active in the current iteration. */
+  su2vector<unsigned short> ActiveSetLayer; /*!< \brief Distance (in layers) of each point to the closest not converged point. */
+  su2double ActiveSetRefRes[MAXNVAR] = {0.0};    /*!< \brief RMS residuals of the last full evaluation. */
+  su2double ActiveSetFrozenRes[MAXNVAR] = {0.0}; /*!< \brief Sum of the squared last residuals of the frozen points (rank). */
+  su2activematrix ActiveSetPointRes;    /*!< \brief Squared last residuals of each frozen point, removed from ActiveSetFrozenRes when it is reactivated. */
+
   /*!
    * \brief Auxilary types to store common aero coefficients (avoids repeating oneself so much).
    */
@@ -214,6 +236,7 @@ class CFVMFlowSolverBase : public CSolver {
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
   CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux computation. */
+  CBoundaryNumericsSIMD* boundaryNumerics = nullptr; /*!< \brief Object for the convective flux of BCs, nullptr if not supported. */
 
   /*!
    * \brief The highest level in the variable hierarchy the DERIVED solver can safely use.
@@ -278,6 +301,61 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SumEdgeFluxes(const CGeometry* geometry);
 
+  /*!
+   * \brief Convective flux between the points of a marker and the ghost states stored in CharacPrimVar,
+   *        computed in batches of vertices with boundaryNumerics (instead of conv_numerics in the BC routines).
+   * \note The BC routines must have set the ghost states of all vertices before calling this method.
+   */
+  void BoundaryFluxResidual(const CGeometry *geometry, const CConfig *config, unsigned short val_marker);
+
+  /*!
+   * \brief Group the points in power-of-two time levels for multirate local time stepping, from
+   *        the local time steps (Delta_Time) computed with the unsteady CFL.
+   * \note Neighbors differ by at most one level, and one time step (Global_Delta_Time) is made of
+   *       nTimeLevelSubSteps sub-steps of size Min_Delta_Time.
+   */
+  void SetTimeLevels(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Weight of the fluxes of an edge in the current multirate sub-step.
+   * \note An edge is evaluated every 2^level sub-steps of its finest point, with weight 2^level
+   *       to keep the fluxes conservative, the weight is 0 when the edge is not evaluated.
+   */
+  inline su2double TimeLevelEdgeWeight(const CGeometry *geometry, unsigned long iEdge) const {
+    if (nTimeLevels == 1) return 1.0;
+    const auto level = min(TimeLevel[geometry->edges->GetNode(iEdge,0)],
+                           TimeLevel[geometry->edges->GetNode(iEdge,1)]);
+    const auto period = 1ul << level;
+    return (TimeLevelSubStep % period == 0) ? su2double(period) : su2double(0.0);
+  }
+
+  /*!
+   * \brief Whether the fluxes of an edge need to be evaluated in active set mode, i.e. if one of its points is active.
+   */
+  inline bool ActiveSetEdge(const CGeometry *geometry, unsigned long iEdge) const {
+    return !activeSet || ActivePoint[geometry->edges->GetNode(iEdge,0)] || ActivePoint[geometry->edges->GetNode(iEdge,1)];
+  }
+
+  /*!
+   * \brief Weight of the fluxes of an edge, 0 if the edge is skipped (multirate sub-step or frozen points).
+   */
+  inline su2double EdgeWeight(const CGeometry *geometry, unsigned long iEdge) const {
+    return ActiveSetEdge(geometry, iEdge) ? TimeLevelEdgeWeight(geometry, iEdge) : su2double(0.0);
+  }
+
+  /*!
+   * \brief Update the active points for the next iteration of the active set mode. The points whose
+   *        residuals (still in LinSysRes) are above a fraction of the RMS of the last full evaluation are
+   *        active, together with ActiveSetBuffer layers of neighbors, all points are active every ActiveSetFreq iterations.
+   * \note Halo points are always active, i.e. the active set is not communicated.
+   * \note Only the edge loops (fluxes and Jacobians) and the updates are restricted to the active points. The frozen
+   *       points remain in the linear system as identity rows with zero right-hand side (the size of the system, and
+   *       the cost of the preconditioner and of the products, do not change), and the gradients and limiters are
+   *       still computed for all points, since the reconstruction of the active edges needs them at the frozen
+   *       neighbors (and restricting them would require a halo of ActiveSetBuffer+1 layers for the gradients).
+   */
+  void UpdateActiveSet(const CGeometry *geometry, const CConfig *config);
+
   /*!
    * \brief Computes and sets the required auxilliary vars (and gradients) for axisymmetric flow.
    */
@@ -351,6 +429,10 @@ class CFVMFlowSolverBase : public CSolver {
                                (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
     const su2double K_v = 0.25;
 
+    /*--- With multirate local time stepping the time steps are fixed during the sub-steps. ---*/
+
+    if (TimeLevelSubStep != 0) return;
+
     /*--- Init thread-shared variables to compute min/max values.
      *    Critical sections are used for this instead of reduction
      *    clauses for compatibility with OpenMP 2.0 (Windows...). ---*/
@@ -509,8 +591,12 @@ class CFVMFlowSolverBase : public CSolver {
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
 
+    /*--- Multirate local time stepping, points advance with multiples of the minimum time step. ---*/
+    if (time_stepping && nTimeLevels > 1) {
+      SetTimeLevels(geometry, config);
+    }
     /*--- For exact time solution use the minimum delta time of the whole mesh. ---*/
-    if (time_stepping) {
+    else if (time_stepping) {
 
       /*--- If the unsteady CFL is set to zero, it uses the defined unsteady time step,
        *    otherwise it computes the time step based on the unsteady CFL. ---*/
@@ -784,6 +870,12 @@ class CFVMFlowSolverBase : public CSolver {
     const su2double* coordMax[MAXNVAR] = {nullptr};
     unsigned long idxMax[MAXNVAR] = {0};
 
+    /*--- The truncation error is not allocated without multigrid with SKIP_UNUSED_FIELDS. ---*/
+    const bool truncError = !nodes->GetResTruncError().empty();
+    const su2double noTruncError[MAXNVAR] = {0.0};
+
+    const bool multirate = (IntegrationType == EULER_EXPLICIT) && (nTimeLevels > 1);
+
     /*--- Update the solution and residuals ---*/
 
     if (!adjoint) {
@@ -793,9 +885,18 @@ class CFVMFlowSolverBase : public CSolver {
         su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
         su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
-        const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
+        const su2double* Res_TruncError = truncError? nodes->GetResTruncError(iPoint) : noTruncError;
         const su2double* Residual = LinSysRes.GetBlock(iPoint);
 
+        /*--- Multirate local time stepping, the residuals of the sub-steps are accumulated and
+         *    the point is only updated at the end of the sub-steps of its time level. ---*/
+        if (multirate) {
+          TimeLevelResidual.AddBlock(iPoint, Residual);
+          if ((TimeLevelSubStep + 1) % (1ul << TimeLevel[iPoint]) != 0) continue;
+          Residual = TimeLevelResidual.GetBlock(iPoint);
+          Delta = Min_Delta_Time / Vol;
+        }
+
         preconditioner.compute(config, iPoint);
 
         for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -839,6 +940,7 @@ class CFVMFlowSolverBase : public CSolver {
             coordMax[iVar] = geometry->nodes->GetCoord(iPoint);
           }
         }
+        if (multirate) TimeLevelResidual.SetBlock_Zero(iPoint);
       }
       END_SU2_OMP_FOR
       /*--- Reduce residual information over all threads in this rank. ---*/
@@ -849,6 +951,13 @@ class CFVMFlowSolverBase : public CSolver {
       }
       END_SU2_OMP_CRITICAL
       SU2_OMP_BARRIER
+
+      if (multirate) {
+        SU2_OMP_MASTER
+        TimeLevelSubStep = (TimeLevelSubStep + 1) % nTimeLevelSubSteps;
+        END_SU2_OMP_MASTER
+        SU2_OMP_BARRIER
+      }
     }
 
     /*--- MPI solution ---*/
@@ -901,6 +1010,10 @@ class CFVMFlowSolverBase : public CSolver {
     const su2double* coordMax[MAXNVAR] = {nullptr};
     unsigned long idxMax[MAXNVAR] = {0};
 
+    /*--- The truncation error is not allocated without multigrid with SKIP_UNUSED_FIELDS. ---*/
+    const bool truncError = !nodes->GetResTruncError().empty();
+    su2double noTruncError[MAXNVAR] = {0.0};
+
     /*--- Add pseudotime term to Jacobian. ---*/
 
     if (implicit) {
@@ -934,7 +1047,19 @@ class CFVMFlowSolverBase : public CSolver {
 
       /*--- Multigrid contribution to residual. ---*/
 
-      su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
+      su2double* local_Res_TruncError = truncError? nodes->GetResTruncError(iPoint) : noTruncError;
+
+      /*--- Active set mode, the residuals of the frozen points are incomplete and
+       *    their rows of the linear system are replaced by identity. ---*/
+
+      if (activeSet && !ActivePoint[iPoint]) {
+        for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+          LinSysRes(iPoint,iVar) = 0.0;
+          LinSysSol(iPoint,iVar) = 0.0;
+          if (implicit) Jacobian.DeleteValsRowi(iPoint*nVar + iVar);
+        }
+        continue;
+      }
 
       if (nodes->GetDelta_Time(iPoint) == 0.0) {
         for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -966,6 +1091,15 @@ class CFVMFlowSolverBase : public CSolver {
     END_SU2_OMP_CRITICAL
     SU2_OMP_BARRIER
 
+    /*--- The frozen points contribute to the RMS with their last residuals. ---*/
+    if (activeSet && !ActiveSetFullEval) {
+      SU2_OMP_MASTER
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        Residual_RMS[iVar] += ActiveSetFrozenRes[iVar];
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+    }
+
     /*--- Compute the root mean square residual ---*/
     SetResidual_RMS(geometry, config);
   }
@@ -984,6 +1118,7 @@ class CFVMFlowSolverBase : public CSolver {
     if (!config->GetContinuous_Adjoint()) {
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        if (activeSet && !ActivePoint[iPoint]) continue;
         for (unsigned short iVar = 0; iVar < nVar; iVar++) {
           nodes->AddSolution(iPoint, iVar, nodes->GetUnderRelaxation(iPoint)*LinSysSol[iPoint*nVar+iVar]);
         }
@@ -991,6 +1126,8 @@ class CFVMFlowSolverBase : public CSolver {
       END_SU2_OMP_FOR
     }
 
+    if (activeSet) UpdateActiveSet(geometry, config);
+
     for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
       InitiatePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
       CompletePeriodicComms(geometry, config, iPeriodic, PERIODIC_IMPLICIT);
@@ -1107,6 +1244,11 @@ class CFVMFlowSolverBase : public CSolver {
    */
   inline void Set_NewSolution() final { nodes->SetSolution_New(); }
 
+  /*!
+   * \brief Get the current sub-step of multirate local time stepping.
+   */
+  inline unsigned long GetTimeLevelSubStep() const final { return TimeLevelSubStep; }
+
   /*!
    * \brief Load a solution from a restart file.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1151,6 +1293,17 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Compute the gradient and the limiter of the primitive variables in one pass over the points,
+   *        if this is requested (FUSED_GRADIENT_LIMITER) and supported by the options in use.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - If true, compute the reconstruction gradient, otherwise the primitive
+   *            gradient (which must then also be the reconstruction gradient).
+   * \return False if nothing was computed, the separate gradient and limiter methods must be used.
+   */
+  bool SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config, bool reconstruction);
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
@@ -29,6 +29,8 @@
 #include "../gradients/computeGradientsGreenGauss.hpp"
 #include "../gradients/computeGradientsLeastSquares.hpp"
 #include "../limiters/computeLimiters.hpp"
+#include "../limiters/computeGradientsAndLimiters.hpp"
+#include "../gradients/computeGradientsEdges.hpp"
 #include "../numerics_simd/CNumericsSIMD.hpp"
 #include "CFVMFlowSolverBase.hpp"
 
@@ -108,6 +110,27 @@ void CFVMFlowSolverBase<V, R>::Allocate(const CConfig& config) {
   /*--- LinSysSol will always be init to 0. ---*/
   System.SetxIsZero(true);
 
+  /*--- Multirate local time stepping (only on the fine grid, checked in CConfig). ---*/
+
+  if ((MGLevel == MESH_0) && (config.GetnLevels_TimeAccurateLTS() > 1)) {
+    nTimeLevels = config.GetnLevels_TimeAccurateLTS();
+    TimeLevel.resize(nPoint) = 0;
+    TimeLevelResidual.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
+  /*--- Active set mode (only for the steady implicit compressible solvers, checked in CConfig). ---*/
+
+  if ((MGLevel == MESH_0) && config.GetActiveSet() && (R == ENUM_REGIME::COMPRESSIBLE)) {
+    activeSet = true;
+    const auto param = config.GetActiveSetParam();
+    ActiveSetRatio = param[0];
+    ActiveSetBuffer = static_cast<unsigned short>(param[1]);
+    ActiveSetFreq = static_cast<unsigned long>(param[2]);
+    ActivePoint.resize(nPoint) = true;
+    ActiveSetLayer.resize(nPoint) = 0;
+    ActiveSetPointRes.resize(nPointDomain, nVar) = su2double(0.0);
+  }
+
   /*--- Store the value of the characteristic primitive variables at the boundaries ---*/
 
   AllocVectorOfMatrices(nVertex, nPrimVar, CharacPrimVar);
@@ -350,6 +373,7 @@ CFVMFlowSolverBase<V, R>::~CFVMFlowSolverBase() {
 
   delete nodes;
   delete edgeNumerics;
+  delete boundaryNumerics;
 }
 
 template <class V, ENUM_REGIME R>
@@ -360,6 +384,12 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_GG(CGeometry* geometry, con
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
   const auto commPer = reconstruction? PERIODIC_PRIM_GG_R : PERIODIC_PRIM_GG;
 
+  /*--- The edge-based version requires conflict-free edge colors. ---*/
+  if (config->GetUseVectorization() && !ReducerStrategy) {
+    computeGradientsGreenGaussEdges(this, comm, commPer, *geometry, *config, EdgeColoring,
+                                    primitives, 0, nPrimVarGrad, gradient);
+    return;
+  }
   computeGradientsGreenGauss(this, comm, commPer, *geometry, *config, primitives, 0, nPrimVarGrad, gradient);
 }
 
@@ -384,6 +414,11 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_LS(CGeometry* geometry, con
   auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
   const auto comm = reconstruction? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
 
+  if (config->GetUseVectorization() && !ReducerStrategy) {
+    computeGradientsLeastSquaresEdges(this, comm, commPer, *geometry, *config, EdgeColoring, weighted,
+                                      primitives, 0, nPrimVarGrad, gradient, rmatrix);
+    return;
+  }
   computeGradientsLeastSquares(this, comm, commPer, *geometry, *config, weighted,
                                primitives, 0, nPrimVarGrad, gradient, rmatrix);
 }
@@ -401,6 +436,30 @@ void CFVMFlowSolverBase<V, R>::SetPrimitive_Limiter(CGeometry* geometry, const C
                   nPrimVarGrad, primitives, gradient, primMin, primMax, limiter);
 }
 
+template <class V, ENUM_REGIME R>
+bool CFVMFlowSolverBase<V, R>::SetPrimitive_Gradient_Limiter(CGeometry* geometry, const CConfig* config,
+                                                             bool reconstruction) {
+  const auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
+  const auto kindGradient = static_cast<ENUM_FLOW_GRADIENT>(reconstruction ? config->GetKind_Gradient_Method_Recon()
+                                                                           : config->GetKind_Gradient_Method());
+
+  /*--- Periodic corrections and frozen limiters need the separate passes. ---*/
+  if (!config->GetFused_Gradient_Limiter() || (config->GetnMarker_Periodic() > 0) ||
+      (config->GetDiscrete_Adjoint() && config->GetFrozen_Limiter_Disc()) ||
+      (kindLimiter == NO_LIMITER) || (kindLimiter == VAN_ALBADA_EDGE) || (kindGradient == NO_GRADIENT))
+    return false;
+
+  const auto& primitives = nodes->GetPrimitive();
+  auto& rmatrix = nodes->GetRmatrix();
+  auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  const auto comm = reconstruction ? PRIMITIVE_GRAD_REC : PRIMITIVE_GRADIENT;
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  computeGradientsAndLimiters(kindLimiter, this, comm, PRIMITIVE_LIMITER, *geometry, *config, kindGradient, 0,
+                              nPrimVarGrad, primitives, gradient, rmatrix, limiter);
+  return true;
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::Viscous_Residual_impl(unsigned long iEdge, CGeometry *geometry, CSolver **solver_container,
                                                      CNumerics *numerics, CConfig *config) {
@@ -450,14 +509,16 @@ void CFVMFlowSolverBase<V, R>::Viscous_Residual_impl(unsigned long iEdge, CGeome
 
   auto residual = numerics->ComputeResidual(config);
 
+  /*--- Multirate local time stepping or active set, skipped edges do not reach this point. ---*/
+  const su2double weight = EdgeWeight(geometry, iEdge);
+
   if (ReducerStrategy) {
-    EdgeFluxes.SubtractBlock(iEdge, residual);
+    EdgeFluxes.AddBlock(iEdge, residual, -weight);
     if (implicit)
       Jacobian.UpdateBlocksSub(iEdge, residual.jacobian_i, residual.jacobian_j);
   }
   else {
-    LinSysRes.SubtractBlock(iPoint, residual);
-    LinSysRes.AddBlock(jPoint, residual);
+    LinSysRes.UpdateBlocks(iPoint, jPoint, residual, -weight);
 
     if (implicit)
       Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
@@ -1165,20 +1226,23 @@ void CFVMFlowSolverBase<V, R>::BC_Sym_Plane(CGeometry* geometry, CSolver** solve
       for (iDim = 0; iDim < nDim; iDim++)
         V_reflected[iDim + 1] = nodes->GetVelocity(iPoint, iDim) - 2.0 * ProjVelocity_i * UnitNormal[iDim];
 
-      /*--- Set Primitive and Secondary for numerics class. ---*/
-      conv_numerics->SetPrimitive(V_domain, V_reflected);
-      conv_numerics->SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(iPoint));
+      /*--- Set Primitive and Secondary for numerics class, unless the
+            convective flux is computed in batches after this loop. ---*/
+      if (!boundaryNumerics) {
+        conv_numerics->SetPrimitive(V_domain, V_reflected);
+        conv_numerics->SetSecondary(nodes->GetSecondary(iPoint), nodes->GetSecondary(iPoint));
 
-      /*--- Compute the residual using an upwind scheme. ---*/
+        /*--- Compute the residual using an upwind scheme. ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+        auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Update residual value ---*/
-      LinSysRes.AddBlock(iPoint, residual);
+        /*--- Update residual value ---*/
+        LinSysRes.AddBlock(iPoint, residual);
 
-      /*--- Jacobian contribution for implicit integration. ---*/
-      if (implicit) {
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        /*--- Jacobian contribution for implicit integration. ---*/
+        if (implicit) {
+          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        }
       }
 
       if (viscous) {
@@ -1283,6 +1347,10 @@ void CFVMFlowSolverBase<V, R>::BC_Sym_Plane(CGeometry* geometry, CSolver** solve
   }      // for iVertex
   END_SU2_OMP_FOR
 
+  /*--- Convective flux with the reflected states computed above. ---*/
+
+  if (boundaryNumerics) BoundaryFluxResidual(geometry, config, val_marker);
+
 }
 
 template <class V, ENUM_REGIME R>
@@ -1541,6 +1609,15 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   if (ReducerStrategy) pausePreacc = AD::PausePreaccumulation();
   else AD::StartNoSharedReading();
 
+  /*--- With multirate local time stepping the fluxes of the edges are weighted (via the mask),
+   *    inactive edges (also those between frozen points of the active set mode) are not
+   *    evaluated, so their stored fluxes need to be cleared. ---*/
+  const bool skipEdges = (nTimeLevels > 1) || activeSet;
+  if (skipEdges && ReducerStrategy) {
+    EdgeFluxes.SetValZero();
+    SU2_OMP_BARRIER
+  }
+
   /*--- Loop over edge colors. ---*/
   for (auto color : EdgeColoring) {
     /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
@@ -1548,11 +1625,14 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     for(auto k = 0ul; k < color.size; k += Double::Size) {
       Int iEdge;
       Double mask;
+      bool active = false;
       for (auto j = 0ul; j < Double::Size; ++j) {
         bool in = (k+j < color.size);
-        mask[j] = in;
         iEdge[j] = color.indices[k+j*in];
+        mask[j] = in ? EdgeWeight(geometry, iEdge[j]) : su2double(0.0);
+        active |= (mask[j] != 0.0);
       }
+      if (skipEdges && !active) continue;
 
       if (ReducerStrategy) {
         edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
@@ -1575,6 +1655,214 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   }
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::BoundaryFluxResidual(const CGeometry *geometry,
+                                                    const CConfig *config,
+                                                    unsigned short val_marker) {
+  const auto nVertex = geometry->nVertex[val_marker];
+  const auto& ghostPrimitive = CharacPrimVar[val_marker];
+
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto k = 0ul; k < nVertex; k += Double::Size) {
+    Int iVertex;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k+j < nVertex);
+      iVertex[j] = k+j*in;
+      mask[j] = in && geometry->nodes->GetDomain(geometry->vertex[val_marker][iVertex[j]]->GetNode());
+    }
+    boundaryNumerics->ComputeBoundaryFlux(val_marker, iVertex, *config, *geometry, *nodes,
+                                          ghostPrimitive, mask, LinSysRes, Jacobian);
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::UpdateActiveSet(const CGeometry* geometry, const CConfig* config) {
+
+  /*--- The thresholds are based on the last full evaluation, during the first period all points are active. ---*/
+
+  const bool fullEval = ActiveSetFullEval;
+  const auto nextIter = config->GetInnerIter() + 1;
+  const bool nextFullEval = (nextIter < ActiveSetFreq) || (nextIter % ActiveSetFreq == 0);
+
+  if (fullEval) {
+    SU2_OMP_MASTER
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) ActiveSetRefRes[iVar] = GetRes_RMS(iVar);
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  if (nextFullEval) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) ActivePoint[iPoint] = true;
+    END_SU2_OMP_FOR
+
+    SU2_OMP_MASTER {
+      ActiveSetFullEval = true;
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) ActiveSetFrozenRes[iVar] = 0.0;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  /*--- Seeds, the active points whose residuals are above the thresholds, and the halos. ---*/
+
+  constexpr auto farAway = std::numeric_limits<unsigned short>::max();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    bool seed = (iPoint >= nPointDomain);
+    if (!seed && ActivePoint[iPoint]) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        seed |= (fabs(LinSysRes(iPoint,iVar)) > ActiveSetRatio * ActiveSetRefRes[iVar]);
+    }
+    ActiveSetLayer[iPoint] = seed ? 0 : farAway;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Buffer layers, the points of each layer are only read by the next one (deterministic in parallel). ---*/
+
+  for (unsigned short iLayer = 1; iLayer <= ActiveSetBuffer; iLayer++) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      if (ActiveSetLayer[iPoint] != farAway) continue;
+      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        if (ActiveSetLayer[jPoint] == iLayer-1) {
+          ActiveSetLayer[iPoint] = iLayer;
+          break;
+        }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Update the active points, the last residuals of the points that are frozen are kept for the RMS,
+   *    and removed from it when the points are reactivated (they contribute their live residuals again). ---*/
+
+  su2double frozenRes[MAXNVAR] = {0.0};
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    const bool active = (ActiveSetLayer[iPoint] <= ActiveSetBuffer);
+    if (ActivePoint[iPoint] && !active) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        ActiveSetPointRes(iPoint,iVar) = pow(LinSysRes(iPoint,iVar), 2);
+        frozenRes[iVar] += ActiveSetPointRes(iPoint,iVar);
+      }
+    }
+    else if (!ActivePoint[iPoint] && active) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        frozenRes[iVar] -= ActiveSetPointRes(iPoint,iVar);
+    }
+    ActivePoint[iPoint] = active;
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_CRITICAL {
+    if (fullEval) ActiveSetFullEval = false;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) ActiveSetFrozenRes[iVar] += frozenRes[iVar];
+  }
+  END_SU2_OMP_CRITICAL
+  SU2_OMP_BARRIER
+
+  /*--- Clip the round-off of the subtractions. ---*/
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) ActiveSetFrozenRes[iVar] = max(ActiveSetFrozenRes[iVar], su2double(0.0));
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetTimeLevels(CGeometry* geometry, CConfig* config) {
+
+  /*--- Round the local time steps down to Min_Delta_Time * 2^level. ---*/
+
+  const su2double dtMin = Min_Delta_Time;
+  const unsigned short maxLevel = nTimeLevels - 1;
+
+  auto LevelOfTimeStep = [dtMin](su2double dt) {
+    return static_cast<unsigned short>(round(log2(SU2_TYPE::GetValue(dt / dtMin))));
+  };
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    unsigned short level = 0;
+    while ((level < maxLevel) && (nodes->GetDelta_Time(iPoint) >= dtMin * (2ul << level))) ++level;
+
+    TimeLevel[iPoint] = level;
+    nodes->SetDelta_Time(iPoint, dtMin * (1ul << level));
+    nodes->SetLocalCFL(iPoint, config->GetUnst_CFL());
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Limit the levels such that neighbors differ at most by one. Each sweep propagates
+   *    the limit by one point, and the level of a point is lowered at most maxLevel times. ---*/
+
+  for (unsigned short iSweep = 0; iSweep < maxLevel; ++iSweep) {
+
+    InitiateComms(geometry, config, TIME_STEP);
+    CompleteComms(geometry, config, TIME_STEP);
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      for (const auto jPoint : geometry->nodes->GetPoints(iPoint)) {
+        const unsigned short level = LevelOfTimeStep(nodes->GetDelta_Time(jPoint)) + 1;
+        TimeLevel[iPoint] = min(TimeLevel[iPoint], level);
+      }
+    }
+    END_SU2_OMP_FOR
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      nodes->SetDelta_Time(iPoint, dtMin * (1ul << TimeLevel[iPoint]));
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Levels of the halo points, which are needed for the edges that cross partitions. ---*/
+
+  InitiateComms(geometry, config, TIME_STEP);
+  CompleteComms(geometry, config, TIME_STEP);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    TimeLevel[iPoint] = LevelOfTimeStep(nodes->GetDelta_Time(iPoint));
+  }
+  END_SU2_OMP_FOR
+
+  /*--- The time step is determined by the coarsest level present in the whole domain. ---*/
+
+  unsigned short maxLevelLocal = 0;
+
+  SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    maxLevelLocal = max(maxLevelLocal, TimeLevel[iPoint]);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  nTimeLevelSubSteps = 1;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  SU2_OMP_CRITICAL
+  nTimeLevelSubSteps = max(nTimeLevelSubSteps, 1ul << maxLevelLocal);
+  END_SU2_OMP_CRITICAL
+  SU2_OMP_BARRIER
+
+  SU2_OMP_MASTER {
+    unsigned long nSubSteps = nTimeLevelSubSteps;
+    SU2_MPI::Allreduce(&nSubSteps, &nTimeLevelSubSteps, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+    Global_Delta_Time = Max_Delta_Time = dtMin * nTimeLevelSubSteps;
+    config->SetDelta_UnstTimeND(Global_Delta_Time);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
 template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
 
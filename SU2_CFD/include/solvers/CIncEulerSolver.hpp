@@ -124,6 +124,13 @@ protected:
    */
   void SetReferenceValues(const CConfig& config) final;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
 public:
   /*!
    * \brief Constructor of the class.
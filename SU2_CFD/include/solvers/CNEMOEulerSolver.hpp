@@ -60,6 +60,8 @@ protected:
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
   CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<unique_ptr<CNEMOGas> > ChemistryModels; /*!< \brief Per-thread fluid models for the chemistry sub-step. */
+  su2activematrix ChemistrySource; /*!< \brief Chemistry and vib. relaxation sources (per volume) after the last sub-step. */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
@@ -90,6 +92,21 @@ protected:
    */
   void SetReferenceValues(const CConfig& config) final;
 
+  /*!
+   * \brief Instantiate a SIMD numerics object.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void InstantiateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) final;
+
+  /*!
+   * \brief Integrate the chemistry and vibrational relaxation sources point-implicitly over the
+   *        time step of each point, separately from the flow (CHEMISTRY_SPLITTING).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ChemistrySubstep(CGeometry *geometry, const CConfig *config);
+
 public:
 
   /*!
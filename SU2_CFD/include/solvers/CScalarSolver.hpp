@@ -32,6 +32,9 @@
 #include "../variables/CScalarVariable.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+class CSourceNumericsSIMD;
+
 /*!
  * \class CScalarSolver
  * \brief Main class for defining a scalar solver.
@@ -71,6 +74,10 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation. */
+  CSourceNumericsSIMD* sourceNumerics = nullptr; /*!< \brief Object for vectorized source term computation. */
+  bool sourceNumericsCreated = false;      /*!< \brief The creation of sourceNumerics was attempted. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -135,6 +142,15 @@ class CScalarSolver : public CSolver {
     }
   }
 
+  /*!
+   * \brief Compute the source terms of the model using vectorized numerics, in batches of points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if the model (or some of its options) is not supported, nothing is computed in that case.
+   */
+  bool PointSourceResidual(CGeometry* geometry, CSolver** solver_container, CConfig* config);
+
  private:
   /*!
    * \brief Compute the viscous flux for the turbulent equation at a particular edge.
@@ -163,6 +179,14 @@ class CScalarSolver : public CSolver {
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Compute the convective and diffusive residuals using vectorized numerics.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, CSolver** solver_container, CConfig* config);
+
   /*!
    * \brief Compute a suitable under-relaxation parameter to limit the change in the solution variables over
    * a nonlinear iteration for stability. Default value 1.0 set in ctor of CScalarVariable.
@@ -199,6 +223,24 @@ class CScalarSolver : public CSolver {
   void Upwind_Residual(CGeometry* geometry, CSolver** solver_container, CNumerics** numerics_container, CConfig* config,
                        unsigned short iMesh) override;
 
+  /*!
+   * \brief Compute the Green-Gauss gradient of the solution, edge-based and vectorized
+   *        when vectorization is enabled (see computeGradientsEdges.hpp).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
+   */
+  void SetSolution_Gradient_GG(CGeometry* geometry, const CConfig* config, bool reconstruction = false) final;
+
+  /*!
+   * \brief Compute the Least Squares gradient of the solution, edge-based and vectorized
+   *        when vectorization is enabled (see computeGradientsEdges.hpp).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
+   */
+  void SetSolution_Gradient_LS(CGeometry* geometry, const CConfig* config, bool reconstruction = false) final;
+
   /*!
    * \brief Impose the Symmetry Plane boundary condition.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -27,7 +27,11 @@
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.hpp"
+#include "../../include/gradients/computeGradientsGreenGauss.hpp"
+#include "../../include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../include/gradients/computeGradientsEdges.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 template <class VariableType>
 CScalarSolver<VariableType>::CScalarSolver(bool conservative) : CSolver(), Conservative(conservative) {}
@@ -78,13 +82,68 @@ CScalarSolver<VariableType>::CScalarSolver(CGeometry* geometry, CConfig* config,
 template <class VariableType>
 CScalarSolver<VariableType>::~CScalarSolver() {
   delete nodes;
+  delete edgeNumerics;
+  delete sourceNumerics;
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::SetSolution_Gradient_GG(CGeometry* geometry, const CConfig* config,
+                                                          bool reconstruction) {
+  /*--- The edge-based version requires conflict-free edge colors. ---*/
+  if (!config->GetUseVectorization() || ReducerStrategy) {
+    CSolver::SetSolution_Gradient_GG(geometry, config, reconstruction);
+    return;
+  }
+
+  const auto& solution = nodes->GetSolution();
+  auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient();
+  const auto comm = reconstruction ? SOLUTION_GRAD_REC : SOLUTION_GRADIENT;
+  const auto commPer = reconstruction ? PERIODIC_SOL_GG_R : PERIODIC_SOL_GG;
+
+  computeGradientsGreenGaussEdges(this, comm, commPer, *geometry, *config, EdgeColoring, solution, 0, nVar, gradient);
+}
+
+template <class VariableType>
+void CScalarSolver<VariableType>::SetSolution_Gradient_LS(CGeometry* geometry, const CConfig* config,
+                                                          bool reconstruction) {
+  if (!config->GetUseVectorization() || ReducerStrategy) {
+    CSolver::SetSolution_Gradient_LS(geometry, config, reconstruction);
+    return;
+  }
+
+  /*--- Set a flag for unweighted or weighted least-squares. ---*/
+  bool weighted;
+  PERIODIC_QUANTITIES commPer;
+
+  if (reconstruction) {
+    weighted = (config->GetKind_Gradient_Method_Recon() == WEIGHTED_LEAST_SQUARES);
+    commPer = weighted ? PERIODIC_SOL_LS_R : PERIODIC_SOL_ULS_R;
+  } else {
+    weighted = (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES);
+    commPer = weighted ? PERIODIC_SOL_LS : PERIODIC_SOL_ULS;
+  }
+
+  const auto& solution = nodes->GetSolution();
+  auto& rmatrix = nodes->GetRmatrix();
+  auto& gradient = reconstruction ? nodes->GetGradient_Reconstruction() : nodes->GetGradient();
+  const auto comm = reconstruction ? SOLUTION_GRAD_REC : SOLUTION_GRADIENT;
+
+  computeGradientsLeastSquaresEdges(this, comm, commPer, *geometry, *config, EdgeColoring, weighted, solution, 0, nVar,
+                                    gradient, rmatrix);
 }
 
 template <class VariableType>
 void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver** solver_container,
                                                CNumerics** numerics_container, CConfig* config, unsigned short iMesh) {
+  if (config->GetUseVectorization()) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  /*--- Within the multigrid cycle of the flow (MG_TURBULENCE) the coarse levels are first order, as
+   *    for the flow. Otherwise the coarse levels (FULLMG) are solved like the finest level. ---*/
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0 || !config->GetMG_Turbulence());
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
 
   /*--- Only reconstruct flow variables if MUSCL is on for flow (requires upwind) and turbulence. ---*/
@@ -241,6 +300,98 @@ void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver**
   }
 }
 
+template <class VariableType>
+void CScalarSolver<VariableType>::EdgeFluxResidual(CGeometry* geometry, CSolver** solver_container, CConfig* config) {
+  const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+
+  if (!edgeNumerics) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      edgeNumerics = CNumericsSIMD::CreateScalarNumerics(*config, nDim, MGLevel,
+                                                         solver_container[FLOW_SOL]->GetNodes(), GetConstants());
+      if (!edgeNumerics)
+        SU2_MPI::Error("The turbulence model in use does not support vectorization.", CURRENT_FUNCTION);
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+
+  /*--- For hybrid parallel AD, pause preaccumulation if there is shared reading of
+   * variables, otherwise switch to the faster adjoint evaluation mode. ---*/
+  bool pausePreacc = false;
+  if (ReducerStrategy)
+    pausePreacc = AD::PausePreaccumulation();
+  else
+    AD::StartNoSharedReading();
+
+  /*--- Loop over edge colors, the convective and diffusive fluxes are computed together. ---*/
+  for (auto color : EdgeColoring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k + j * in];
+      }
+
+      if (ReducerStrategy) {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+      } else {
+        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Restore preaccumulation and adjoint evaluation state. ---*/
+  AD::ResumePreaccumulation(pausePreacc);
+  if (!ReducerStrategy) AD::EndNoSharedReading();
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    if (implicit) Jacobian.SetDiagonalAsColumnSum();
+  }
+}
+
+template <class VariableType>
+bool CScalarSolver<VariableType>::PointSourceResidual(CGeometry* geometry, CSolver** solver_container,
+                                                      CConfig* config) {
+  if (!sourceNumericsCreated) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      sourceNumerics = CSourceNumericsSIMD::CreateSourceNumerics(*config, nDim, MGLevel, solver_container[FLOW_SOL]->GetNodes(),
+                                                                 GetConstants(), Solution_Inf);
+      sourceNumericsCreated = true;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+  }
+  if (!sourceNumerics) return false;
+
+  AD::StartNoSharedReading();
+
+  /*--- Points are processed in contiguous batches, their residuals and diagonal blocks are disjoint. ---*/
+  SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+  for (auto k = 0ul; k < nPointDomain; k += Double::Size) {
+    Int iPoint;
+    Double mask;
+    for (auto j = 0ul; j < Double::Size; ++j) {
+      bool in = (k + j < nPointDomain);
+      mask[j] = in;
+      iPoint[j] = k + j * in;
+    }
+    sourceNumerics->ComputeSource(iPoint, *config, *geometry, *nodes, mask, LinSysRes, Jacobian);
+  }
+  END_SU2_OMP_FOR
+
+  AD::EndNoSharedReading();
+
+  return true;
+}
+
 template <class VariableType>
 void CScalarSolver<VariableType>::SumEdgeFluxes(CGeometry* geometry) {
   SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -286,6 +437,10 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
   const su2double* coordMax[MAXNVAR] = {nullptr};
   unsigned long idxMax[MAXNVAR] = {0};
 
+  /*--- The truncation error is only allocated if the equations are part of the multigrid cycle. ---*/
+  const bool truncError = !nodes->GetResTruncError().empty();
+  su2double noTruncError[MAXNVAR] = {0.0};
+
   /*--- Build implicit system ---*/
 
   SU2_OMP_FOR_(schedule(static, omp_chunk_size) SU2_NOWAIT)
@@ -304,11 +459,19 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
       LinSysRes.SetBlock_Zero(iPoint);
     }
 
+    /*--- Multigrid contribution to residual. ---*/
+
+    su2double* resTruncError = truncError ? nodes->GetResTruncError(iPoint) : noTruncError;
+
+    if (dt == 0.0) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) resTruncError[iVar] = 0.0;
+    }
+
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
       unsigned long total_index = iPoint * nVar + iVar;
-      LinSysRes[total_index] = -LinSysRes[total_index];
+      LinSysRes[total_index] = -(LinSysRes[total_index] + resTruncError[iVar]);
       LinSysSol[total_index] = 0.0;
 
       su2double Res = fabs(LinSysRes[total_index]);
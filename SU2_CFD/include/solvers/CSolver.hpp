@@ -320,6 +320,18 @@ public:
    */
   void SetResidual_RMS(const CGeometry *geometry, const CConfig *config);
 
+  /*!
+   * \brief Estimate the temporal truncation error of the current dual time step (Milne's device), from the
+   *        difference between the current solution and its extrapolation from the previous time levels.
+   * \note The order of the extrapolation must match the order of the time discretization.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] order - Order of the extrapolation (1 or 2).
+   * \param[out] truncError - RMS of the error per variable, scaled like the residuals (volume over time step).
+   */
+  void ComputeTimeTruncationError(const CGeometry *geometry, const CConfig *config,
+                                  unsigned short order, su2double *truncError) const;
+
   /*!
    * \brief Communicate the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -594,7 +606,7 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
    */
-  void SetSolution_Gradient_GG(CGeometry *geometry, const CConfig *config, bool reconstruction = false);
+  virtual void SetSolution_Gradient_GG(CGeometry *geometry, const CConfig *config, bool reconstruction = false);
 
   /*!
    * \brief Compute the Least Squares gradient of the solution.
@@ -602,7 +614,7 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] reconstruction - indicator that the gradient being computed is for upwind reconstruction.
    */
-  void SetSolution_Gradient_LS(CGeometry *geometry, const CConfig *config, bool reconstruction = false);
+  virtual void SetSolution_Gradient_LS(CGeometry *geometry, const CConfig *config, bool reconstruction = false);
 
   /*!
    * \brief Compute the Least Squares gradient of the grid velocity.
@@ -4225,7 +4237,7 @@ public:
    * \brief Retrieve the solver name for output purposes.
    * \param[out] val_solvername - Name of the solver.
    */
-  inline string GetSolverName(void) {return SolverName;}
+  inline const string& GetSolverName(void) const {return SolverName;}
 
   /*!
    * \brief Get the solution fields.
@@ -4304,6 +4316,12 @@ public:
    */
   inline virtual bool GetHasHybridParallel() const { return false; }
 
+  /*!
+   * \brief Get the current sub-step of multirate local time stepping (LEVELS_TIME_ACCURATE_LTS).
+   * \return 0 when all points are at the same time level, i.e. at the end of a time step.
+   */
+  inline virtual unsigned long GetTimeLevelSubStep() const { return 0; }
+
   /*!
    * \brief Get values for streamwise periodc flow: delta P, m_dot, inlet T, integrated heat.
    * \return Struct holding 4 su2doubles.
@@ -28,6 +28,7 @@
 #pragma once
 
 #include "CFlowVariable.hpp"
+#include "../fluid/CFluidModel.hpp"
 
 /*!
  * \class CEulerVariable
@@ -105,6 +106,20 @@ public:
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a batch of consecutive points, using
+   *        the batched (array-based) interface of the fluid model.
+   * \param[in] iPointBegin - First point of the batch, batch.size is the number of points.
+   * \param[in,out] batch - Work space for the fluid model.
+   * \param[in] FluidModel - Fluid model.
+   * \param[in] eddyVisc - Eddy viscosity of the points (may be null for inviscid flows).
+   * \param[in] turbKE - Turbulent kinetic energy of the points (may be null).
+   * \return Number of non-physical points, for which the old solution was restored.
+   */
+  virtual unsigned long SetPrimVar_Batch(unsigned long iPointBegin, CFluidModel::StateBatch& batch,
+                                         CFluidModel *FluidModel, const su2double* eddyVisc,
+                                         const su2double* turbKE);
+
   /*!
    * \brief A virtual member.
    */
@@ -246,6 +261,7 @@ public:
    * \param[in] iPoint - Point index.
    */
   inline void SetVel_ResTruncError_Zero(unsigned long iPoint) final {
+    if (Res_TruncError.empty()) return;
     for (unsigned long iDim = 0; iDim < nDim; iDim++) Res_TruncError(iPoint,iDim+1) = 0.0;
   }
 
@@ -237,6 +237,11 @@ class CFlowVariable : public CVariable {
    */
   inline su2double* GetVorticity(unsigned long iPoint) final { return Vorticity[iPoint]; }
 
+  /*!
+   * \brief Get the vorticity of all points (3 values also in 2D).
+   */
+  inline const MatrixType& GetVorticity() const { return Vorticity; }
+
   /*!
    * \brief Get the magnitude of rate of strain.
    * \param[in] iPoint - Point index.
@@ -249,4 +254,5 @@ class CFlowVariable : public CVariable {
    * \return Vector of magnitudes.
    */
   inline su2activevector& GetStrainMag() { return StrainMag; }
+  inline const su2activevector& GetStrainMag() const { return StrainMag; }
 };
@@ -281,16 +281,19 @@ class CNEMOEulerVariable : public CFlowVariable {
    * \brief Returns the stored value of Eve at the specified node
    */
   inline su2double *GetEve(unsigned long iPoint) { return eves[iPoint]; }
+  inline const MatrixType& GetEve() const { return eves; }
 
   /*!
    * \brief Returns the value of Cvve at the specified node
    */
   su2double *GetCvve(unsigned long iPoint) { return Cvves[iPoint]; }
+  inline const MatrixType& GetCvve() const { return Cvves; }
 
   /*!
    * \brief Set partial derivative of pressure w.r.t. density \f$\frac{\partial P}{\partial \rho_s}\f$
    */
   inline su2double *GetdPdU(unsigned long iPoint) final { return dPdU[iPoint]; }
+  inline const MatrixType& GetdPdU() const { return dPdU; }
 
   /*!
    * \brief Set partial derivative of temperature w.r.t. density \f$\frac{\partial T}{\partial \rho_s}\f$
@@ -315,6 +318,7 @@ class CNEMOEulerVariable : public CFlowVariable {
    * \brief Returns the stored value of Gamma at the specified node
    */
   inline su2double GetGamma(unsigned long iPoint) { return Gamma(iPoint); }
+  inline const VectorType& GetGamma() const { return Gamma; }
 
   /*---------------------------------------*/
   /*---           NEMO indices          ---*/
@@ -385,6 +389,7 @@ class CNEMOEulerVariable : public CFlowVariable {
    * \param[in] iPoint - Point index.
    */
   inline void SetVel_ResTruncError_Zero(unsigned long iPoint) final {
+    if (Res_TruncError.empty()) return;
     for (unsigned long iDim = 0; iDim < nDim; iDim++) Res_TruncError(iPoint,nSpecies+iDim) = 0.0;
   }
 
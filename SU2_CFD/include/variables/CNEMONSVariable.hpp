@@ -98,6 +98,7 @@ public:
    * \return Value of the species diffusion coefficient.
    */
   inline su2double* GetDiffusionCoeff(unsigned long iPoint) override { return DiffusionCoeff[iPoint]; }
+  inline const MatrixType& GetDiffusionCoeff() const { return DiffusionCoeff; }
 
   /*!
    * \brief Get the species enthalpy.
@@ -122,12 +123,14 @@ public:
    * \return Value of the laminar viscosity of the flow.
    */
   inline su2double GetThermalConductivity(unsigned long iPoint) const override {return ThermalCond(iPoint); }
+  inline const VectorType& GetThermalConductivity() const { return ThermalCond; }
 
   /*!
    * \brief Get the vib-el. thermal conductivity of the flow.
    * \return Value of the laminar viscosity of the flow.
    */
   inline su2double GetThermalConductivity_ve(unsigned long iPoint) const override { return ThermalCond_ve(iPoint); }
+  inline const VectorType& GetThermalConductivity_ve() const { return ThermalCond_ve; }
 
   /*!
    * \brief Set the temperature at the wall
@@ -150,6 +150,14 @@ public:
   bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) override;
   using CVariable::SetPrimVar;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a batch of points, including the transport properties.
+   * \note See CEulerVariable::SetPrimVar_Batch.
+   */
+  unsigned long SetPrimVar_Batch(unsigned long iPointBegin, CFluidModel::StateBatch& batch,
+                                 CFluidModel *FluidModel, const su2double* eddyVisc,
+                                 const su2double* turbKE) override;
+
   /*!
    * \brief Set all the secondary variables (partial derivatives) for compressible flows
    */
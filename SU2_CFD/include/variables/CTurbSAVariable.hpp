@@ -81,6 +81,7 @@ public:
    * \return Value of the DES length Scale.
    */
   inline su2double GetDES_LengthScale(unsigned long iPoint) const override { return DES_LengthScale(iPoint); }
+  inline const VectorType& GetDES_LengthScale() const { return DES_LengthScale; }
 
   /*!
    * \brief Set the DES Length Scale.
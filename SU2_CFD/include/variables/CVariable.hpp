@@ -56,8 +56,8 @@ protected:
 
   MatrixType External;       /*!< \brief External (outer) contribution in discrete adjoint multizone problems. */
 
-  su2vector<bool> Non_Physical;  /*!< \brief Non-physical points in the solution (force first order). */
-  su2vector<unsigned short>
+  mutable su2vector<bool> Non_Physical;  /*!< \brief Non-physical points in the solution (force first order). */
+  mutable su2vector<unsigned short>
   Non_Physical_Counter;          /*!< \brief Number of consecutive iterations that a point has been treated first-order.
                                   After a specified number of successful reconstructions, the point can be returned to second-order. */
 
@@ -66,6 +66,7 @@ protected:
 
   MatrixType Solution_time_n;    /*!< \brief Solution of the problem at time n for dual-time stepping technique. */
   MatrixType Solution_time_n1;   /*!< \brief Solution of the problem at time n-1 for dual-time stepping technique. */
+  MatrixType Solution_time_n2;   /*!< \brief Solution at time n-2, only for the quadratic extrapolation of the initial guess. */
   VectorType Delta_Time;         /*!< \brief Time step. */
 
   CVectorOfMatrix Gradient;  /*!< \brief Gradient of the solution of the problem. */
@@ -193,8 +194,9 @@ public:
    * \brief Set the value of the non-physical point.
    * \param[in] iPoint - Point index.
    * \param[in] value - identification of the non-physical point.
+   * \note Const because the flags are also updated by the (const) vectorized edge kernels.
    */
-  inline void SetNon_Physical(unsigned long iPoint, bool val_value) {
+  inline void SetNon_Physical(unsigned long iPoint, bool val_value) const {
     if (val_value) {
       Non_Physical(iPoint) = val_value;
       Non_Physical_Counter(iPoint) = 0;
@@ -211,7 +213,7 @@ public:
    * \param[in] iPoint - Point index.
    * \return Value of the Non-physical point.
    */
-  inline bool GetNon_Physical(unsigned long iPoint) { return Non_Physical(iPoint); }
+  inline bool GetNon_Physical(unsigned long iPoint) const { return Non_Physical(iPoint); }
 
   /*!
    * \brief Get the solution.
@@ -263,10 +265,33 @@ public:
   void Set_Solution_time_n();
 
   /*!
-   * \brief Set the variable solution at time n-1.
+   * \brief Set the variable solution at time n-1 (and n-2 if stored).
    */
   void Set_Solution_time_n1();
 
+  /*!
+   * \brief Extrapolate the solution at time n+1 from the solutions at time n, n-1, and n-2.
+   * \param[in] iPoint - Point index.
+   * \param[in] iVar - Index of the variable.
+   * \param[in] order - Order of the extrapolation (0, 1, or 2).
+   * \return Extrapolated value.
+   */
+  inline su2double GetSolution_time_extrapolation(unsigned long iPoint, unsigned long iVar, unsigned short order) const {
+    switch (order) {
+      case 1: return 2*Solution_time_n(iPoint,iVar) - Solution_time_n1(iPoint,iVar);
+      case 2: return 3*(Solution_time_n(iPoint,iVar) - Solution_time_n1(iPoint,iVar)) + Solution_time_n2(iPoint,iVar);
+      default: return Solution_time_n(iPoint,iVar);
+    }
+  }
+
+  /*!
+   * \brief Set the solution to its extrapolation from the previous time levels, as the initial guess
+   *        of a new dual time step. Points where a positive variable would change sign keep the solution at time n.
+   * \param[in] order - Order of the extrapolation (1 or 2).
+   * \param[in] positiveVars - Indices of the variables that must not change sign (e.g. density).
+   */
+  void ExtrapolateSolution_time(unsigned short order, const vector<unsigned short>& positiveVars);
+
   /*!
    * \brief Set the variable solution at time n.
    * \param[in] iPoint - Point index.
@@ -628,7 +653,7 @@ public:
    * \param[in] iPoint - Point index.
    */
   inline void SetRes_TruncErrorZero(unsigned long iPoint) {
-    for (unsigned long iVar = 0; iVar < nVar; iVar++) Res_TruncError(iPoint, iVar) = 0.0;
+    for (unsigned long iVar = 0; iVar < Res_TruncError.cols(); iVar++) Res_TruncError(iPoint, iVar) = 0.0;
   }
 
   /*!
@@ -656,6 +681,11 @@ public:
    */
   inline su2double *GetResTruncError(unsigned long iPoint) { return Res_TruncError[iPoint]; }
 
+  /*!
+   * \brief Get the truncation error of all points (empty if it is not allocated, see SKIP_UNUSED_FIELDS).
+   */
+  inline const MatrixType& GetResTruncError() const { return Res_TruncError; }
+
   /*!
    * \brief Get the truncation error.
    * \param[in] iPoint - Point index.
@@ -682,6 +712,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -728,6 +759,7 @@ public:
    * \return Reference to the limiters vector.
    */
   inline MatrixType& GetLimiter(void) { return Limiter; }
+  inline const MatrixType& GetLimiter(void) const { return Limiter; }
 
   /*!
    * \brief Get the value of the slope limiter.
@@ -104,6 +104,7 @@ int main(int argc, char *argv[]) {
   const bool disc_adj = config.GetDiscrete_Adjoint();
   const bool multizone = config.GetMultizone_Problem();
   const bool harmonic_balance = (config.GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE);
+  const bool time_parallel = (config.GetnTime_Parallel_Groups() > 1);
 
   if (dry_run) {
 
@@ -120,6 +121,10 @@ int main(int argc, char *argv[]) {
     if (disc_adj) {
       driver = new CDiscAdjSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
+    else if (time_parallel) {
+      /*--- Parallel-in-time problem: the ranks are split in groups, one per slice of the time window. ---*/
+      driver = new CPararealDriver(config_file_name, nZone, MPICommunicator, config.GetiTime_Parallel_Group());
+    }
     else {
       driver = new CSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
@@ -138,8 +143,10 @@ int main(int argc, char *argv[]) {
   }
   else if (harmonic_balance) {
 
-    /*--- Harmonic balance problem: instantiate the Harmonic Balance driver class. ---*/
-    driver = new CHBDriver(config_file_name, nZone, MPICommunicator);
+    /*--- Harmonic balance problem: instantiate the Harmonic Balance driver class,
+     the time instances may be distributed over groups of ranks. ---*/
+    driver = new CHBDriver(config_file_name, nZone, MPICommunicator,
+                           config.GetnHB_Parallel_Groups(), config.GetiHB_Parallel_Group());
 
   }
   else if (turbo) {
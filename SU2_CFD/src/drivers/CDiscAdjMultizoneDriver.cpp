@@ -568,6 +568,7 @@ void CDiscAdjMultizoneDriver::EvaluateSensitivities(unsigned long Iter, bool for
 void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape tape_type, unsigned short record_zone) {
 
   AD::Reset();
+  driver_config->ClearTapeRegions();
 
   /*--- Prepare for recording by resetting the solution to the initial converged solution. ---*/
 
@@ -668,6 +669,13 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
     Print_DirectResidual(kind_recording);
   }
 
+  if (kind_recording != RECORDING::CLEAR_INDICES) {
+    unsigned long nPointGlobal = 0;
+    for (iZone = 0; iZone < nZone; iZone++)
+      nPointGlobal += geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain();
+    driver_config->SetTapeRegions_Summary(nPointGlobal, driver_config->GetWrt_AD_Statistics());
+  }
+
   if (kind_recording != RECORDING::CLEAR_INDICES && driver_config->GetWrt_AD_Statistics()) {
     if (rank == MASTER_NODE) AD::PrintStatistics();
 #ifdef CODI_REVERSE_TYPE
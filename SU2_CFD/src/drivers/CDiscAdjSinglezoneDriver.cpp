@@ -32,6 +32,7 @@
 #include "../../include/output/COutput.hpp"
 #include "../../include/iteration/CIterationFactory.hpp"
 #include "../../include/iteration/CTurboIteration.hpp"
+#include "../../include/iteration/CPrimalCheckpoints.hpp"
 #include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
@@ -117,15 +118,118 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- Unsteady adjoints can recompute the primal states from checkpoints instead of reading restart files. ---*/
+
+  if (config->GetUnst_AdjointCheckpoints() > 0) {
+    primal_checkpoints = new CPrimalCheckpoints(config, geometry_container[ZONE_0][INST_0],
+                                                solver_container[ZONE_0][INST_0],
+                                                [this](long DirectIter) { RecomputePrimalStep(DirectIter); });
+    iteration->SetPrimalCheckpoints(primal_checkpoints);
+  }
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver(void) {
 
   delete direct_iteration;
   delete direct_output;
+  delete primal_checkpoints;
 
 }
 
+void CDiscAdjSinglezoneDriver::StartSolver() {
+
+  if (config->GetTape_DryRun()) TapeDryRun();
+  else CSinglezoneDriver::StartSolver();
+
+}
+
+void CDiscAdjSinglezoneDriver::TapeDryRun() {
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"--------------------------- Tape Memory Dry Run --------------------------" << endl;
+
+  if (config->GetRestart() && config->GetTime_Domain()) TimeIter = config->GetRestart_Iter();
+
+  /*--- Load the primal state of the first time step, as for the adjoint iterations. ---*/
+
+  config->SetTimeIter(TimeIter);
+
+  iteration->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
+                        solver_container, numerics_container, config_container,
+                        surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+  /*--- The two tapes are never stored at the same time, the peak is the larger one. Only the inputs of the first
+   *    points of each rank are registered (TAPE_DRY_RUN_FRACTION), the operations that depend on them are recorded
+   *    and the memory of the full tapes is extrapolated with the memory per recorded point. ---*/
+
+  passivedouble peakMemory = 0.0, totalMemory = 0.0;
+
+  for (auto kind_recording : {MainVariables, SecondaryVariables}) {
+    SetRecording(RECORDING::CLEAR_INDICES);
+    SetRecording(kind_recording);
+    const passivedouble scale = passivedouble(geometry->GetGlobal_nPointDomain()) / max(nPointRecorded, 1ul);
+    if (scale * config->GetTape_PeakMemory() > peakMemory) {
+      peakMemory = scale * config->GetTape_PeakMemory();
+      totalMemory = scale * config->GetTape_Memory();
+    }
+  }
+  SetRecording(RECORDING::CLEAR_INDICES);
+
+  if (rank == MASTER_NODE) {
+    cout << "\nEstimated peak tape memory (without the adjoint vectors of the evaluation), extrapolated from "
+         << 100.0 * SU2_TYPE::GetValue(config->GetTape_DryRun_Fraction()) << "% of the points:\n";
+    cout << "  Largest rank : " << peakMemory << " MB\n";
+    cout << "  All ranks    : " << totalMemory << " MB" << endl;
+  }
+
+}
+
+unsigned long CDiscAdjSinglezoneDriver::ResetInputsBeyondFraction(RECORDING kind_recording) {
+
+  const bool resetSolution = (kind_recording == RECORDING::SOLUTION_VARIABLES) ||
+                             (kind_recording == RECORDING::SOLUTION_AND_MESH);
+  const bool resetCoords = (kind_recording == RECORDING::MESH_COORDS) ||
+                           (kind_recording == RECORDING::SOLUTION_AND_MESH);
+
+  if (!resetSolution && !resetCoords) return geometry->GetGlobal_nPointDomain();
+
+  const auto fraction = SU2_TYPE::GetValue(config->GetTape_DryRun_Fraction());
+  const auto nPointInput = min(static_cast<unsigned long>(ceil(fraction * geometry->GetnPointDomain())),
+                               geometry->GetnPointDomain());
+
+  /*--- Halo points are reset too. ---*/
+
+  for (auto iPoint = nPointInput; iPoint < geometry->GetnPoint(); ++iPoint) {
+
+    if (resetSolution) {
+      for (auto iSol : {FLOW_SOL, TURB_SOL, HEAT_SOL, RAD_SOL}) {
+        auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+        if (solver == nullptr) continue;
+        auto nodes = solver->GetNodes();
+
+        for (auto iVar = 0u; iVar < solver->GetnVar(); ++iVar) {
+          AD::ResetInput(nodes->GetSolution(iPoint)[iVar]);
+          if (config->GetTime_Domain())
+            AD::ResetInput(nodes->GetSolution_time_n(iPoint)[iVar]);
+          if (config->GetTime_Marching() != TIME_MARCHING::STEADY)
+            AD::ResetInput(nodes->GetSolution_time_n1(iPoint)[iVar]);
+        }
+      }
+    }
+
+    if (resetCoords) {
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        AD::ResetInput(geometry->nodes->GetCoord(iPoint)[iDim]);
+    }
+  }
+
+  unsigned long nPointInputGlobal = 0;
+  SU2_MPI::Allreduce(&nPointInput, &nPointInputGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  return nPointInputGlobal;
+}
+
 void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
   config_container[ZONE_0]->SetTimeIter(TimeIter);
@@ -239,6 +343,7 @@ void CDiscAdjSinglezoneDriver::Postprocess() {
 void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
   AD::Reset();
+  config->ClearTapeRegions();
 
   /*--- Prepare for recording by resetting the solution to the initial converged solution. ---*/
 
@@ -270,6 +375,12 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
     AD::StartRecording();
 
     iteration->RegisterInput(solver_container, geometry_container, config_container, ZONE_0, INST_0, kind_recording);
+
+    /*--- The tape dry run only records the operations that depend on a fraction of the points. ---*/
+
+    nPointRecorded = geometry->GetGlobal_nPointDomain();
+    if (config->GetTape_DryRun() && config->GetTape_DryRun_Fraction() < 1.0)
+      nPointRecorded = ResetInputsBeyondFraction(kind_recording);
   }
 
   /*--- Set the dependencies of the iteration ---*/
@@ -293,6 +404,11 @@ void CDiscAdjSinglezoneDriver::SetRecording(RECORDING kind_recording){
 
   SetObjFunction();
 
+  if (kind_recording != RECORDING::CLEAR_INDICES) {
+    config->SetTapeRegions_Summary(nPointRecorded,
+                                   config->GetWrt_AD_Statistics() || config->GetTape_DryRun());
+  }
+
   if (kind_recording != RECORDING::CLEAR_INDICES && config_container[ZONE_0]->GetWrt_AD_Statistics()) {
     if (rank == MASTER_NODE) AD::PrintStatistics();
 #ifdef CODI_REVERSE_TYPE
@@ -450,6 +566,57 @@ void CDiscAdjSinglezoneDriver::DirectRun(RECORDING kind_recording){
 
 }
 
+void CDiscAdjSinglezoneDriver::RecomputePrimalStep(long DirectIter) {
+
+  const auto TimeIter = config->GetTimeIter();
+  const auto InnerIter = config->GetInnerIter();
+
+  /*--- The direct iteration of the adjoint driver expects the reversed time index (see DirectRun). ---*/
+
+  config->SetTimeIter(config->GetUnst_AdjointIter() - DirectIter - 1);
+
+  /*--- The inner iterations stop with the convergence criteria of the direct problem (CONV_FIELD,
+   *    CONV_RESIDUAL_MINVAL, CONV_CAUCHY_EPS, ...) evaluated by the direct output. If the convergence
+   *    fields are not direct history fields (e.g. adjoint residuals) the density residual is monitored.
+   *    The number of inner iterations is bounded by INNER_ITER of this configuration, which is shared
+   *    with the adjoint iterations and therefore should not be smaller than that of the direct run. ---*/
+
+  bool directConvFields = (config->GetnConv_Field() > 0);
+  const auto historyFields = direct_output->GetHistoryFields();
+  for (auto iField = 0u; iField < config->GetnConv_Field(); iField++)
+    directConvFields &= (historyFields.count(config->GetConv_Field(iField)) > 0);
+
+  for (auto Inner_Iter = 0ul; Inner_Iter < config->GetnInner_Iter(); Inner_Iter++) {
+
+    config->SetInnerIter(Inner_Iter);
+
+    direct_iteration->Preprocess(direct_output, integration_container, geometry_container, solver_container,
+                                 numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                                 ZONE_0, INST_0);
+
+    direct_iteration->Iterate(direct_output, integration_container, geometry_container, solver_container,
+                              numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                              ZONE_0, INST_0);
+
+    if (directConvFields) {
+      direct_output->SetHistory_Output(geometry, solver, config, config->GetTimeIter(),
+                                       config->GetOuterIter(), Inner_Iter);
+      if (direct_output->GetConvergence()) break;
+    }
+    else if (log10(solver[FLOW_SOL]->GetRes_RMS(0)) < config->GetMinLogResidual()) break;
+  }
+
+  /*--- Push the converged solution back to the time levels n and n-1. ---*/
+
+  direct_iteration->Update(direct_output, integration_container, geometry_container, solver_container,
+                           numerics_container, config_container, surface_movement, grid_movement, FFDBox,
+                           ZONE_0, INST_0);
+
+  config->SetTimeIter(TimeIter);
+  config->SetInnerIter(InnerIter);
+
+}
+
 void CDiscAdjSinglezoneDriver::MainRecording(){
 
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
@@ -127,6 +127,11 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   Input_Preprocessing(config_container, driver_config);
 
+  /*--- Per-phase timers of the preprocessing, they are reduced over all ranks
+   and written to profiling.csv when SU2 is compiled with -DPROFILE. ---*/
+
+  double tick = 0.0;
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -134,14 +139,16 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   /*--- Output preprocessing ---*/
 
+  driver_config->Tick(&tick);
   Output_Preprocessing(config_container, driver_config, output_container, driver_output);
+  driver_config->Tock(tick, "CDriver::Output_Preprocessing", 0);
 
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
     /*--- Read the number of instances for each zone ---*/
 
-    nInst[iZone] = config_container[iZone]->GetnTimeInstances();
+    nInst[iZone] = config_container[iZone]->GetnLocal_TimeInstances();
 
     geometry_container[iZone]    = new CGeometry**    [nInst[iZone]] ();
     iteration_container[iZone]   = new CIteration*    [nInst[iZone]] ();
@@ -157,14 +164,16 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
     for (iInst = 0; iInst < nInst[iZone]; iInst++) {
 
-      config_container[iZone]->SetiInst(iInst);
+      config_container[iZone]->SetiInst(config_container[iZone]->GetFirst_TimeInstance() + iInst);
 
       /*--- Preprocessing of the geometry for all zones. In this routine, the edge-
        based data structure is constructed, i.e. node and cell neighbors are
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
+      config_container[iZone]->Tick(&tick);
       Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      config_container[iZone]->Tock(tick, "CDriver::Geometrical_Preprocessing", 0);
 
     }
   }
@@ -174,12 +183,16 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
   if (rank == MASTER_NODE)
     cout << "Computing wall distances." << endl;
 
+  driver_config->Tick(&tick);
   CGeometry::ComputeWallDistance(config_container, geometry_container);
+  driver_config->Tock(tick, "CGeometry::ComputeWallDistance", 0);
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
     for (iInst = 0; iInst < nInst[iZone]; iInst++){
 
+      config_container[iZone]->SetiInst(config_container[iZone]->GetFirst_TimeInstance() + iInst);
+
       /*--- Definition of the solver class: solver_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS].
        The solver classes are specific to a particular set of governing equations,
        and they contain the subroutines with instructions for computing each spatial
@@ -187,7 +200,9 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
        fluxes, loops over the nodes to compute source terms, and routines for
        imposing various boundary condition type for the PDE. ---*/
 
+      config_container[iZone]->Tick(&tick);
       Solver_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst]);
+      config_container[iZone]->Tock(tick, "CDriver::Solver_Preprocessing", 0);
 
       /*--- Definition of the numerical method class:
        numerics_container[#ZONES][#INSTANCES][#MG_GRIDS][#EQ_SYSTEMS][#EQ_TERMS].
@@ -196,8 +211,10 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
        data structure (centered, upwind, galerkin), as well as any source terms
        (piecewise constant reconstruction) evaluated in each dual mesh volume. ---*/
 
+      config_container[iZone]->Tick(&tick);
       Numerics_Preprocessing(config_container[iZone], geometry_container[iZone][iInst],
                              solver_container[iZone][iInst], numerics_container[iZone][iInst]);
+      config_container[iZone]->Tock(tick, "CDriver::Numerics_Preprocessing", 0);
 
       /*--- Definition of the integration class: integration_container[#ZONES][#INSTANCES][#EQ_SYSTEMS].
        The integration class orchestrates the execution of the spatial integration
@@ -205,8 +222,10 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
        the residual at each node, R(U) and then integrates the equations to a
        steady state or time-accurately. ---*/
 
+      config_container[iZone]->Tick(&tick);
       Integration_Preprocessing(config_container[iZone], solver_container[iZone][iInst][MESH_0],
                                 integration_container[iZone][iInst]);
+      config_container[iZone]->Tock(tick, "CDriver::Integration_Preprocessing", 0);
 
       /*--- Instantiate the type of physics iteration to be executed within each zone. For
        example, one can execute the same physics across multiple zones (mixing plane),
@@ -217,11 +236,16 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
       /*--- Dynamic mesh processing.  ---*/
 
+      config_container[iZone]->Tick(&tick);
       DynamicMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], solver_container[iZone][iInst],
                                 iteration_container[iZone][iInst], grid_movement[iZone][iInst], surface_movement[iZone]);
+      config_container[iZone]->Tock(tick, "CDriver::DynamicMesh_Preprocessing", 0);
+
       /*--- Static mesh processing.  ---*/
 
+      config_container[iZone]->Tick(&tick);
       StaticMesh_Preprocessing(config_container[iZone], geometry_container[iZone][iInst]);
+      config_container[iZone]->Tock(tick, "CDriver::StaticMesh_Preprocessing", 0);
 
     }
 
@@ -238,8 +262,10 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Multizone Interface Preprocessing -------------------" << endl;
 
+    driver_config->Tick(&tick);
     Interface_Preprocessing(config_container, solver_container, geometry_container,
                             interface_types, interface_container, interpolator_container);
+    driver_config->Tock(tick, "CDriver::Interface_Preprocessing", 0);
   }
 
   if (fsi) {
@@ -255,7 +281,9 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
     if (rank == MASTER_NODE)
       cout << endl <<"---------------------- Turbomachinery Preprocessing ---------------------" << endl;
 
+    driver_config->Tick(&tick);
     Turbomachinery_Preprocessing(config_container, geometry_container, solver_container, interface_container);
+    driver_config->Tock(tick, "CDriver::Turbomachinery_Preprocessing", 0);
   }
 
 
@@ -706,10 +734,14 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   unsigned short requestedMGlevels = config->GetnMGLevels();
   const bool fea = config->GetStructuralProblem();
 
+  double tick = 0.0;
+
   /*--- Definition of the geometry class to store the primal grid in the partitioning process.
    *    All ranks process the grid and call ParMETIS for partitioning ---*/
 
+  config->Tick(&tick);
   CGeometry *geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  config->Tock(tick, "CPhysicalGeometry::Read_Mesh", 1);
 
   /*--- Set the dimension --- */
 
@@ -717,7 +749,9 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
 
+  config->Tick(&tick);
   geometry_aux->SetColorGrid_Parallel(config);
+  config->Tock(tick, "CPhysicalGeometry::SetColorGrid_Parallel", 1);
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -733,30 +767,42 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   delete geometry_aux;
 
   /*--- Add the Send/Receive boundaries ---*/
+  config->Tick(&tick);
   geometry[MESH_0]->SetSendReceive(config);
+  config->Tock(tick, "CPhysicalGeometry::SetSendReceive", 1);
 
   /*--- Add the Send/Receive boundaries ---*/
+  config->Tick(&tick);
   geometry[MESH_0]->SetBoundaries(config);
+  config->Tock(tick, "CPhysicalGeometry::SetBoundaries", 1);
 
   /*--- Compute elements surrounding points, points surrounding points ---*/
 
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
+  config->Tick(&tick);
   geometry[MESH_0]->SetPoint_Connectivity();
+  config->Tock(tick, "CPhysicalGeometry::SetPoint_Connectivity", 1);
 
   /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
 
   if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+  config->Tick(&tick);
   geometry[MESH_0]->SetRCM_Ordering(config);
+  config->Tock(tick, "CPhysicalGeometry::SetRCM_Ordering", 1);
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
   if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
+  config->Tick(&tick);
   geometry[MESH_0]->SetPoint_Connectivity();
+  config->Tock(tick, "CPhysicalGeometry::SetPoint_Connectivity", 1);
 
   /*--- Compute elements surrounding elements ---*/
 
   if (rank == MASTER_NODE) cout << "Setting element connectivity." << endl;
+  config->Tick(&tick);
   geometry[MESH_0]->SetElement_Connectivity();
+  config->Tock(tick, "CPhysicalGeometry::SetElement_Connectivity", 1);
 
   /*--- Check the orientation before computing geometrical quantities ---*/
 
@@ -770,17 +816,21 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   /*--- Create the edge structure ---*/
 
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
+  config->Tick(&tick);
   geometry[MESH_0]->SetEdges();
   geometry[MESH_0]->SetVertex(config);
+  config->Tock(tick, "CPhysicalGeometry::SetEdges_SetVertex", 1);
 
   /*--- Create the control volume structures ---*/
 
   if (rank == MASTER_NODE) cout << "Setting the control volume structure." << endl;
+  config->Tick(&tick);
   SU2_OMP_PARALLEL {
     geometry[MESH_0]->SetControlVolume(config, ALLOCATE);
     geometry[MESH_0]->SetBoundControlVolume(config, ALLOCATE);
   }
   END_SU2_OMP_PARALLEL
+  config->Tock(tick, "CPhysicalGeometry::SetControlVolume", 1);
 
   /*--- Visualize a dual control volume if requested ---*/
 
@@ -791,7 +841,9 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   /*--- Identify closest normal neighbor ---*/
 
   if (rank == MASTER_NODE) cout << "Searching for the closest normal neighbors to the surfaces." << endl;
+  config->Tick(&tick);
   geometry[MESH_0]->FindNormal_Neighbor(config);
+  config->Tock(tick, "CPhysicalGeometry::FindNormal_Neighbor", 1);
 
   /*--- Store the global to local mapping. ---*/
 
@@ -802,7 +854,9 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   if (!fea) {
     if (rank == MASTER_NODE) cout << "Compute the surface curvature." << endl;
+    config->Tick(&tick);
     geometry[MESH_0]->ComputeSurf_Curvature(config);
+    config->Tock(tick, "CPhysicalGeometry::ComputeSurf_Curvature", 1);
   }
 
   /*--- Check for periodicity and disable MG if necessary. ---*/
@@ -815,7 +869,9 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   if (!fea) {
     if (rank == MASTER_NODE)
       cout << "Computing mesh quality statistics for the dual control volumes." << endl;
+    config->Tick(&tick);
     geometry[MESH_0]->ComputeMeshQualityStatistics(config);
+    config->Tock(tick, "CPhysicalGeometry::ComputeMeshQualityStatistics", 1);
   }
 
   geometry[MESH_0]->SetMGLevel(MESH_0);
@@ -824,6 +880,8 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   /*--- Loop over all the new grid ---*/
 
+  config->Tick(&tick);
+
   for (iMGlevel = 1; iMGlevel <= config->GetnMGLevels(); iMGlevel++) {
 
     /*--- Create main agglomeration structure ---*/
@@ -866,6 +924,8 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   }
 
+  config->Tock(tick, "CMultiGridGeometry::Agglomeration", 1);
+
   if (config->GetWrt_MultiGrid()) geometry[MESH_0]->ColorMGLevels(config->GetnMGLevels(), geometry);
 
   /*--- For unsteady simulations, initialize the grid volumes
@@ -889,8 +949,10 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   /*--- Create the data structure for MPI point-to-point communications. ---*/
 
+  config->Tick(&tick);
   for (iMGlevel = 0; iMGlevel <= config->GetnMGLevels(); iMGlevel++)
     geometry[iMGlevel]->PreprocessP2PComms(geometry[iMGlevel], config);
+  config->Tock(tick, "CGeometry::PreprocessP2PComms", 1);
 
 
   /*--- Perform a few preprocessing routines and communications. ---*/
@@ -2244,8 +2306,8 @@ void CDriver::DynamicMesh_Preprocessing(CConfig *config, CGeometry **geometry, C
     surface_movement = new CSurfaceMovement();
     surface_movement->CopyBoundary(geometry[MESH_0], config);
     if (config->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE){
-      if (rank == MASTER_NODE) cout << endl <<  "Instance "<< iInst + 1 <<":" << endl;
-      iteration->SetGrid_Movement(geometry, surface_movement, grid_movement,  solver, config, 0, iInst);
+      if (rank == MASTER_NODE) cout << endl <<  "Instance "<< config->GetiInst() + 1 <<":" << endl;
+      iteration->SetGrid_Movement(geometry, surface_movement, grid_movement,  solver, config, 0, config->GetiInst());
     }
   }
 
@@ -2657,6 +2719,14 @@ void CDriver::Turbomachinery_Preprocessing(CConfig** config, CGeometry**** geome
 
 CDriver::~CDriver(void) {}
 
+SU2_Comm CDriver::SplitCommunicator(SU2_Comm comm, int color) {
+  int rank = 0;
+  SU2_MPI::Comm_rank(comm, &rank);
+  SU2_Comm newComm;
+  SU2_MPI::Comm_split(comm, color, rank, &newComm);
+  return newComm;
+}
+
 void CDriver::Print_DirectResidual(RECORDING kind_recording) {
 
   if (!(rank == MASTER_NODE && kind_recording == RECORDING::SOLUTION_VARIABLES)) return;
@@ -3007,7 +3077,7 @@ void CFluidDriver::Output(unsigned long InnerIter) {
     const auto inst = config_container[iZone]->GetiInst();
 
     for (iInst = 0; iInst < nInst[iZone]; ++iInst) {
-      config_container[iZone]->SetiInst(iInst);
+      config_container[iZone]->SetiInst(config_container[iZone]->GetFirst_TimeInstance() + iInst);
       output_container[iZone]->SetResult_Files(geometry_container[iZone][iInst][MESH_0],
                                                config_container[iZone],
                                                solver_container[iZone][iInst][MESH_0],
@@ -3258,12 +3328,37 @@ bool CTurbomachineryDriver::Monitor(unsigned long ExtIter) {
 
 CHBDriver::CHBDriver(char* confFile,
     unsigned short val_nZone,
-    SU2_Comm MPICommunicator) : CFluidDriver(confFile,
+    SU2_Comm MPICommunicator,
+    unsigned short val_nGroups,
+    unsigned short val_iGroup) : CFluidDriver(confFile,
         val_nZone,
-        MPICommunicator) {
+        (val_nGroups > 1)? SplitCommunicator(MPICommunicator, val_iGroup) : MPICommunicator),
+        worldComm(MPICommunicator),
+        nGroups(val_nGroups) {
   unsigned short kInst;
 
-  nInstHB = nInst[ZONE_0];
+  nInstHB = config_container[ZONE_0]->GetnTimeInstances();
+  firstInst = config_container[ZONE_0]->GetFirst_TimeInstance();
+
+  /*--- The ranks with the same rank within each group exchange the contributions to the source terms. ---*/
+
+  int worldRank = 0;
+  SU2_MPI::Comm_rank(MPICommunicator, &worldRank);
+  SU2_MPI::Comm_split(MPICommunicator, rank, worldRank, &instComm);
+
+  /*--- The groups must partition the mesh in the same way, the sizes are a cheap check of that. ---*/
+
+  if (nGroups > 1) {
+    unsigned long nPointLocal = 0;
+    for (iMesh = 0; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++)
+      nPointLocal += geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint();
+
+    unsigned long minPoint = 0, maxPoint = 0;
+    SU2_MPI::Allreduce(&nPointLocal, &minPoint, 1, MPI_UNSIGNED_LONG, MPI_MIN, instComm);
+    SU2_MPI::Allreduce(&nPointLocal, &maxPoint, 1, MPI_UNSIGNED_LONG, MPI_MAX, instComm);
+    if (minPoint != maxPoint)
+      SU2_MPI::Error("The partitions of the harmonic balance groups do not match.", CURRENT_FUNCTION);
+  }
 
   D = nullptr;
   /*--- allocate dynamic memory for the Harmonic Balance operator ---*/
@@ -3271,7 +3366,7 @@ CHBDriver::CHBDriver(char* confFile,
 
   output_legacy = COutputFactory::CreateLegacyOutput(config_container[ZONE_0]);
 
-  /*--- Open the convergence history file ---*/
+  /*--- Open the convergence history file (named with the global index of the instance). ---*/
   ConvHist_file = nullptr;
   ConvHist_file = new ofstream*[nZone];
   for (iZone = 0; iZone < nZone; iZone++) {
@@ -3279,7 +3374,7 @@ CHBDriver::CHBDriver(char* confFile,
     if (rank == MASTER_NODE){
       ConvHist_file[iZone] = new ofstream[nInst[iZone]];
       for (iInst = 0; iInst < nInst[iZone]; iInst++) {
-        output_legacy->SetConvHistory_Header(&ConvHist_file[iZone][iInst], config_container[iZone], iZone, iInst);
+        output_legacy->SetConvHistory_Header(&ConvHist_file[iZone][iInst], config_container[iZone], iZone, firstInst + iInst);
       }
     }
   }
@@ -3295,16 +3390,26 @@ CHBDriver::~CHBDriver(void) {
   for (kInst = 0; kInst < nInstHB; kInst++) delete [] D[kInst];
   delete [] D;
 
+  SU2_MPI::Comm_free(&instComm);
+
   if (rank == MASTER_NODE){
   /*--- Close the convergence history file. ---*/
   for (iZone = 0; iZone < nZone; iZone++) {
-    for (iInst = 0; iInst < nInstHB; iInst++) {
+    /*--- nInst is already deleted (Postprocessing), each group has nInstHB/nGroups instances. ---*/
+    for (iInst = 0; iInst < nInstHB/nGroups; iInst++) {
       ConvHist_file[iZone][iInst].close();
     }
     delete [] ConvHist_file[iZone];
   }
   delete [] ConvHist_file;
   }
+
+  /*--- With multiple groups the driver runs on the communicator of its group. ---*/
+  if (nGroups > 1) {
+    auto groupComm = SU2_MPI::GetComm();
+    SU2_MPI::SetComm(worldComm);
+    SU2_MPI::Comm_free(&groupComm);
+  }
 }
 
 
@@ -3313,12 +3418,12 @@ void CHBDriver::Run() {
   /*--- Run a single iteration of a Harmonic Balance problem. Preprocess all
    all zones before beginning the iteration. ---*/
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
+  for (iInst = 0; iInst < nInst[ZONE_0]; iInst++)
     iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
-  for (iInst = 0; iInst < nInstHB; iInst++)
+  for (iInst = 0; iInst < nInst[ZONE_0]; iInst++)
     iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
@@ -3335,11 +3440,8 @@ void CHBDriver::Run() {
 
 void CHBDriver::Update() {
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
-
-  }
+  /*--- Compute the harmonic balance terms across all instances ---*/
+  SetHarmonicBalance();
 
   /*--- Precondition the harmonic balance source terms ---*/
   if (config_container[ZONE_0]->GetHB_Precondition() == YES) {
@@ -3347,7 +3449,7 @@ void CHBDriver::Update() {
 
   }
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
+  for (iInst = 0; iInst < nInst[ZONE_0]; iInst++) {
 
     /*--- Update the harmonic balance terms across all zones ---*/
     iteration_container[ZONE_0][iInst]->Update(output_container[ZONE_0], integration_container, geometry_container,
@@ -3358,6 +3460,18 @@ void CHBDriver::Update() {
 
 }
 
+bool CHBDriver::Monitor(unsigned long ExtIter) {
+
+  /*--- The groups exchange source terms every iteration, they can only stop when all have converged. ---*/
+
+  int stop = CFluidDriver::Monitor(ExtIter), stopAll = stop;
+  if (nGroups > 1)
+    SU2_MPI::Allreduce(&stop, &stopAll, 1, MPI_INT, MPI_MIN, instComm);
+
+  StopCalc = (stopAll != 0);
+  return StopCalc;
+}
+
 void CHBDriver::ResetConvergence() {
 
   for(iInst = 0; iInst < nZone; iInst++) {
@@ -3383,9 +3497,28 @@ void CHBDriver::ResetConvergence() {
 
 }
 
-void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
+void CHBDriver::SumOverGroups(vector<su2double>& buffer) const {
 
-  unsigned short iVar, jInst, iMGlevel;
+  if (nGroups == 1) return;
+
+  /*--- The rows of the instances of each group are contiguous, and the ranks of instComm are ordered by group. ---*/
+  const auto blockSize = buffer.size() / nGroups;
+  vector<su2double> sum(blockSize);
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  /*--- The AD wrapper does not support reduce-scatter of active types. ---*/
+  vector<su2double> all(buffer.size());
+  SU2_MPI::Allreduce(buffer.data(), all.data(), buffer.size(), MPI_DOUBLE, MPI_SUM, instComm);
+  copy_n(all.begin() + size_t(firstInst / nInst[ZONE_0]) * blockSize, blockSize, sum.begin());
+#else
+  SU2_MPI::Reduce_scatter_block(buffer.data(), sum.data(), blockSize, MPI_DOUBLE, MPI_SUM, instComm);
+#endif
+  buffer.swap(sum);
+}
+
+void CHBDriver::SetHarmonicBalance() {
+
+  unsigned short iVar, iInst, jInst, iMGlevel;
   unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
   unsigned long iPoint;
   bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -3393,78 +3526,56 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
   if (adjoint) {
     implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT);
   }
+  const auto iSol = adjoint ? ADJFLOW_SOL : FLOW_SOL;
+  const auto nInstLocal = nInst[ZONE_0];
 
   unsigned long InnerIter = config_container[ZONE_0]->GetInnerIter();
 
-  /*--- Retrieve values from the config file ---*/
-  su2double *U = new su2double[nVar];
-  su2double *U_old = new su2double[nVar];
-  su2double *Psi = new su2double[nVar];
-  su2double *Psi_old = new su2double[nVar];
-  su2double *Source = new su2double[nVar];
-  su2double deltaU, deltaPsi;
-
-  /*--- Compute period of oscillation ---*/
-  su2double period = config_container[ZONE_0]->GetHarmonicBalance_Period();
-
-  /*--- Non-dimensionalize the input period, if necessary.  */
-  period /= config_container[ZONE_0]->GetTime_Ref();
-
   if (InnerIter == 0)
     ComputeHB_Operator();
 
+  /*--- Sources of all instances (rows), the contributions of the instances of this group (columns)
+   are accumulated and then summed over the groups, ordered by instance, point, and variable.
+   Each group receives only the rows of its instances. ---*/
+  vector<su2double> Source;
+
   /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
   /*--- Loop over all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
+    const auto nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
+    Source.assign(size_t(nInstHB) * nPoint * nVar, 0.0);
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source[iVar] = 0.0;
-      }
+    /*--- Step across the columns ---*/
+    for (unsigned short jLocal = 0; jLocal < nInstLocal; jLocal++) {
+      jInst = firstInst + jLocal;
+      const auto nodes = solver_container[ZONE_0][jLocal][iMGlevel][iSol]->GetNodes();
 
-      /*--- Step across the columns ---*/
-      for (jInst = 0; jInst < nInstHB; jInst++) {
-
-        /*--- Retrieve solution at this node in current zone ---*/
+      /*--- Loop over each node in the volume mesh ---*/
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
         for (iVar = 0; iVar < nVar; iVar++) {
 
-          if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += U[iVar]*D[iInst][jInst];
-
-            if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaU = U[iVar] - U_old[iVar];
-              Source[iVar] += deltaU*D[iInst][jInst];
-            }
-
-          }
-
-          else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-            Source[iVar] += Psi[iVar]*D[jInst][iInst];
+          /*--- Retrieve solution at this node in the current instance, for implicit
+           problems the change since the last iteration is added. ---*/
+          su2double U = nodes->GetSolution(iPoint, iVar);
+          if (implicit) U += U - nodes->GetSolution_Old(iPoint, iVar);
 
-            if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->GetSolution_Old(iPoint, iVar);
-              deltaPsi = Psi[iVar] - Psi_old[iVar];
-              Source[iVar] += deltaPsi*D[jInst][iInst];
-            }
+          for (iInst = 0; iInst < nInstHB; iInst++) {
+            const su2double Dij = adjoint ? D[jInst][iInst] : D[iInst][jInst];
+            Source[(iInst*nPoint + iPoint)*nVar + iVar] += U*Dij;
           }
         }
+      }
+    }
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iVar]);
-          }
-        }
+    SumOverGroups(Source);
 
-      }
+    /*--- Store sources for the rows of this group ---*/
+    for (unsigned short iLocal = 0; iLocal < nInstLocal; iLocal++) {
+      auto nodes = solver_container[ZONE_0][iLocal][iMGlevel][iSol]->GetNodes();
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        for (iVar = 0; iVar < nVar; iVar++)
+          nodes->SetHarmonicBalance_Source(iPoint, iVar, Source[(iLocal*nPoint + iPoint)*nVar + iVar]);
     }
   }
 
@@ -3473,36 +3584,35 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
 
     /*--- Extra variables needed if we have a turbulence model. ---*/
     unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
-    su2double *U_Turb = new su2double[nVar_Turb];
-    su2double *Source_Turb = new su2double[nVar_Turb];
 
     /*--- Loop over only the finest mesh level (turbulence is always solved
      on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+    const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+    Source.assign(size_t(nInstHB) * nPoint * nVar_Turb, 0.0);
+
+    for (unsigned short jLocal = 0; jLocal < nInstLocal; jLocal++) {
+      jInst = firstInst + jLocal;
+      const auto nodes = solver_container[ZONE_0][jLocal][MESH_0][TURB_SOL]->GetNodes();
 
-        /*--- Retrieve solution at this node in current zone ---*/
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
         for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(iPoint, iVar);
-          Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
+          const su2double U_Turb = nodes->GetSolution(iPoint, iVar);
+          for (iInst = 0; iInst < nInstHB; iInst++)
+            Source[(iInst*nPoint + iPoint)*nVar_Turb + iVar] += U_Turb*D[iInst][jInst];
         }
       }
-
-      /*--- Store sources for current iZone ---*/
-      for (iVar = 0; iVar < nVar_Turb; iVar++)
-        solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source_Turb[iVar]);
     }
 
-    delete [] U_Turb;
-    delete [] Source_Turb;
-  }
+    SumOverGroups(Source);
 
-  delete [] Source;
-  delete [] U;
-  delete [] U_old;
-  delete [] Psi;
-  delete [] Psi_old;
+    /*--- Store sources for the rows of this group ---*/
+    for (unsigned short iLocal = 0; iLocal < nInstLocal; iLocal++) {
+      auto nodes = solver_container[ZONE_0][iLocal][MESH_0][TURB_SOL]->GetNodes();
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        for (iVar = 0; iVar < nVar_Turb; iVar++)
+          nodes->SetHarmonicBalance_Source(iPoint, iVar, Source[(iLocal*nPoint + iPoint)*nVar_Turb + iVar]);
+    }
+  }
 
 }
 
@@ -3512,10 +3622,10 @@ void CHBDriver::StabilizeHarmonicBalance() {
   unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
   unsigned long iPoint;
   bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
+  const auto nInstLocal = nInst[ZONE_0];
 
-  /*--- Retrieve values from the config file ---*/
-  su2double *Source     = new su2double[nInstHB];
-  su2double *Source_old = new su2double[nInstHB];
+  /*--- Preconditioned sources of all instances, summed over the groups (see SetHarmonicBalance). ---*/
+  vector<su2double> Source, DeltaTime;
   su2double Delta;
 
   su2double **Pinv     = new su2double*[nInstHB];
@@ -3528,11 +3638,23 @@ void CHBDriver::StabilizeHarmonicBalance() {
   /*--- Loop over all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
 
+    const auto nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
+    Source.assign(size_t(nInstHB) * nPoint * nVar, 0.0);
+
+    /*--- The time step is that of the first instance, which belongs to the first group. ---*/
+    DeltaTime.assign(nPoint, 0.0);
+    if (firstInst == 0) {
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        DeltaTime[iPoint] = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+    }
+    if (nGroups > 1)
+      SU2_MPI::Bcast(DeltaTime.data(), nPoint, MPI_DOUBLE, 0, instComm);
+
     /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint(); iPoint++) {
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
       /*--- Get time step for current node ---*/
-      Delta = solver_container[ZONE_0][INST_0][iMGlevel][FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
+      Delta = DeltaTime[iPoint];
 
       /*--- Setup stabilization matrix for this node ---*/
       for (iInst = 0; iInst < nInstHB; iInst++) {
@@ -3626,32 +3748,27 @@ void CHBDriver::StabilizeHarmonicBalance() {
       }
       delete[] temp;
 
-      /*--- Loop through variables to precondition ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-
-        /*--- Get current source terms (not yet preconditioned) and zero source array to prepare preconditioning ---*/
-        for (iInst = 0; iInst < nInstHB; iInst++) {
-          Source_old[iInst] = solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->GetHarmonicBalance_Source(iPoint, iVar);
-          Source[iInst] = 0;
-        }
-
-        /*--- Step through columns ---*/
-        for (iInst = 0; iInst < nInstHB; iInst++) {
-          for (jInst = 0; jInst < nInstHB; jInst++) {
-            Source[iInst] += P[iInst][jInst]*Source_old[jInst];
-          }
-
-          /*--- Store updated source terms for current node ---*/
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->GetNodes()->SetHarmonicBalance_Source(iPoint, iVar, Source[iInst]);
+      /*--- Step through the columns of this group, the current source terms are not yet preconditioned ---*/
+      for (unsigned short jLocal = 0; jLocal < nInstLocal; jLocal++) {
+        jInst = firstInst + jLocal;
+        for (iVar = 0; iVar < nVar; iVar++) {
+          const su2double Source_old = solver_container[ZONE_0][jLocal][iMGlevel][FLOW_SOL]->GetNodes()->GetHarmonicBalance_Source(iPoint, iVar);
+          for (iInst = 0; iInst < nInstHB; iInst++) {
+            Source[(iInst*nPoint + iPoint)*nVar + iVar] += P[iInst][jInst]*Source_old;
           }
         }
-
       }
     }
+
+    SumOverGroups(Source);
+
+    /*--- Store updated source terms for the instances of this group ---*/
+    for (unsigned short iLocal = 0; iLocal < nInstLocal; iLocal++) {
+      auto nodes = solver_container[ZONE_0][iLocal][iMGlevel][adjoint ? ADJFLOW_SOL : FLOW_SOL]->GetNodes();
+      for (iPoint = 0; iPoint < nPoint; iPoint++)
+        for (iVar = 0; iVar < nVar; iVar++)
+          nodes->SetHarmonicBalance_Source(iPoint, iVar, Source[(iLocal*nPoint + iPoint)*nVar + iVar]);
+    }
   }
 
   /*--- Deallocate dynamic memory ---*/
@@ -3661,8 +3778,6 @@ void CHBDriver::StabilizeHarmonicBalance() {
   }
   delete [] P;
   delete [] Pinv;
-  delete [] Source;
-  delete [] Source_old;
 
 }
 
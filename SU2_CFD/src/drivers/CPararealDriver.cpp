@@ -0,0 +1,310 @@
+/*!
+ * \file CPararealDriver.cpp
+ * \brief The main subroutines for parallel-in-time (Parareal) dual time stepping.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CPararealDriver.hpp"
+#include "../../include/definition_structure.hpp"
+#include "../../include/output/COutput.hpp"
+#include "../../include/iteration/CIteration.hpp"
+
+namespace {
+/*--- Solvers whose solution is integrated in time, i.e. that make up the state of a time slice. ---*/
+constexpr int StateSolvers[] = {FLOW_SOL, TURB_SOL, TRANS_SOL, HEAT_SOL};
+}
+
+CPararealDriver::CPararealDriver(char* confFile,
+                                 unsigned short val_nZone,
+                                 SU2_Comm MPICommunicator,
+                                 unsigned short val_iGroup) : CSinglezoneDriver(confFile,
+                                                                                val_nZone,
+                                                                                SplitCommunicator(MPICommunicator, val_iGroup)),
+                                                              worldComm(MPICommunicator),
+                                                              iGroup(val_iGroup) {
+
+  const auto config = config_container[ZONE_0];
+
+  if (fem_solver)
+    SU2_MPI::Error("Parallel-in-time integration is only available for the finite volume solvers.", CURRENT_FUNCTION);
+
+  nGroups = config->GetnTime_Parallel_Groups();
+  coarseFactor = config->GetParareal_Coarse_Factor();
+  firstTimeIter = config->GetRestart() ? config->GetRestart_Iter() : 0;
+  nSliceIter = (config->GetnTime_Iter() - firstTimeIter) / nGroups;
+  fineTimeStep = config->GetDelta_UnstTimeND();
+
+  /*--- The ranks with the same rank within each group exchange the states of the slices. ---*/
+
+  int worldRank = 0;
+  SU2_MPI::Comm_rank(worldComm, &worldRank);
+  SU2_MPI::Comm_split(worldComm, rank, worldRank, &timeComm);
+
+  /*--- The groups must partition the mesh in the same way, the sizes are a cheap check of that. ---*/
+
+  unsigned long stateSize = GetStateSize(), prevStateSize = stateSize;
+  if (iGroup+1 < nGroups)
+    SU2_MPI::Send(&stateSize, 1, MPI_UNSIGNED_LONG, iGroup+1, 0, timeComm);
+  if (iGroup > 0)
+    SU2_MPI::Recv(&prevStateSize, 1, MPI_UNSIGNED_LONG, iGroup-1, 0, timeComm, MPI_STATUS_IGNORE);
+
+  if (prevStateSize != stateSize)
+    SU2_MPI::Error("The partitions of the time parallel groups do not match.", CURRENT_FUNCTION);
+}
+
+unsigned long CPararealDriver::GetStateSize() const {
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  unsigned long size = 0;
+  for (auto iSol : StateSolvers) {
+    const auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+    if (solver) size += 2 * nPoint * solver->GetnVar();
+  }
+  return size;
+}
+
+void CPararealDriver::GetState(StateType& state, su2double ratio) const {
+
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  state.resize(GetStateSize());
+  unsigned long k = 0;
+
+  for (auto iSol : StateSolvers) {
+    const auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+    if (!solver) continue;
+    const auto nodes = solver->GetNodes();
+
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      for (auto iVar = 0u; iVar < solver->GetnVar(); iVar++) {
+        const su2double un = nodes->GetSolution_time_n(iPoint, iVar);
+        const su2double un1 = nodes->GetSolution_time_n1(iPoint, iVar);
+        state[k++] = SU2_TYPE::GetValue(un);
+        state[k++] = SU2_TYPE::GetValue(ratio == 1.0 ? un1 : un - (un - un1) * ratio);
+      }
+    }
+  }
+}
+
+void CPararealDriver::SetState(const StateType& state, su2double ratio) {
+
+  const auto nMGLevels = config_container[ZONE_0]->GetnMGLevels();
+  const auto geometry = geometry_container[ZONE_0][INST_0];
+  unsigned long k = 0;
+
+  for (auto iSol : StateSolvers) {
+    const auto solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+    if (!solver) continue;
+    auto nodes = solver->GetNodes();
+
+    for (auto iPoint = 0ul; iPoint < geometry[MESH_0]->GetnPoint(); iPoint++) {
+      for (auto iVar = 0u; iVar < solver->GetnVar(); iVar++) {
+        const su2double un = state[k++];
+        const su2double un1 = state[k++];
+        nodes->SetSolution(iPoint, iVar, un);
+        nodes->Set_Solution_time_n(iPoint, iVar, un);
+        nodes->Set_Solution_time_n1(iPoint, iVar, ratio == 1.0 ? un1 : un - (un - un1) * ratio);
+      }
+    }
+
+    /*--- The coarse multigrid levels of the flow solver have their own time levels (for the dual
+     * time source), the solution is restricted at each cycle but these are not. ---*/
+
+    if (iSol != FLOW_SOL) continue;
+
+    for (auto iMesh = 1u; iMesh <= nMGLevels; iMesh++) {
+      const auto solverCoarse = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      const auto fine = solver_container[ZONE_0][INST_0][iMesh-1][iSol]->GetNodes();
+      auto coarse = solverCoarse->GetNodes();
+
+      for (auto iPoint = 0ul; iPoint < geometry[iMesh]->GetnPointDomain(); iPoint++) {
+        const su2double Area_Parent = geometry[iMesh]->nodes->GetVolume(iPoint);
+
+        for (auto iVar = 0u; iVar < solverCoarse->GetnVar(); iVar++) {
+          su2double sol = 0.0, sol_n = 0.0, sol_n1 = 0.0;
+
+          for (auto iChildren = 0u; iChildren < geometry[iMesh]->nodes->GetnChildren_CV(iPoint); iChildren++) {
+            const auto Point_Fine = geometry[iMesh]->nodes->GetChildren_CV(iPoint, iChildren);
+            const su2double weight = geometry[iMesh-1]->nodes->GetVolume(Point_Fine) / Area_Parent;
+            sol += weight * fine->GetSolution(Point_Fine, iVar);
+            sol_n += weight * fine->GetSolution_time_n(Point_Fine, iVar);
+            sol_n1 += weight * fine->GetSolution_time_n1(Point_Fine, iVar);
+          }
+          coarse->SetSolution(iPoint, iVar, sol);
+          coarse->Set_Solution_time_n(iPoint, iVar, sol_n);
+          coarse->Set_Solution_time_n1(iPoint, iVar, sol_n1);
+        }
+      }
+    }
+  }
+}
+
+void CPararealDriver::Propagate(StateType& state, bool coarse, bool writeOutput) {
+
+  auto config = config_container[ZONE_0];
+
+  const unsigned short factor = coarse ? coarseFactor : 1;
+  const auto sliceBegin = firstTimeIter + iGroup * nSliceIter;
+
+  /*--- Suppress the screen and history output (time iteration frequency), the number of time
+   * iterations is also changed since the output of the last time iteration is always written. ---*/
+
+  const auto nTimeIter = config->GetnTime_Iter();
+  const auto screenFreq = config->GetScreen_Wrt_Freq(0);
+  const auto historyFreq = config->GetHistory_Wrt_Freq(0);
+  if (!writeOutput) {
+    config->SetScreen_Wrt_Freq(0, 0);
+    config->SetHistory_Wrt_Freq(0, 0);
+    config->SetnTime_Iter(numeric_limits<unsigned long>::max());
+  }
+
+  config->SetDelta_UnstTimeND(factor * fineTimeStep);
+
+  /*--- Time iterations are numbered with the fine step, thus the physical time is also based on it. ---*/
+
+  for (auto iStep = 0ul; iStep < nSliceIter / factor; iStep++) {
+
+    TimeIter = sliceBegin + iStep * factor;
+
+    Preprocess(TimeIter);
+
+    config->SetPhysicalTime(static_cast<su2double>(TimeIter) * fineTimeStep);
+
+    /*--- Set the state after the preprocessing to override the initial condition. ---*/
+
+    if (iStep == 0) SetState(state, factor);
+
+    Run();
+
+    Postprocess();
+
+    Update();
+
+    if (writeOutput) {
+      Monitor(TimeIter);
+      Output(TimeIter);
+      if (StopCalc) break;
+    }
+  }
+
+  GetState(state, su2double(1) / factor);
+
+  /*--- Restore the output settings and time step. ---*/
+
+  config->SetScreen_Wrt_Freq(0, screenFreq);
+  config->SetHistory_Wrt_Freq(0, historyFreq);
+  config->SetnTime_Iter(nTimeIter);
+  config->SetDelta_UnstTimeND(fineTimeStep);
+}
+
+void CPararealDriver::StartSolver() {
+
+  StartTime = SU2_MPI::Wtime();
+
+  config_container[ZONE_0]->Set_StartTime(StartTime);
+
+  const auto nIter = min<unsigned short>(config_container[ZONE_0]->GetnParareal_Iter(), nGroups-1);
+  const passivedouble tol = SU2_TYPE::GetValue(config_container[ZONE_0]->GetParareal_Tol());
+
+  if (rank == MASTER_NODE) {
+    cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
+    cout << endl <<"Simulation Run using the Parareal Driver" << endl;
+    cout << "Time slice " << iGroup << " of " << nGroups << ", time iterations " << firstTimeIter + iGroup*nSliceIter
+         << " to " << firstTimeIter + (iGroup+1)*nSliceIter - 1 << "." << endl;
+  }
+
+  /*--- Initial state of the first slice, i.e. the initial condition. ---*/
+
+  StateType initialState;
+  if (iGroup == 0) {
+    Preprocess(firstTimeIter);
+    GetState(initialState, 1);
+  }
+
+  const auto size = static_cast<int>(GetStateSize());
+  StateType startState(size), prevStartState, fineEnd, coarseEnd, endState(size);
+
+  auto ReceiveStart = [&]() {
+    if (iGroup == 0) startState = initialState;
+    else SU2_MPI::Recv(startState.data(), size, MPI_DOUBLE, iGroup-1, 0, timeComm, MPI_STATUS_IGNORE);
+  };
+  auto SendEnd = [&]() {
+    if (iGroup+1 < nGroups) SU2_MPI::Send(endState.data(), size, MPI_DOUBLE, iGroup+1, 0, timeComm);
+  };
+
+  /*--- Initial guess of the start states with the coarse propagator, sequential over slices. ---*/
+
+  ReceiveStart();
+  coarseEnd = startState;
+  Propagate(coarseEnd, true, false);
+  endState = coarseEnd;
+  SendEnd();
+
+  /*--- Parareal iterations. After iteration k the first k+1 slices have the fine start state,
+   * they are skipped as their propagation would not change. ---*/
+
+  for (unsigned short iIter = 1; iIter <= nIter; iIter++) {
+
+    /*--- Fine propagation of all slices in parallel. ---*/
+
+    if (iIter <= iGroup+1) {
+      fineEnd = startState;
+      Propagate(fineEnd, false, false);
+    }
+
+    /*--- Sequential coarse correction. ---*/
+
+    prevStartState = startState;
+    ReceiveStart();
+
+    StateType correctedEnd = coarseEnd;
+    if (iIter <= iGroup) {
+      correctedEnd = startState;
+      Propagate(correctedEnd, true, false);
+    }
+    for (int i = 0; i < size; ++i) endState[i] = fineEnd[i] + (correctedEnd[i] - coarseEnd[i]);
+    coarseEnd = correctedEnd;
+    SendEnd();
+
+    /*--- Relative change of the start states over all slices. ---*/
+
+    passivedouble local[2] = {0.0, 0.0}, global[2] = {0.0, 0.0};
+    for (int i = 0; i < size; ++i) {
+      local[0] += pow(startState[i] - prevStartState[i], 2);
+      local[1] += pow(startState[i], 2);
+    }
+    SU2_MPI::Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, worldComm);
+    const passivedouble change = (global[1] > 0.0) ? sqrt(global[0] / global[1]) : 0.0;
+
+    if (rank == MASTER_NODE)
+      cout << "Parareal iteration " << iIter << ", relative change of the slice start states: " << change << endl;
+
+    if (change < tol) break;
+  }
+
+  /*--- Final fine propagation with output. ---*/
+
+  if (rank == MASTER_NODE)
+    cout << endl << "Parareal iterations finished, writing the solution of the time slice." << endl;
+
+  Propagate(startState, false, true);
+
+}
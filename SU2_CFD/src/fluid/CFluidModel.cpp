@@ -86,3 +86,39 @@ void CFluidModel::SetThermalConductivityModel(const CConfig* config) {
       break;
   }
 }
+
+void CFluidModel::GetTDState(StateBatch& batch, size_t i) const {
+  batch.Density[i] = Density;
+  batch.StaticEnergy[i] = StaticEnergy;
+  batch.Pressure[i] = Pressure;
+  batch.Temperature[i] = Temperature;
+  batch.SoundSpeed2[i] = SoundSpeed2;
+  batch.Cp[i] = Cp;
+  batch.dPdrho_e[i] = dPdrho_e;
+  batch.dPde_rho[i] = dPde_rho;
+  batch.dTdrho_e[i] = dTdrho_e;
+  batch.dTde_rho[i] = dTde_rho;
+}
+
+void CFluidModel::ComputeStates_rhoe(StateBatch& batch) {
+  for (size_t i = 0; i < batch.size; ++i) {
+    SetTDState_rhoe(batch.Density[i], batch.StaticEnergy[i]);
+    GetTDState(batch, i);
+  }
+}
+
+void CFluidModel::ComputeStates_PT(StateBatch& batch) {
+  for (size_t i = 0; i < batch.size; ++i) {
+    SetTDState_PT(batch.Pressure[i], batch.Temperature[i]);
+    GetTDState(batch, i);
+  }
+}
+
+void CFluidModel::ComputeTransport(StateBatch& batch) const {
+  LaminarViscosity->ComputeViscosity(BATCH_SIZE, batch.Temperature, batch.Density, batch.LaminarViscosity,
+                                     batch.dmudrho_T, batch.dmudT_rho);
+
+  ThermalConductivity->ComputeConductivity(BATCH_SIZE, batch.Temperature, batch.Density, batch.LaminarViscosity,
+                                           Mu_Turb, batch.Cp, batch.dmudrho_T, batch.dmudT_rho, batch.Conductivity,
+                                           batch.dktdrho_T, batch.dktdT_rho);
+}
@@ -84,6 +84,49 @@ void CIdealGas::SetTDState_rhoT(su2double rho, su2double T) {
   SetTDState_rhoe(rho, e);
 }
 
+void CIdealGas::ComputeStates_rhoe(StateBatch& batch) {
+  using Double = simd::Array<su2double>;
+  static_assert(BATCH_SIZE % Double::Size == 0, "Batch size must be a multiple of the SIMD length.");
+
+  for (size_t i = 0; i < BATCH_SIZE; i += Double::Size) {
+    const Double rho(batch.Density + i);
+    const Double e(batch.StaticEnergy + i);
+
+    const Double P = Gamma_Minus_One * rho * e;
+    const Double T = Gamma_Minus_One * e / Gas_Constant;
+    const Double c2 = Gamma * P / rho;
+    const Double dPdrho = Gamma_Minus_One * e;
+    const Double dPde = Gamma_Minus_One * rho;
+
+    P.store(batch.Pressure + i);
+    T.store(batch.Temperature + i);
+    c2.store(batch.SoundSpeed2 + i);
+    dPdrho.store(batch.dPdrho_e + i);
+    dPde.store(batch.dPde_rho + i);
+    Double(Cp).store(batch.Cp + i);
+    Double(0.0).store(batch.dTdrho_e + i);
+    Double(Gamma_Minus_One / Gas_Constant).store(batch.dTde_rho + i);
+  }
+}
+
+void CIdealGas::ComputeStates_PT(StateBatch& batch) {
+  using Double = simd::Array<su2double>;
+
+  for (size_t i = 0; i < BATCH_SIZE; i += Double::Size) {
+    const Double P(batch.Pressure + i);
+    const Double T(batch.Temperature + i);
+
+    const Double e = T * Gas_Constant / Gamma_Minus_One;
+    const Double rho = P / (T * Gas_Constant);
+
+    e.store(batch.StaticEnergy + i);
+    rho.store(batch.Density + i);
+  }
+
+  /*--- Pressure and temperature are recomputed, as in SetTDState_PT. ---*/
+  CIdealGas::ComputeStates_rhoe(batch);
+}
+
 void CIdealGas::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
   su2double dPdT_rho, dPdrho_T, dPds_rho;
 
@@ -56,6 +56,50 @@ CNEMOGas::CNEMOGas(const CConfig* config, unsigned short val_nDim): CFluidModel(
   ionization           = config->GetIonization();
 }
 
+void CNEMOGas::ComputeBatchTemperatures(ThermoChemBatch& batch) {
+
+  vector<su2double> val_rhos(nSpecies);
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      val_rhos[iSpecies] = batch.rhos[iSpecies*BATCH_SIZE + k];
+
+    const auto& temps = ComputeTemperatures(val_rhos, batch.rhoE[k], batch.rhoEve[k], batch.rhoEvel[k]);
+    batch.T[k] = temps[0];
+    batch.Tve[k] = temps[1];
+  }
+}
+
+void CNEMOGas::ComputeBatchNetProductionRates(ThermoChemBatch& batch) {
+
+  vector<su2double> val_rhos(nSpecies);
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      val_rhos[iSpecies] = batch.rhos[iSpecies*BATCH_SIZE + k];
+
+    SetTDStateRhosTTv(val_rhos, batch.T[k], batch.Tve[k]);
+    const auto& rates = ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      batch.ws[iSpecies*BATCH_SIZE + k] = rates[iSpecies];
+  }
+}
+
+void CNEMOGas::ComputeBatchEveSourceTerm(ThermoChemBatch& batch) {
+
+  vector<su2double> val_rhos(nSpecies);
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+      val_rhos[iSpecies] = batch.rhos[iSpecies*BATCH_SIZE + k];
+      ws[iSpecies] = batch.ws[iSpecies*BATCH_SIZE + k];
+    }
+    SetTDStateRhosTTv(val_rhos, batch.T[k], batch.Tve[k]);
+    batch.EveSource[k] = ComputeEveSourceTerm();
+  }
+}
+
 void CNEMOGas::SetTDStatePTTv(su2double val_pressure, const su2double *val_massfrac,
                               su2double val_temperature, su2double val_temperature_ve){
 
@@ -27,6 +27,7 @@
 
 #include "../../include/fluid/CSU2TCLib.hpp"
 #include "../../../Common/include/option_structure.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
 
 CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscous): CNEMOGas(config, val_nDim){
 
@@ -614,6 +615,26 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- Store the equilibrium constants of each reaction, instead of setting them for every evaluation. ---*/
+  RxnConstantTables.resize(nReactions,6,5,0.0);
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    for (unsigned short i = 0; i < 6; i++)
+      for (unsigned short j = 0; j < 5; j++)
+        RxnConstantTables(iReaction,i,j) = RxnConstantTable(i,j);
+  }
+
+  /*--- Coefficients of the Millikan & White relaxation time of each species pair. ---*/
+  MillikanWhiteA.resize(nSpecies,nSpecies) = su2double(0.0);
+  MillikanWhiteB.resize(nSpecies,nSpecies) = su2double(0.0);
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+      const su2double mu = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
+      MillikanWhiteA(iSpecies,jSpecies) = 1.16 * 1E-3 * sqrt(mu) * pow(CharVibTemp[iSpecies], 4.0/3.0);
+      MillikanWhiteB(iSpecies,jSpecies) = 0.015 * pow(mu, 0.25);
+    }
+  }
 }
 
 CSU2TCLib::~CSU2TCLib(){}
@@ -1011,11 +1032,6 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
 }
 void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
 
-  unsigned short ii;
-
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
-
   /*--- Calculate mixture number density ---*/
   su2double N = 0.0;
   for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
@@ -1025,6 +1041,13 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
   /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
   N = N*(1E-6);
 
+  InterpolateKeqConstants(val_Reaction, N, A.data());
+}
+
+void CSU2TCLib::InterpolateKeqConstants(unsigned short iReaction, su2double N, su2double* coeffs) const {
+
+  unsigned short ii;
+
   /*--- Determine table index based on mixture N ---*/
   unsigned short tbl_offset = 14;
   unsigned short pwr        = floor(log10(N));
@@ -1033,11 +1056,11 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
   unsigned short iIndex = int(pwr) - tbl_offset;
   if (iIndex <= 0) {
     for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(0,ii);
+      coeffs[ii] = RxnConstantTables(iReaction,0,ii);
     return;
   } else if (iIndex >= 5) {
     for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(5,ii);
+      coeffs[ii] = RxnConstantTables(iReaction,5,ii);
     return;
   }
 
@@ -1052,9 +1075,9 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
 
   /*--- Interpolate ---*/
   for (ii = 0; ii < 5; ii++) {
-    A[ii] =  (RxnConstantTable(iIndex+1,ii) - RxnConstantTable(iIndex,ii))
+    coeffs[ii] =  (RxnConstantTables(iReaction,iIndex+1,ii) - RxnConstantTables(iReaction,iIndex,ii))
         / (tmp2 - tmp1) * (N - tmp1)
-        + RxnConstantTable(iIndex,ii);
+        + RxnConstantTables(iReaction,iIndex,ii);
   }
 }
 
@@ -1068,12 +1091,10 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
   // Note: Millikan & White relaxation time (requires P in Atm.)
   // Note: Park limiting cross section
 
-  su2double A_sr, B_sr, num, denom, Cs, sig_s, tau_sr, tauP, tauMW;
+  su2double num, denom, Cs, sig_s, tau_sr, tauP, tauMW;
   vector<su2double> MolarFrac;
-  su2activematrix mu;
 
   MolarFrac.resize(nSpecies,0.0);
-  mu.resize(nSpecies,nSpecies)=su2double(0.0);
 
   su2double omegaVT = 0.0;
   su2double omegaCV = 0.0;
@@ -1092,6 +1113,8 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
   eve_eq = ComputeSpeciesEve(T, true);
   eve    = ComputeSpeciesEve(Tve, true);
 
+  const su2double T_13 = pow(T,-1.0/3.0);
+
   /*--- Loop over species to calculate source term --*/
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
 
@@ -1099,10 +1122,7 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
     num   = 0.0;
     denom = 0.0;
     for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
-      mu(iSpecies,jSpecies) = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
-      A_sr   = 1.16 * 1E-3 * sqrt(mu(iSpecies,jSpecies)) * pow(CharVibTemp[iSpecies], 4.0/3.0);
-      B_sr   = 0.015 * pow(mu(iSpecies,jSpecies), 0.25);
-      tau_sr = 101325.0/Pressure * exp(A_sr*(pow(T,-1.0/3.0) - B_sr) - 18.42); 
+      tau_sr = 101325.0/Pressure * exp(MillikanWhiteA(iSpecies,jSpecies)*(T_13 - MillikanWhiteB(iSpecies,jSpecies)) - 18.42);
 
       num   += MolarFrac[jSpecies];
       denom += MolarFrac[jSpecies] / tau_sr;
@@ -1773,3 +1793,243 @@ void CSU2TCLib::GetChemistryEquilConstants(unsigned short iReaction){
     }
   }
 }
+
+namespace {
+using Double = simd::Array<su2double>;
+static_assert(CFluidModel::BATCH_SIZE % Double::Size == 0, "The batch must be a multiple of the SIMD size.");
+
+/*--- Branch-free "mask ? a : b", where the mask is 1 or 0 and the unselected value is finite. ---*/
+FORCEINLINE Double Select(const Double& mask, const Double& a, const Double& b) { return mask*a + (1.0-mask)*b; }
+
+/*--- Fill the unused entries of a partial batch with the last valid point, to keep the padding well defined. ---*/
+void PadBatch(unsigned short nSpecies, CNEMOGas::ThermoChemBatch& batch) {
+  const auto last = batch.size-1;
+  const auto end = ((batch.size + Double::Size - 1) / Double::Size) * Double::Size;
+  for (auto k = batch.size; k < end; ++k) {
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+      batch.rhos[iSpecies*CFluidModel::BATCH_SIZE + k] = batch.rhos[iSpecies*CFluidModel::BATCH_SIZE + last];
+      batch.ws[iSpecies*CFluidModel::BATCH_SIZE + k] = batch.ws[iSpecies*CFluidModel::BATCH_SIZE + last];
+    }
+    batch.T[k] = batch.T[last];
+    batch.Tve[k] = batch.Tve[last];
+    batch.rhoE[k] = batch.rhoE[last];
+    batch.rhoEve[k] = batch.rhoEve[last];
+    batch.rhoEvel[k] = batch.rhoEvel[last];
+  }
+}
+}
+
+template<class Double>
+void CSU2TCLib::ComputeSpeciesEveBatch(const Double& val_T, bool vibe_only, Double* val_eves) const {
+
+  /*--- Same as ComputeSpeciesEve, for multiple temperatures. ---*/
+  const unsigned short iElectron = nSpecies-1;
+
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    Double Ev = 0.0, Eel = 0.0;
+
+    if (ionization && (iSpecies == iElectron)) {
+      const su2double Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies] * Ref_Temperature[iSpecies];
+      Eel = (3.0/2.0) * Ru/MolarMass[iSpecies] * (val_T - Ref_Temperature[iSpecies]) + Ef;
+    }
+    else {
+      if (CharVibTemp[iSpecies] != 0.0)
+        Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/val_T)-1.0);
+
+      Double num = 0.0;
+      Double denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
+      for (unsigned short iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
+        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+        denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+      }
+      Eel = Ru/MolarMass[iSpecies] * (num/denom);
+    }
+    val_eves[iSpecies] = vibe_only? Ev : Double(Ev + Eel);
+  }
+}
+
+void CSU2TCLib::ComputeBatchTemperatures(ThermoChemBatch& batch) {
+
+  if (batch.size == 0) return;
+  PadBatch(nSpecies, batch);
+  GetSpeciesCvTraRot();
+
+  /*--- Same algorithm as ComputeTemperatures, each point of a pack stops updating Tve once it converges. ---*/
+  const su2double Tmin = 50.0, Tmax = 8E4;
+  const su2double Btol = 1.0E-6;
+  const unsigned short maxBIter = 50;
+
+  vector<Double> rho(nSpecies), eves(nSpecies);
+
+  for (size_t k0 = 0; k0 < batch.size; k0 += Double::Size) {
+
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      rho[iSpecies] = Double(&batch.rhos[iSpecies*BATCH_SIZE + k0]);
+
+    /*--- Translational temperature. ---*/
+    Double rhoE_f = 0.0, rhoE_ref = 0.0, rhoCvtr = 0.0;
+    for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
+      rhoCvtr  += rho[iSpecies] * Cvtrs[iSpecies];
+      rhoE_ref += rho[iSpecies] * Cvtrs[iSpecies] * Ref_Temperature[iSpecies];
+      rhoE_f   += rho[iSpecies] * (Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies]*Ref_Temperature[iSpecies]);
+    }
+    const Double rhoEve(&batch.rhoEve[k0]);
+    Double T = (Double(&batch.rhoE[k0]) - rhoEve - rhoE_f + rhoE_ref - Double(&batch.rhoEvel[k0])) / rhoCvtr;
+    T = Select(T < Tmin, Tmin, T);
+    T = Select(T > Tmax, Tmax, T);
+
+    /*--- Vibrational temperature, bisection method. ---*/
+    Double Tve_o = Tmin, Tve2 = Tmax, Tve = T, rhoEve_t = 0.0, converged = 0.0;
+
+    for (unsigned short iIter = 0; iIter < maxBIter; iIter++) {
+      Tve = Select(converged, Tve, (Tve_o+Tve2)/2.0);
+      ComputeSpeciesEveBatch(Tve, false, eves.data());
+      rhoEve_t = 0.0;
+      for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) rhoEve_t += rho[iSpecies] * eves[iSpecies];
+
+      converged = abs(rhoEve_t - rhoEve) < Btol;
+      if (converged.sum() == Double::Size) break;
+
+      const Double above = rhoEve_t > rhoEve;
+      Tve2  = Select(converged, Tve2, Select(above, Tve, Tve2));
+      Tve_o = Select(converged, Tve_o, Select(above, Tve_o, Tve));
+    }
+
+    /*--- If absolutely no convergence, then assign to the TR temperature. ---*/
+    for (size_t k = 0; k < Double::Size && k0+k < batch.size; ++k) {
+      if (converged[k] == 0.0)
+        cout <<"Warning: temperatures did not converge, error= "<< fabs(rhoEve_t[k]-rhoEve[k])<<endl;
+    }
+    Tve = Select(converged, Tve, T);
+
+    T.store(&batch.T[k0]);
+    Tve.store(&batch.Tve[k0]);
+  }
+}
+
+void CSU2TCLib::ComputeBatchNetProductionRates(ThermoChemBatch& batch) {
+
+  if (batch.size == 0) return;
+  PadBatch(nSpecies, batch);
+
+  /*--- Same as ComputeNetProductionRates (without Jacobian), see there for details. ---*/
+  const su2double T_min = 800.0;
+  const su2double epsilon = 80;
+
+  vector<Double> rho(nSpecies), w(nSpecies);
+  su2double coeffs[5];
+
+  for (size_t k0 = 0; k0 < batch.size; k0 += Double::Size) {
+
+    const Double T(&batch.T[k0]), Tve(&batch.Tve[k0]);
+
+    Double N = 0.0;
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+      rho[iSpecies] = Double(&batch.rhos[iSpecies*BATCH_SIZE + k0]);
+      w[iSpecies] = 0.0;
+      N += rho[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
+    }
+    N = N*(1E-6);
+
+    for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+
+      /*--- Rate-controlling and modified temperatures. ---*/
+      const Double Trxnf = pow(T, Tcf_a[iReaction])*pow(Tve, Tcf_b[iReaction]);
+      const Double Trxnb = pow(T, Tcb_a[iReaction])*pow(Tve, Tcb_b[iReaction]);
+      const Double Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
+      const Double Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
+
+      /*--- Equilibrium constants, the table interval depends on the number density of each point. ---*/
+      Double Acoef[5];
+      for (size_t k = 0; k < Double::Size; ++k) {
+        InterpolateKeqConstants(iReaction, N[k], coeffs);
+        for (unsigned short ii = 0; ii < 5; ii++) Acoef[ii][k] = coeffs[ii];
+      }
+      const Double Keq = exp(  Acoef[0]*(Thb/1E4) + Acoef[1] + Acoef[2]*log(1E4/Thb)
+                             + Acoef[3]*(1E4/Thb) + Acoef[4]*(1E4/Thb)*(1E4/Thb) );
+
+      /*--- Rate coefficients. ---*/
+      const Double kf  = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf)) * exp(-ArrheniusTheta[iReaction]/Thf);
+      const Double kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thb)) * exp(-ArrheniusTheta[iReaction]/Thb);
+      const Double kb  = kfb / Keq;
+
+      Double fwdRxn = 1.0, bkwRxn = 1.0;
+      for (unsigned short ii = 0; ii < 3; ii++) {
+        iSpecies = Reactions(iReaction,0,ii);
+        if (iSpecies != nSpecies) fwdRxn *= 0.001*rho[iSpecies]/MolarMass[iSpecies];
+
+        jSpecies = Reactions(iReaction,1,ii);
+        if (jSpecies != nSpecies) bkwRxn *= 0.001*rho[jSpecies]/MolarMass[jSpecies];
+      }
+      fwdRxn = 1000.0 * kf * fwdRxn;
+      bkwRxn = 1000.0 * kb * bkwRxn;
+
+      for (unsigned short ii = 0; ii < 3; ii++) {
+        iSpecies = Reactions(iReaction,1,ii);
+        if (iSpecies != nSpecies) w[iSpecies] += MolarMass[iSpecies] * (fwdRxn-bkwRxn);
+
+        iSpecies = Reactions(iReaction,0,ii);
+        if (iSpecies != nSpecies) w[iSpecies] -= MolarMass[iSpecies] * (fwdRxn-bkwRxn);
+      }
+    }
+
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      w[iSpecies].store(&batch.ws[iSpecies*BATCH_SIZE + k0]);
+  }
+}
+
+void CSU2TCLib::ComputeBatchEveSourceTerm(ThermoChemBatch& batch) {
+
+  if (batch.size == 0) return;
+  PadBatch(nSpecies, batch);
+
+  /*--- Same as ComputeEveSourceTerm, see there for details. ---*/
+  vector<Double> rho(nSpecies), MolarFrac(nSpecies), eve_T(nSpecies), eve_Tve(nSpecies);
+
+  for (size_t k0 = 0; k0 < batch.size; k0 += Double::Size) {
+
+    const Double T(&batch.T[k0]), Tve(&batch.Tve[k0]);
+
+    Double P = 0.0, N = 0.0, conc = 0.0;
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+      rho[iSpecies] = Double(&batch.rhos[iSpecies*BATCH_SIZE + k0]);
+      P += rho[iSpecies] * Ru/MolarMass[iSpecies] * (iSpecies < nEl? Tve : T);
+      conc += rho[iSpecies] / MolarMass[iSpecies];
+      N    += rho[iSpecies] / MolarMass[iSpecies] * AVOGAD_CONSTANT;
+    }
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      MolarFrac[iSpecies] = (rho[iSpecies] / MolarMass[iSpecies]) / conc;
+
+    ComputeSpeciesEveBatch(T, true, eve_T.data());
+    ComputeSpeciesEveBatch(Tve, true, eve_Tve.data());
+
+    const Double T_13 = pow(T, -1.0/3.0);
+    Double omegaVT = 0.0, omegaCV = 0.0;
+
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+
+      /*--- Millikan & White relaxation time. ---*/
+      Double num = 0.0, denom = 0.0;
+      for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+        const Double tau_sr = 101325.0/P * exp(MillikanWhiteA(iSpecies,jSpecies)*(T_13 - MillikanWhiteB(iSpecies,jSpecies)) - 18.42);
+        num   += MolarFrac[jSpecies];
+        denom += MolarFrac[jSpecies] / tau_sr;
+      }
+      const Double tauMW = num / denom;
+
+      /*--- Park limiting cross section. ---*/
+      const Double Cs = sqrt((8.0*Ru*T)/(PI_NUMBER*MolarMass[iSpecies]));
+      const Double sig_s = 3E-21*(2.5E9)/(T*T);
+      const Double tauP = 1/(sig_s*Cs*N);
+
+      omegaVT += rho[iSpecies] * (eve_T[iSpecies] - eve_Tve[iSpecies]) / (tauMW + tauP);
+    }
+
+    if (!frozen) {
+      for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+        omegaCV += Double(&batch.ws[iSpecies*BATCH_SIZE + k0]) * eve_Tve[iSpecies];
+    }
+
+    Double(omegaVT + omegaCV).store(&batch.EveSource[k0]);
+  }
+}
@@ -0,0 +1,320 @@
+/*!
+ * \file CTabulatedGas.cpp
+ * \brief Source of the fluid model that interpolates the properties of another model from a look-up table.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <limits>
+
+#include "../../include/fluid/CTabulatedGas.hpp"
+
+namespace {
+/*--- Identifies the format of the table files. ---*/
+const char tableMagic[8] = {'S','U','2','L','U','T','0','2'};
+
+/*--- Most recent table, reused by the solvers of other grid levels (and zones) when it matches. ---*/
+weak_ptr<const CTabulatedGas::Table> lastTable;
+
+bool Close(passivedouble value, passivedouble ref) { return fabs(value - ref) <= 1e-12 * fabs(ref); }
+
+/*!
+ * \brief Check if the sizes, limits, and model signature of two tables match.
+ */
+bool SameTable(const CTabulatedGas::Table& a, const CTabulatedGas::Table& b) {
+  if (a.nDensity != b.nDensity || a.nEnergy != b.nEnergy) return false;
+  for (auto i = 0u; i < CTabulatedGas::N_SIGNATURE; ++i) {
+    if (!Close(a.signature[i], b.signature[i])) return false;
+  }
+  for (int i = 0; i < 4; ++i) {
+    if (!Close(a.limits[i], b.limits[i])) return false;
+  }
+  return true;
+}
+
+bool ReadTable(const string& fileName, CTabulatedGas::Table& table) {
+  ifstream file(fileName, ios::binary);
+  if (!file.is_open()) return false;
+
+  char magic[8];
+  unsigned long header[3];
+  CTabulatedGas::Table fileTable;
+  file.read(magic, sizeof(magic));
+  file.read(reinterpret_cast<char*>(header), sizeof(header));
+  file.read(reinterpret_cast<char*>(fileTable.signature), sizeof(fileTable.signature));
+  file.read(reinterpret_cast<char*>(fileTable.limits), sizeof(fileTable.limits));
+  if (!file.good() || !equal(magic, magic+8, tableMagic)) return false;
+
+  /*--- The table must match the requested one, including the model that was tabulated. ---*/
+  fileTable.nDensity = header[0];
+  fileTable.nEnergy = header[1];
+  if (header[2] != CTabulatedGas::N_PROPERTIES || !SameTable(fileTable, table)) return false;
+
+  table.data.resize(table.nDensity * table.nEnergy * CTabulatedGas::N_PROPERTIES);
+  file.read(reinterpret_cast<char*>(table.data.data()), table.data.size()*sizeof(passivedouble));
+  return file.good();
+}
+
+void WriteTable(const string& fileName, const CTabulatedGas::Table& table) {
+  ofstream file(fileName, ios::binary);
+  if (!file.is_open()) return;
+
+  const unsigned long header[3] = {table.nDensity, table.nEnergy, CTabulatedGas::N_PROPERTIES};
+  file.write(tableMagic, sizeof(tableMagic));
+  file.write(reinterpret_cast<const char*>(header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(table.signature), sizeof(table.signature));
+  file.write(reinterpret_cast<const char*>(table.limits), sizeof(table.limits));
+  file.write(reinterpret_cast<const char*>(table.data.data()), table.data.size()*sizeof(passivedouble));
+}
+}
+
+shared_ptr<const CTabulatedGas::Table> CTabulatedGas::MakeTable(CFluidModel& model, const CConfig& config,
+                                                                 su2double pressureRef, su2double densityRef) {
+  const bool rank0 = (SU2_MPI::GetRank() == MASTER_NODE);
+
+  model.SetTDState_Prho(pressureRef, densityRef);
+  const auto energyRef = SU2_TYPE::GetValue(model.GetStaticEnergy());
+
+  auto table = make_shared<Table>();
+  const auto size = config.GetFluidTable_Size();
+  const auto limits = config.GetFluidTable_Limits();
+
+  table->nDensity = max<unsigned long>(size[0], 2);
+  table->nEnergy = max<unsigned long>(size[1], 2);
+  for (int i = 0; i < 2; ++i) {
+    table->limits[i] = SU2_TYPE::GetValue(limits[i] * densityRef);
+    table->limits[2+i] = SU2_TYPE::GetValue(limits[2+i]) * energyRef;
+  }
+  table->invDelta[0] = (table->nDensity-1) / (table->limits[1] - table->limits[0]);
+  table->invDelta[1] = (table->nEnergy-1) / (table->limits[3] - table->limits[2]);
+
+  if (!(table->invDelta[0] > 0.0) || !(table->invDelta[1] > 0.0)) {
+    SU2_MPI::Error("The limits of the fluid table are not valid.", CURRENT_FUNCTION);
+  }
+
+  /*--- Kind and parameters of the tabulated model, the non-dimensionalization
+   *    is accounted for by the limits (relative to the reference state). ---*/
+
+  const auto kindModel = config.GetKind_FluidModel();
+  table->signature[0] = kindModel;
+  table->signature[1] = (kindModel == STANDARD_AIR)? 1.4 : SU2_TYPE::GetValue(config.GetGamma());
+  table->signature[2] = (kindModel == STANDARD_AIR)? 287.058 : SU2_TYPE::GetValue(config.GetGas_Constant());
+  table->signature[3] = SU2_TYPE::GetValue(config.GetPressure_Critical());
+  table->signature[4] = SU2_TYPE::GetValue(config.GetTemperature_Critical());
+  table->signature[5] = SU2_TYPE::GetValue(config.GetAcentric_Factor());
+
+  /*--- The solvers of the coarse grids use the table of the finest grid. ---*/
+
+  auto cached = lastTable.lock();
+  if (cached && SameTable(*cached, *table)) return cached;
+
+  const auto& fileName = config.GetFluidTable_FileName();
+
+  /*--- All ranks must read the file for the table not to be built (which is collective). ---*/
+  int readOk = ReadTable(fileName, *table), allReadOk = readOk;
+  SU2_MPI::Allreduce(&readOk, &allReadOk, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  if (allReadOk) {
+    if (rank0) cout << "Fluid table read from " << fileName << "." << endl;
+    lastTable = table;
+    return table;
+  }
+
+  /*--- Build the table, states for which the model fails are marked with NaN
+   *    (the interpolation then uses the model directly). The rows are distributed
+   *    over the MPI ranks and then summed, each entry is computed by one rank. ---*/
+
+  table->data.assign(table->nDensity * table->nEnergy * N_PROPERTIES, 0.0);
+  const auto NaN = std::numeric_limits<passivedouble>::quiet_NaN();
+  const auto rank = SU2_MPI::GetRank(), nRank = SU2_MPI::GetSize();
+
+  for (auto i = static_cast<unsigned long>(rank); i < table->nDensity; i += nRank) {
+    const su2double rho = table->limits[0] + i / table->invDelta[0];
+
+    for (auto j = 0ul; j < table->nEnergy; ++j) {
+      const su2double e = table->limits[2] + j / table->invDelta[1];
+      model.SetTDState_rhoe(rho, e);
+
+      auto props = &table->data[(i*table->nEnergy + j) * N_PROPERTIES];
+      props[PRESSURE] = SU2_TYPE::GetValue(model.GetPressure());
+      props[TEMPERATURE] = SU2_TYPE::GetValue(model.GetTemperature());
+      props[SOUNDSPEED2] = SU2_TYPE::GetValue(model.GetSoundSpeed2());
+      props[DPDRHO_E] = SU2_TYPE::GetValue(model.GetdPdrho_e());
+      props[DPDE_RHO] = SU2_TYPE::GetValue(model.GetdPde_rho());
+      props[DTDRHO_E] = SU2_TYPE::GetValue(model.GetdTdrho_e());
+      props[DTDE_RHO] = SU2_TYPE::GetValue(model.GetdTde_rho());
+      props[CP] = SU2_TYPE::GetValue(model.GetCp());
+      props[ENTROPY] = SU2_TYPE::GetValue(model.GetEntropy());
+
+      if (!(props[PRESSURE] > 0.0) || !(props[TEMPERATURE] > 0.0) || !(props[SOUNDSPEED2] > 0.0)) {
+        for (auto k = 0u; k < N_PROPERTIES; ++k) props[k] = NaN;
+      }
+    }
+  }
+
+  if (nRank > 1) {
+    using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+    const auto local = table->data;
+    MPI_Wrapper::Allreduce(local.data(), table->data.data(), local.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  }
+
+  if (rank0) {
+    cout << "Fluid table with " << table->nDensity << "x" << table->nEnergy << " nodes built";
+    WriteTable(fileName, *table);
+    cout << " and written to " << fileName << "." << endl;
+  }
+  lastTable = table;
+  return table;
+}
+
+CTabulatedGas::CTabulatedGas(CFluidModel* model, shared_ptr<const Table> table) :
+  CFluidModel(), Model(model), LUT(move(table)) {
+  Cp = Model->GetCp();
+  Cv = Model->GetCv();
+}
+
+bool CTabulatedGas::Interpolate(su2double rho, su2double e, su2double* props) const {
+  const auto& table = *LUT;
+
+  /*--- Position in the table, in units of the spacing. ---*/
+  const su2double x = (rho - table.limits[0]) * table.invDelta[0];
+  const su2double y = (e - table.limits[2]) * table.invDelta[1];
+
+  const auto xv = SU2_TYPE::GetValue(x), yv = SU2_TYPE::GetValue(y);
+  if (!(xv >= 0.0 && xv <= table.nDensity-1 && yv >= 0.0 && yv <= table.nEnergy-1)) return false;
+
+  const auto i = min<unsigned long>(xv, table.nDensity-2);
+  const auto j = min<unsigned long>(yv, table.nEnergy-2);
+
+  const auto v00 = &table.data[(i*table.nEnergy + j) * N_PROPERTIES];
+  const auto v01 = v00 + N_PROPERTIES;
+  const auto v10 = v00 + table.nEnergy * N_PROPERTIES;
+  const auto v11 = v10 + N_PROPERTIES;
+
+  if (std::isnan(v00[0]) || std::isnan(v01[0]) || std::isnan(v10[0]) || std::isnan(v11[0])) return false;
+
+  const su2double fx = x - i, fy = y - j;
+  const su2double w00 = (1-fx)*(1-fy), w01 = (1-fx)*fy, w10 = fx*(1-fy), w11 = fx*fy;
+
+  for (auto k = 0u; k < N_PROPERTIES; ++k)
+    props[k] = w00*v00[k] + w01*v01[k] + w10*v10[k] + w11*v11[k];
+
+  return true;
+}
+
+void CTabulatedGas::CopyModelState() {
+  Density = Model->GetDensity();
+  StaticEnergy = Model->GetStaticEnergy();
+  Pressure = Model->GetPressure();
+  Temperature = Model->GetTemperature();
+  SoundSpeed2 = Model->GetSoundSpeed2();
+  Entropy = Model->GetEntropy();
+  Cp = Model->GetCp();
+  Cv = Model->GetCv();
+  dPdrho_e = Model->GetdPdrho_e();
+  dPde_rho = Model->GetdPde_rho();
+  dTdrho_e = Model->GetdTdrho_e();
+  dTde_rho = Model->GetdTde_rho();
+  dhdrho_P = Model->Getdhdrho_P();
+  dhdP_rho = Model->GetdhdP_rho();
+  dsdrho_P = Model->Getdsdrho_P();
+  dsdP_rho = Model->GetdsdP_rho();
+}
+
+void CTabulatedGas::SetTDState_rhoe(su2double rho, su2double e) {
+  su2double props[N_PROPERTIES];
+
+  if (!Interpolate(rho, e, props)) {
+    Model->SetTDState_rhoe(rho, e);
+    CopyModelState();
+    return;
+  }
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = props[PRESSURE];
+  Temperature = props[TEMPERATURE];
+  SoundSpeed2 = props[SOUNDSPEED2];
+  dPdrho_e = props[DPDRHO_E];
+  dPde_rho = props[DPDE_RHO];
+  dTdrho_e = props[DTDRHO_E];
+  dTde_rho = props[DTDE_RHO];
+  Cp = props[CP];
+  Cv = 1.0 / dTde_rho;
+  Entropy = props[ENTROPY];
+}
+
+void CTabulatedGas::ComputeStates_rhoe(StateBatch& batch) {
+  su2double props[N_PROPERTIES];
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    if (!Interpolate(batch.Density[k], batch.StaticEnergy[k], props)) {
+      Model->SetTDState_rhoe(batch.Density[k], batch.StaticEnergy[k]);
+      CopyModelState();
+      GetTDState(batch, k);
+      continue;
+    }
+    batch.Pressure[k] = props[PRESSURE];
+    batch.Temperature[k] = props[TEMPERATURE];
+    batch.SoundSpeed2[k] = props[SOUNDSPEED2];
+    batch.dPdrho_e[k] = props[DPDRHO_E];
+    batch.dPde_rho[k] = props[DPDE_RHO];
+    batch.dTdrho_e[k] = props[DTDRHO_E];
+    batch.dTde_rho[k] = props[DTDE_RHO];
+    batch.Cp[k] = props[CP];
+  }
+}
+
+void CTabulatedGas::SetTDState_PT(su2double P, su2double T) {
+  Model->SetTDState_PT(P, T);
+  CopyModelState();
+}
+
+void CTabulatedGas::SetTDState_Prho(su2double P, su2double rho) {
+  Model->SetTDState_Prho(P, rho);
+  CopyModelState();
+}
+
+void CTabulatedGas::SetEnergy_Prho(su2double P, su2double rho) {
+  Model->SetEnergy_Prho(P, rho);
+  StaticEnergy = Model->GetStaticEnergy();
+}
+
+void CTabulatedGas::SetTDState_hs(su2double h, su2double s) {
+  Model->SetTDState_hs(h, s);
+  CopyModelState();
+}
+
+void CTabulatedGas::SetTDState_rhoT(su2double rho, su2double T) {
+  Model->SetTDState_rhoT(rho, T);
+  CopyModelState();
+}
+
+void CTabulatedGas::SetTDState_Ps(su2double P, su2double s) {
+  Model->SetTDState_Ps(P, s);
+  CopyModelState();
+}
+
+void CTabulatedGas::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
+  Model->ComputeDerivativeNRBC_Prho(P, rho);
+  CopyModelState();
+}
@@ -53,6 +53,36 @@ void CVanDerWaalsGas::SetTDState_rhoe(su2double rho, su2double e) {
   Zed = Pressure / (Gas_Constant * Temperature * Density);
 }
 
+void CVanDerWaalsGas::ComputeStates_rhoe(StateBatch& batch) {
+  using Double = simd::Array<su2double>;
+
+  for (size_t i = 0; i < BATCH_SIZE; i += Double::Size) {
+    const Double rho(batch.Density + i);
+    const Double e(batch.StaticEnergy + i);
+
+    const Double P = Gamma_Minus_One * rho / (1.0 - rho * b) * (e + rho * a) - a * rho * rho;
+    const Double T = (P + rho * rho * a) * ((1.0 - rho * b) / (rho * Gas_Constant));
+
+    const Double dPde = rho * Gamma_Minus_One / (1.0 - rho * b);
+    const Double dPdrho = Gamma_Minus_One / (1.0 - rho * b) *
+                          ((e + 2.0 * rho * a) + rho * b * (e + rho * a) / (1.0 - rho * b)) - 2.0 * rho * a;
+    const Double c2 = dPdrho + P / (rho * rho) * dPde;
+
+    P.store(batch.Pressure + i);
+    T.store(batch.Temperature + i);
+    c2.store(batch.SoundSpeed2 + i);
+    dPdrho.store(batch.dPdrho_e + i);
+    dPde.store(batch.dPde_rho + i);
+    Double(Cp).store(batch.Cp + i);
+    Double(Gamma_Minus_One / Gas_Constant * a).store(batch.dTdrho_e + i);
+    Double(Gamma_Minus_One / Gas_Constant).store(batch.dTde_rho + i);
+  }
+
+  /*--- The compressibility factor is the initial guess of SetTDState_PT, keep the one of the last point. ---*/
+  const auto k = batch.size - 1;
+  Zed = batch.Pressure[k] / (Gas_Constant * batch.Temperature[k] * batch.Density[k]);
+}
+
 void CVanDerWaalsGas::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-5;
   unsigned short nmax = 20, count = 0;
@@ -49,8 +49,14 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   bool dual_time = ((config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                     (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND));
 
+  /*--- Tape memory accounting of the discrete adjoint recording. ---*/
+
+  const char* owner = solver_container[MainSolver]->GetSolverName().c_str();
+  passivedouble tapeMemory = 0.0;
+
   /*--- Compute inviscid residuals ---*/
 
+  config->TapeTick(&tapeMemory);
   switch (config->GetKind_ConvNumScheme()) {
     case SPACE_CENTERED:
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
@@ -59,12 +65,17 @@ void CIntegration::Space_Integration(CGeometry *geometry,
       solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
       break;
   }
+  config->TapeTock(tapeMemory, owner, TAPE_REGION::CONVECTIVE);
 
   /*--- Compute viscous residuals ---*/
+  config->TapeTick(&tapeMemory);
   solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  config->TapeTock(tapeMemory, owner, TAPE_REGION::VISCOUS);
 
   /*--- Compute source term residuals ---*/
+  config->TapeTick(&tapeMemory);
   solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  config->TapeTock(tapeMemory, owner, TAPE_REGION::SOURCE);
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
@@ -80,6 +91,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   /// TODO: Check if this is really needed.
   //const auto pausePreacc = (omp_get_num_threads() > 1) && AD::PausePreaccumulation();
 
+  config->TapeTick(&tapeMemory);
+
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config);
@@ -185,6 +198,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
     solver_container[MainSolver]->BC_Periodic(geometry, solver_container, conv_bound_numerics, config);
   }
 
+  config->TapeTock(tapeMemory, owner, TAPE_REGION::BOUNDARY);
+
   //AD::ResumePreaccumulation(pausePreacc);
 
 }
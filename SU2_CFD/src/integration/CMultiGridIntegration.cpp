@@ -92,6 +92,15 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                             geometry[iZone][iInst][FinestMesh],
                             config[iZone]);
 
+    if ((RunTime_EqSystem == RUNTIME_FLOW_SYS) && config[iZone]->GetMG_Turbulence()) {
+      SetProlongated_Solution(RUNTIME_TURB_SYS,
+                              solver_container[iZone][iInst][FinestMesh-1][TURB_SOL],
+                              solver_container[iZone][iInst][FinestMesh][TURB_SOL],
+                              geometry[iZone][iInst][FinestMesh-1],
+                              geometry[iZone][iInst][FinestMesh],
+                              config[iZone]);
+    }
+
     SU2_OMP_MASTER
     config[iZone]->SubtractFinestMesh();
     END_SU2_OMP_MASTER
@@ -102,10 +111,13 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
 
   FinestMesh = config[iZone]->GetFinestMesh();
 
-  /*--- Perform the Full Approximation Scheme multigrid ---*/
+  /*--- Perform the Full Approximation Scheme multigrid. With multirate local time stepping
+   *    each cycle is a sub-step, which are repeated until all points reach the new time. ---*/
 
-  MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
-                  FinestMesh, RecursiveParam, RunTime_EqSystem, iZone, iInst);
+  do {
+    MultiGrid_Cycle(geometry, solver_container, numerics_container, config,
+                    FinestMesh, RecursiveParam, RunTime_EqSystem, iZone, iInst);
+  } while (solver_container[iZone][iInst][MESH_0][Solver_Position]->GetTimeLevelSubStep() != 0);
 
 
   /*--- Computes primitive variables and gradients in the finest mesh (useful for the next solver (turbulence) and output ---*/
@@ -141,6 +153,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const bool classical_rk4 = (config->GetKind_TimeIntScheme() == CLASSICAL_RK4_EXPLICIT);
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool coupled_turb = (RunTime_EqSystem == RUNTIME_FLOW_SYS) && config->GetMG_Turbulence();
 
   /*--- Shorter names to refer to fine grid entities. ---*/
 
@@ -211,6 +224,11 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     }
 
+    /*--- One iteration of the turbulence equations per flow iteration. ---*/
+
+    if (coupled_turb)
+      Turbulence_Smoothing(geometry_fine, solver_container_fine, numerics_container[iZone][iInst][iMesh], config, iMesh);
+
   }
 
   /*--- Compute Forcing Term $P_(k+1) = I^(k+1)_k(P_k+F_k(u_k))-F_(k+1)(I^(k+1)_k u_k)$ and update solution for multigrid ---*/
@@ -236,17 +254,49 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SetResidual_Term(geometry_fine, solver_fine);
 
+    if (coupled_turb) {
+      Turbulence_Residual(geometry_fine, solver_container_fine, numerics_container[iZone][iInst][iMesh], config, iMesh);
+      SetResidual_Term(geometry_fine, solver_container_fine[TURB_SOL]);
+    }
+
     /*--- Compute $r_(k+1) = F_(k+1)(I^(k+1)_k u_k)$ ---*/
 
     SetRestricted_Solution(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config);
 
+    if (coupled_turb) {
+      SetRestricted_Solution(RUNTIME_TURB_SYS, solver_container_fine[TURB_SOL], solver_container_coarse[TURB_SOL],
+                             geometry_fine, geometry_coarse, config);
+    }
+
     solver_coarse->Preprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem, false);
 
+    if (coupled_turb) {
+
+      /*--- The coarse eddy viscosity is computed from the restricted state (instead of restricting the fine
+       *    one) to make the coarse residual consistent with the forcing term. ---*/
+
+      solver_container_coarse[TURB_SOL]->Postprocessing(geometry_coarse, solver_container_coarse, config, iMesh+1);
+
+      auto flowNodes = solver_coarse->GetNodes();
+      auto turbNodes = solver_container_coarse[TURB_SOL]->GetNodes();
+
+      SU2_OMP_FOR_STAT(roundUpDiv(geometry_coarse->GetnPoint(), omp_get_num_threads()))
+      for (unsigned long iPoint = 0; iPoint < geometry_coarse->GetnPoint(); iPoint++)
+        flowNodes->SetEddyViscosity(iPoint, turbNodes->GetmuT(iPoint));
+      END_SU2_OMP_FOR
+    }
+
     Space_Integration(geometry_coarse, solver_container_coarse, numerics_coarse, config, iMesh+1, NO_RK_ITER, RunTime_EqSystem);
 
     /*--- Compute $P_(k+1) = I^(k+1)_k(r_k) - r_(k+1) ---*/
 
-    SetForcing_Term(solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
+    SetForcing_Term(RunTime_EqSystem, solver_fine, solver_coarse, geometry_fine, geometry_coarse, config, iMesh+1);
+
+    if (coupled_turb) {
+      Turbulence_Residual(geometry_coarse, solver_container_coarse, numerics_container[iZone][iInst][iMesh+1], config, iMesh+1);
+      SetForcing_Term(RUNTIME_TURB_SYS, solver_container_fine[TURB_SOL], solver_container_coarse[TURB_SOL],
+                      geometry_fine, geometry_coarse, config, iMesh+1);
+    }
 
     /*--- Restore the time integration settings. ---*/
 
@@ -272,6 +322,16 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     SetProlongated_Correction(solver_fine, geometry_fine, config, iMesh);
 
+    if (coupled_turb) {
+      CSolver* turb_fine = solver_container_fine[TURB_SOL];
+
+      GetProlongated_Correction(RUNTIME_TURB_SYS, turb_fine, solver_container_coarse[TURB_SOL],
+                                geometry_fine, geometry_coarse, config);
+
+      SmoothProlongated_Correction(RUNTIME_TURB_SYS, turb_fine, geometry_fine, config->GetMG_CorrecSmooth(iMesh), 1.25, config);
+
+      SetProlongated_TurbCorrection(turb_fine, geometry_fine, config);
+    }
 
     /*--- Solution post-smoothing in the prolongated grid. ---*/
 
@@ -296,11 +356,65 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
         solver_fine->Postprocessing(geometry_fine, solver_container_fine, config, iMesh);
 
       }
+
+      if (coupled_turb)
+        Turbulence_Smoothing(geometry_fine, solver_container_fine, numerics_container[iZone][iInst][iMesh], config, iMesh);
     }
   }
 
 }
 
+void CMultiGridIntegration::SetEqSystem_Param(CConfig *config, unsigned short RunTime_EqSystem, bool residualOnly) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  {
+    config->SetGlobalParam(RANS, RunTime_EqSystem);
+    if (residualOnly && (config->GetKind_TimeIntScheme() == EULER_IMPLICIT))
+      config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+void CMultiGridIntegration::Turbulence_Smoothing(CGeometry *geometry, CSolver **solver_container,
+                                                 CNumerics ***numerics_container, CConfig *config,
+                                                 unsigned short iMesh) {
+
+  CSolver* solver = solver_container[TURB_SOL];
+
+  SetEqSystem_Param(config, RUNTIME_TURB_SYS, false);
+
+  solver->Preprocessing(geometry, solver_container, config, iMesh, NO_RK_ITER, RUNTIME_TURB_SYS, false);
+
+  solver->Set_OldSolution();
+
+  solver->SetTime_Step(geometry, solver_container, config, iMesh, config->GetTimeIter());
+
+  Space_Integration(geometry, solver_container, numerics_container[TURB_SOL], config, iMesh, NO_RK_ITER, RUNTIME_TURB_SYS);
+
+  Time_Integration(geometry, solver_container, config, NO_RK_ITER, RUNTIME_TURB_SYS);
+
+  solver->Postprocessing(geometry, solver_container, config, iMesh);
+
+  SetEqSystem_Param(config, RUNTIME_FLOW_SYS, false);
+}
+
+void CMultiGridIntegration::Turbulence_Residual(CGeometry *geometry, CSolver **solver_container,
+                                                CNumerics ***numerics_container, CConfig *config,
+                                                unsigned short iMesh) {
+
+  SetEqSystem_Param(config, RUNTIME_TURB_SYS, true);
+
+  solver_container[TURB_SOL]->Preprocessing(geometry, solver_container, config, iMesh, NO_RK_ITER, RUNTIME_TURB_SYS, false);
+
+  Space_Integration(geometry, solver_container, numerics_container[TURB_SOL], config, iMesh, NO_RK_ITER, RUNTIME_TURB_SYS);
+
+  /*--- Back to the flow, whose Jacobian is also not needed in the context where this is called. ---*/
+
+  SetEqSystem_Param(config, RUNTIME_FLOW_SYS, true);
+}
+
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   unsigned long Point_Fine, Point_Coarse, iVertex;
@@ -353,7 +467,10 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
          Note that Solution_Old stores the correction not the actual value ---*/
 
         su2double zero[3] = {0.0};
-        sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS)
+          sol_coarse->GetNodes()->SetSolution_Old(Point_Coarse, zero);
+        else
+          sol_coarse->GetNodes()->SetVelocity_Old(Point_Coarse, zero);
 
       }
       END_SU2_OMP_FOR
@@ -480,6 +597,50 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
 
 }
 
+void CMultiGridIntegration::SetProlongated_TurbCorrection(CSolver *sol_fine, CGeometry *geo_fine, CConfig *config) {
+
+  const unsigned short nVar = sol_fine->GetnVar();
+  const su2double factor = config->GetDamp_Correc_Prolong();
+
+  /*--- Same criterion used to under-relax the turbulence updates, the negative SA model is not limited. ---*/
+
+  const bool limit = (config->GetKind_Turb_Model() != TURB_MODEL::SA_NEG);
+  const su2double allowableRatio = 0.99;
+
+  SU2_OMP_FOR_STAT(roundUpDiv(geo_fine->GetnPointDomain(), omp_get_num_threads()))
+  for (unsigned long Point_Fine = 0; Point_Fine < geo_fine->GetnPointDomain(); Point_Fine++) {
+    su2double* Correction = sol_fine->LinSysRes.GetBlock(Point_Fine);
+    su2double* Solution_Fine = sol_fine->GetNodes()->GetSolution(Point_Fine);
+
+    /*--- Prevent a fine grid divergence due to a coarse grid divergence. ---*/
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      if (Correction[iVar] != Correction[iVar]) Correction[iVar] = 0.0;
+    }
+
+    /*--- Scale the correction such that no variable decreases by more than the allowable ratio. ---*/
+
+    su2double scale = 1.0;
+    if (limit) {
+      for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+        const su2double decrease = -factor*Correction[iVar];
+        const su2double maxDecrease = allowableRatio*fabs(Solution_Fine[iVar]);
+        if (decrease > maxDecrease) scale = min(scale, maxDecrease/decrease);
+      }
+    }
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      Solution_Fine[iVar] += scale*factor*Correction[iVar];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- MPI the new interpolated solution ---*/
+
+  sol_fine->InitiateComms(geo_fine, config, SOLUTION);
+  sol_fine->CompleteComms(geo_fine, config, SOLUTION);
+
+}
+
 void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                     CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   unsigned long Point_Fine, Point_Coarse;
@@ -495,8 +656,9 @@ void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSys
   END_SU2_OMP_FOR
 }
 
-void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
-                                            CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
+void CMultiGridIntegration::SetForcing_Term(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
+                                            CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config,
+                                            unsigned short iMesh) {
 
   unsigned long Point_Fine, Point_Coarse, iVertex;
   unsigned short iMarker, iVar, iChildren;
@@ -531,7 +693,10 @@ void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coar
       SU2_OMP_FOR_STAT(32)
       for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
         Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
-        sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
+        if (RunTime_EqSystem == RUNTIME_TURB_SYS)
+          sol_coarse->GetNodes()->SetRes_TruncErrorZero(Point_Coarse);
+        else
+          sol_coarse->GetNodes()->SetVel_ResTruncError_Zero(Point_Coarse);
       }
       END_SU2_OMP_FOR
     }
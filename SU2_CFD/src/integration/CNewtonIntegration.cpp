@@ -74,6 +74,13 @@ void CNewtonIntegration::Setup() {
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
 
+  auto fparam = config->GetNewtonKrylovForcingParam();
+
+  forcingMax = min(fparam[0], su2double(0.999));
+  forcingGamma = fparam[1];
+  forcingAlpha = fparam[2];
+  lineSearchIters = config->GetNewtonKrylovLineSearchIter();
+
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
   const auto nPointDomain = geometry->GetnPointDomain();
@@ -101,7 +108,9 @@ void CNewtonIntegration::Setup() {
   }
 
   /*--- Only possible with a preconditioner. ---*/
-  startupPeriod = (startupIters > 0) || (startupResidual < 0.0);
+  switchContraction = config->GetNewtonKrylovSwitchContraction();
+  fallbackIters = max<unsigned short>(1, startupIters);
+  startupPeriod = (startupIters > 0) || (startupResidual < 0.0) || (switchContraction > 0.0);
 
 }
 
@@ -169,6 +178,73 @@ void CNewtonIntegration::ComputeFinDiffStep() {
 
 }
 
+void CNewtonIntegration::ScaleSolutionUpdate(Scalar factor) {
+
+  auto nodes = solvers[FLOW_SOL]->GetNodes();
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    SU2_OMP_SIMD
+    for (auto iVar = 0ul; iVar < solvers[FLOW_SOL]->GetnVar(); ++iVar) {
+      const su2double delta = nodes->GetSolution(iPoint,iVar) - nodes->GetSolution_Old(iPoint,iVar);
+      nodes->AddSolution(iPoint,iVar, factor*delta);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+Scalar CNewtonIntegration::ForcingTerm(Scalar contraction) {
+
+  const Scalar etaMin = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+  const Scalar etaMax = max(etaMin, Scalar(SU2_TYPE::GetValue(forcingMax)));
+  const Scalar gamma = SU2_TYPE::GetValue(forcingGamma);
+  const Scalar alpha = SU2_TYPE::GetValue(forcingAlpha);
+
+  /*--- The first NK step (e.g. after quasi-Newton ones) uses the loosest tolerance. ---*/
+  Scalar eta = etaMax;
+
+  if (lastStepNK) {
+    eta = gamma * pow(contraction, alpha);
+
+    /*--- Safeguard against a sudden decrease of the forcing terms, which is not
+     * justified by a single good contraction. ---*/
+    const Scalar etaSafe = gamma * pow(forcingTerm, alpha);
+    if (etaSafe > 0.1) eta = max(eta, etaSafe);
+  }
+  eta = min(etaMax, max(etaMin, eta));
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  forcingTerm = eta;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  return eta;
+}
+
+bool CNewtonIntegration::LineSearch(Scalar resNorm, Scalar eta, Scalar& lambda) {
+
+  /*--- Sufficient decrease parameter and step reduction factor. ---*/
+  constexpr Scalar t = 1e-4, reduction = 0.5;
+
+  eta = min(eta, Scalar(1.0));
+  lambda = 1.0;
+
+  for (auto iter = 0u; iter <= lineSearchIters; ++iter) {
+    if (iter > 0) {
+      ScaleSolutionUpdate(reduction);
+      lambda *= reduction;
+    }
+
+    ComputeResiduals(EXPLICIT);
+
+    const Scalar trialNorm = SU2_TYPE::GetValue(solvers[FLOW_SOL]->LinSysRes.norm());
+
+    if (trialNorm <= (1.0 - t*lambda*(1.0-eta)) * resNorm) return true;
+  }
+  return false;
+}
+
 void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solvers_, CNumerics ******numerics_,
                                              CConfig **config_, unsigned short EqSystem, unsigned short iZone,
                                              unsigned short iInst) {
@@ -206,6 +282,31 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   for (auto iVar = 0ul; iVar < LinSysRes.GetNVar(); ++iVar)
     residual += log10(solvers[FLOW_SOL]->GetRes_RMS(iVar)) / LinSysRes.GetNVar();
 
+  /*--- Nonlinear contraction achieved by the previous step. ---*/
+
+  const Scalar resNorm = LinSysRes.norm();
+  const Scalar contraction = (prevResNorm > 0.0)? resNorm / prevResNorm : 1.0;
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+    if (prevResNorm > 0.0) {
+      /*--- Quasi-Newton steps can be erratic, an average of the recent ones is monitored. ---*/
+      const Scalar logC = log(max(contraction, Scalar(EPS)));
+      logContraction = (nContraction > 0)? 0.75*logContraction + 0.25*logC : logC;
+      nContraction += 1;
+    }
+    prevResNorm = resNorm;
+
+    /*--- Fall back to quasi-Newton steps if NK steps do not reduce the residual. ---*/
+    if ((switchContraction > 0.0) && lastStepNK && (lineSearchFailed || contraction >= 1.0)) {
+      startupPeriod = true;
+      startupIters = fallbackIters;
+      nContraction = 0;
+    }
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
   /*--- Check if startup period should end after this iteration. ---*/
 
   bool endStartup = false;
@@ -217,14 +318,20 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
     }
     END_SU2_OMP_MASTER
     SU2_OMP_BARRIER
-    endStartup = (startupIters == 0) && (residual - firstResidual < startupResidual);
+    const bool stagnated = (switchContraction > 0.0) && (nContraction > 2) &&
+                           (logContraction > log(SU2_TYPE::GetValue(switchContraction)));
+    endStartup = (startupIters == 0) && ((residual - firstResidual < startupResidual) || stagnated);
   }
 
-  /*--- The NK solves are expensive, the tolerance is relaxed while the residuals are high. ---*/
+  /*--- The NK solves are expensive, the tolerance is relaxed while the residuals are high,
+   * or it is adapted to the nonlinear contraction with the Eisenstat-Walker approach. ---*/
 
   Scalar toleranceFactor = 1.0;
 
-  if (!startupPeriod && tolRelaxFactor > 1 && fullTolResidual < 0.0) {
+  if (!startupPeriod && forcingMax > 0.0) {
+    toleranceFactor = ForcingTerm(contraction) / SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+  }
+  else if (!startupPeriod && tolRelaxFactor > 1 && fullTolResidual < 0.0) {
     SU2_OMP_MASTER
     firstResidual = max(firstResidual, residual);
     END_SU2_OMP_MASTER
@@ -240,6 +347,8 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   auto& linSysSol = GetSolutionVec(solvers[FLOW_SOL]->LinSysSol);
 
+  Scalar eta = 1.0;
+
   if (startupPeriod) {
     iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
   }
@@ -249,24 +358,40 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
     eps *= toleranceFactor;
     iter = LinSolver.FGMRES_LinSolver(LinSysRes, linSysSol, CMatrixFreeProductWrapper(this),
                                       CPreconditionerWrapper(this), eps, iter, eps, false, config);
+    eta = eps;
     /*--- Scale back the residual to trick the CFL adaptation. ---*/
     eps /= toleranceFactor;
   }
   SetSolutionResult(solvers[FLOW_SOL]->LinSysSol);
 
+  /*--- Update solution. ---*/
+
+  solvers[FLOW_SOL]->CompleteImplicitIteration(geometry, solvers, config);
+
+  /*--- Backtrack NK steps that do not decrease the residual sufficiently. Needing to backtrack
+   * means the CFL is too high, this is signaled to the CFL adaptation via the linear residual. ---*/
+
+  bool failed = false;
+
+  if (!startupPeriod && lineSearchIters > 0) {
+    Scalar lambda = 1.0;
+    failed = !LineSearch(resNorm, eta, lambda);
+
+    if (lambda < 1.0) {
+      const su2double linTol = max(config->GetCFL_AdaptParam(4), config->GetLinear_Solver_Error());
+      eps = max(eps, Scalar(1.25 * SU2_TYPE::GetValue(linTol)));
+    }
+  }
+
   SU2_OMP_MASTER {
     solvers[FLOW_SOL]->SetIterLinSolver(iter);
     solvers[FLOW_SOL]->SetResLinSolver(eps);
+    lineSearchFailed = failed;
+    lastStepNK = !startupPeriod;
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
 
-  /// TODO: Clever back-tracking and CFL adaptation based on residual reduction.
-
-  /*--- Update solution. ---*/
-
-  solvers[FLOW_SOL]->CompleteImplicitIteration(geometry, solvers, config);
-
   /*--- Call the various post processings. ---*/
 
   solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, true);
@@ -286,6 +411,7 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
     SU2_OMP_MASTER {
       startupPeriod = false;
       firstResidual = residual;
+      nContraction = 0;
     }
     END_SU2_OMP_MASTER
     SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -26,6 +26,7 @@
  */
 
 #include "../../include/iteration/CDiscAdjFluidIteration.hpp"
+#include "../../include/iteration/CPrimalCheckpoints.hpp"
 #include "../../include/output/COutput.hpp"
 
 void CDiscAdjFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
@@ -334,7 +335,27 @@ void CDiscAdjFluidIteration::LoadUnsteady_Solution(CGeometry**** geometry, CSolv
 
   auto solvers = solver[iZone][iInst];
 
-  if (DirectIter >= 0) {
+  if (DirectIter >= 0 && checkpoints != nullptr) {
+    /*--- Recompute the solution from the checkpoints kept in memory ---*/
+    if (rank == MASTER_NODE)
+      cout << " Restoring flow solution of direct iteration " << DirectIter << " for zone " << iZone << "." << endl;
+
+    checkpoints->Load(DirectIter);
+
+    if (rank == MASTER_NODE)
+      cout << " " << checkpoints->GetnRecomputed() << " direct time steps recomputed so far." << endl;
+
+    for (auto iMesh = 0u; iMesh <= config[iZone]->GetnMGLevels(); iMesh++) {
+      solvers[iMesh][FLOW_SOL]->Preprocessing(geometry[iZone][iInst][iMesh], solvers[iMesh], config[iZone], iMesh,
+                                              NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+      if (turbulent) {
+        solvers[iMesh][TURB_SOL]->Postprocessing(geometry[iZone][iInst][iMesh], solvers[iMesh], config[iZone], iMesh);
+      }
+      if (config[iZone]->GetWeakly_Coupled_Heat()) {
+        solvers[iMesh][HEAT_SOL]->Postprocessing(geometry[iZone][iInst][iMesh], solvers[iMesh], config[iZone], iMesh);
+      }
+    }
+  } else if (DirectIter >= 0) {
     if (rank == MASTER_NODE)
       cout << " Loading flow solution from direct iteration " << DirectIter << " for zone " << iZone << "." << endl;
 
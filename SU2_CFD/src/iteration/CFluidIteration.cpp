@@ -45,6 +45,25 @@ void CFluidIteration::Preprocess(COutput* output, CIntegration**** integration,
         geometry[val_iZone][val_iInst], solver[val_iZone][val_iInst], config[val_iZone], TimeIter);
   }
 
+  /*--- Start the inner iterations of a new dual time step from the extrapolation of the previous steps. ---*/
+
+  const auto order = GetTimeExtrapolationOrder(config[val_iZone]);
+
+  if ((order > 0) && (OuterIter == 0)) {
+    const auto nDim = geometry[val_iZone][val_iInst][MESH_0]->GetnDim();
+
+    for (auto iSol : {FLOW_SOL, TURB_SOL, TRANS_SOL, HEAT_SOL}) {
+      auto timeSolver = solver[val_iZone][val_iInst][MESH_0][iSol];
+      if (!timeSolver) continue;
+
+      const auto positiveVars = GetPositiveVariables(config[val_iZone], iSol, nDim, timeSolver->GetnVar());
+
+      SU2_OMP_PARALLEL
+      timeSolver->GetNodes()->ExtrapolateSolution_time(order, positiveVars);
+      END_SU2_OMP_PARALLEL
+    }
+  }
+
   /*--- Apply a Wind Gust ---*/
 
   if (config[val_iZone]->GetWind_Gust()) {
@@ -107,11 +126,13 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
   if ((config[val_iZone]->GetKind_Solver() == RANS || config[val_iZone]->GetKind_Solver() == DISC_ADJ_RANS ||
        config[val_iZone]->GetKind_Solver() == INC_RANS || config[val_iZone]->GetKind_Solver() == DISC_ADJ_INC_RANS) &&
       !frozen_visc) {
-    /*--- Solve the turbulence model ---*/
+    /*--- Solve the turbulence model, unless it is part of the multigrid cycle of the flow ---*/
 
-    config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
-    integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
-                                                                      RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    if (!config[val_iZone]->GetMG_Turbulence()) {
+      config[val_iZone]->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
+      integration[val_iZone][val_iInst][TURB_SOL]->SingleGrid_Iteration(geometry, solver, numerics, config,
+                                                                        RUNTIME_TURB_SYS, val_iZone, val_iInst);
+    }
 
     /*--- Solve transition model ---*/
 
@@ -190,9 +211,15 @@ void CFluidIteration::Update(COutput* output, CIntegration**** integration, CGeo
     if ((config[val_iZone]->GetKind_Solver() == RANS) || (config[val_iZone]->GetKind_Solver() == DISC_ADJ_RANS) ||
         (config[val_iZone]->GetKind_Solver() == INC_RANS) ||
         (config[val_iZone]->GetKind_Solver() == DISC_ADJ_INC_RANS)) {
-      integration[val_iZone][val_iInst][TURB_SOL]->SetDualTime_Solver(geometry[val_iZone][val_iInst][MESH_0],
-                                                                      solver[val_iZone][val_iInst][MESH_0][TURB_SOL],
-                                                                      config[val_iZone], MESH_0);
+      /*--- All levels if the turbulence is part of the multigrid cycle. ---*/
+
+      const auto nTurbMesh = config[val_iZone]->GetMG_Turbulence() ? config[val_iZone]->GetnMGLevels() : MESH_0;
+
+      for (iMesh = 0; iMesh <= nTurbMesh; iMesh++) {
+        integration[val_iZone][val_iInst][TURB_SOL]->SetDualTime_Solver(geometry[val_iZone][val_iInst][iMesh],
+                                                                        solver[val_iZone][val_iInst][iMesh][TURB_SOL],
+                                                                        config[val_iZone], iMesh);
+      }
       integration[val_iZone][val_iInst][TURB_SOL]->SetConvergence(false);
     }
 
@@ -235,6 +262,13 @@ bool CFluidIteration::Monitor(COutput* output, CIntegration**** integration, CGe
   /*--- If convergence was reached --*/
   StopCalc = output->GetConvergence();
 
+  /*--- Dual time inner iterations stop once the residuals are below the temporal truncation error. ---*/
+
+  if (!StopCalc && (config[val_iZone]->GetInner_TruncError_Ratio() > 0.0)) {
+    StopCalc = MonitorTruncationError(geometry[val_iZone][INST_0][MESH_0], solver[val_iZone][INST_0][MESH_0],
+                                      config[val_iZone]);
+  }
+
   /* --- Checking convergence of Fixed CL mode to target CL, and perform finite differencing if needed  --*/
 
   if (config[val_iZone]->GetFixed_CL_Mode()) {
@@ -245,6 +279,77 @@ bool CFluidIteration::Monitor(COutput* output, CIntegration**** integration, CGe
   return StopCalc;
 }
 
+vector<unsigned short> CFluidIteration::GetPositiveVariables(const CConfig* config, unsigned short iSol,
+                                                             unsigned short nDim, unsigned short nVar) const {
+  vector<unsigned short> vars;
+
+  switch (iSol) {
+    case FLOW_SOL:
+      if (config->GetNEMOProblem()) {
+        /*--- Species densities, total and vib.-el. energy. ---*/
+        const unsigned short nSpecies = config->GetnSpecies();
+        for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies) vars.push_back(iSpecies);
+        vars.push_back(nSpecies+nDim);
+        vars.push_back(nSpecies+nDim+1);
+      } else if (config->GetKind_Regime() == ENUM_REGIME::INCOMPRESSIBLE) {
+        /*--- Temperature, the pressure is a gauge pressure. ---*/
+        vars.push_back(nDim+1);
+      } else {
+        /*--- Density and total energy. ---*/
+        vars.push_back(0);
+        vars.push_back(nDim+1);
+      }
+      break;
+    case TURB_SOL:
+      if (config->GetKind_Turb_Model() == TURB_MODEL::SA_NEG) break;
+      for (unsigned short iVar = 0; iVar < nVar; ++iVar) vars.push_back(iVar);
+      break;
+    default:
+      /*--- Transition variables and temperature. ---*/
+      for (unsigned short iVar = 0; iVar < nVar; ++iVar) vars.push_back(iVar);
+      break;
+  }
+  return vars;
+}
+
+unsigned short CFluidIteration::GetTimeExtrapolationOrder(const CConfig* config) const {
+
+  const auto order = config->GetTime_Extrapolation_Order();
+  if (order == 0) return 0;
+
+  /*--- Number of previous time levels (besides time n) that hold a computed or restarted solution. ---*/
+
+  const auto firstIter = config->GetRestart() ? config->GetRestart_Iter() : 0ul;
+  if (config->GetTimeIter() < firstIter) return 0;
+
+  auto nLevels = config->GetTimeIter() - firstIter;
+  if (config->GetRestart() && (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND)) nLevels += 1;
+
+  return static_cast<unsigned short>(min<unsigned long>(order, nLevels));
+}
+
+bool CFluidIteration::MonitorTruncationError(const CGeometry* geometry, CSolver** solver, const CConfig* config) const {
+
+  /*--- The predictor must have the order of the time discretization to estimate the error. ---*/
+
+  const auto order = GetTimeExtrapolationOrder(config);
+  if (order != config->GetTime_Extrapolation_Order()) return false;
+
+  const su2double ratio = config->GetInner_TruncError_Ratio();
+
+  for (auto iSol : {FLOW_SOL, TURB_SOL}) {
+    if (!solver[iSol]) continue;
+
+    vector<su2double> truncError(solver[iSol]->GetnVar());
+    solver[iSol]->ComputeTimeTruncationError(geometry, config, order, truncError.data());
+
+    for (auto iVar = 0u; iVar < truncError.size(); ++iVar) {
+      if (solver[iSol]->GetRes_RMS(iVar) > ratio * truncError[iVar]) return false;
+    }
+  }
+  return true;
+}
+
 void CFluidIteration::Postprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                   CSolver***** solver, CNumerics****** numerics, CConfig** config,
                                   CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
@@ -161,6 +161,9 @@ void CIteration::SetMesh_Deformation(CGeometry** geometry, CSolver** solver, CNu
     wasActive = AD::BeginPassive();
   }
 
+  passivedouble tapeMemory = 0.0;
+  config->TapeTick(&tapeMemory);
+
   /*--- Set the stiffness of each element mesh into the mesh numerics ---*/
 
   solver[MESH_SOL]->SetMesh_Stiffness(geometry, numerics[MESH_SOL], config);
@@ -169,6 +172,8 @@ void CIteration::SetMesh_Deformation(CGeometry** geometry, CSolver** solver, CNu
 
   solver[MESH_SOL]->DeformMesh(geometry, numerics[MESH_SOL], config);
 
+  config->TapeTock(tapeMemory, "MESH", TAPE_REGION::MESH_DEFORM);
+
   /*--- Continue recording. ---*/
   AD::EndPassive(wasActive);
 }
@@ -0,0 +1,171 @@
+/*!
+ * \file CPrimalCheckpoints.cpp
+ * \brief In-memory checkpointing of primal states for the unsteady discrete adjoint.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/iteration/CPrimalCheckpoints.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+CPrimalCheckpoints::CPrimalCheckpoints(CConfig* config_, CGeometry** geometry_, CSolver*** solver_, StepFunction step) :
+  nMesh(config_->GetnMGLevels()),
+  nCheckpoints(config_->GetUnst_AdjointCheckpoints()),
+  config(config_),
+  geometry(geometry_),
+  solver(solver_),
+  computeStep(step) {
+}
+
+template<class F>
+void CPrimalCheckpoints::ForEachSolver(F&& func) const {
+  for (auto iMesh = 0u; iMesh <= nMesh; ++iMesh) {
+    for (auto iSol : {FLOW_SOL, TURB_SOL, HEAT_SOL}) {
+      if (solver[iMesh][iSol] != nullptr) func(geometry[iMesh]->GetnPoint(), solver[iMesh][iSol]);
+    }
+  }
+}
+
+void CPrimalCheckpoints::Store(Snapshot& snap) const {
+
+  snap.clear();
+
+  ForEachSolver([&](unsigned long nPoint, const CSolver* sol) {
+    const auto nodes = sol->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0u; iVar < sol->GetnVar(); ++iVar) {
+        snap.push_back(SU2_TYPE::GetValue(nodes->GetSolution_time_n(iPoint, iVar)));
+        snap.push_back(SU2_TYPE::GetValue(nodes->GetSolution_time_n1(iPoint, iVar)));
+      }
+    }
+  });
+}
+
+void CPrimalCheckpoints::Restore(const Snapshot& snap, bool solution, bool timeLevels) {
+
+  auto value = snap.cbegin();
+
+  ForEachSolver([&](unsigned long nPoint, CSolver* sol) {
+    auto nodes = sol->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0u; iVar < sol->GetnVar(); ++iVar, value += 2) {
+        if (solution) nodes->SetSolution(iPoint, iVar, value[0]);
+        if (timeLevels) {
+          nodes->Set_Solution_time_n(iPoint, iVar, value[0]);
+          nodes->Set_Solution_time_n1(iPoint, iVar, value[1]);
+        }
+      }
+    }
+  });
+}
+
+void CPrimalCheckpoints::StoreFirstStep() {
+
+  /*--- The adjoint sets the free-stream for the time levels before the first step (see LoadUnsteady_Solution). ---*/
+
+  ForEachSolver([&](unsigned long, CSolver* sol) {
+    sol->SetFreeStream_Solution(config);
+    /*--- Set_Solution_time_n1 copies the time level n. ---*/
+    sol->GetNodes()->Set_Solution_time_n();
+    sol->GetNodes()->Set_Solution_time_n1();
+  });
+
+  /*--- The restart of each solver also sets the coarse levels. ---*/
+
+  for (auto iSol : {FLOW_SOL, TURB_SOL, HEAT_SOL}) {
+    if (solver[MESH_0][iSol] != nullptr)
+      solver[MESH_0][iSol]->LoadRestart(geometry, solver, config, 0, iSol == FLOW_SOL);
+  }
+
+  ForEachSolver([&](unsigned long, CSolver* sol) { sol->GetNodes()->Set_Solution_time_n(); });
+
+  Store(checkpoints[0]);
+}
+
+unsigned long CPrimalCheckpoints::CheckpointOffset(unsigned long nSteps, unsigned long nFree) {
+
+  if (nFree == 0 || nSteps < 2) return 0;
+
+  /*--- Smallest number of repetitions (t) for which beta(s,t) = (s+t)!/(s!t!) steps can be
+   *    reversed with s checkpoints. The checkpoint is placed as far forward as possible, the
+   *    part before it must be reversible with t-1 repetitions, i.e. offset <= beta(s,t-1). ---*/
+
+  unsigned long t = 0, beta = 1, betaPrev = 1;
+  while (beta < nSteps) {
+    ++t;
+    betaPrev = beta;
+    beta = beta * (nFree + t) / t;
+  }
+  return std::min(betaPrev, nSteps - 1);
+}
+
+void CPrimalCheckpoints::Load(long iTimeIter) {
+
+  /*--- The reverse sweep does not come back to later time steps. ---*/
+
+  checkpoints.erase(checkpoints.upper_bound(iTimeIter), checkpoints.end());
+
+  /*--- The time levels n and n-1 belong to the adjoint iteration and are restored at the end. ---*/
+
+  if (checkpoints.empty()) {
+    Store(scratch);
+    StoreFirstStep();
+    Restore(scratch, false, true);
+  }
+
+  const auto it = checkpoints.find(iTimeIter);
+  if (it != checkpoints.end()) {
+    Restore(it->second, true, false);
+    return;
+  }
+
+  Store(scratch);
+
+  /*--- Restart from the last checkpoint before the requested state and place new checkpoints
+   *    in the free slots while advancing, they are reused by the next requests. ---*/
+
+  const auto last = std::prev(checkpoints.lower_bound(iTimeIter));
+  Restore(last->second, true, true);
+
+  unsigned long nFree = nCheckpoints + 1 - checkpoints.size();
+  auto offset = CheckpointOffset(iTimeIter - last->first, nFree);
+  long nextCheckpoint = offset ? last->first + offset : iTimeIter;
+
+  for (auto iStep = last->first + 1; iStep <= iTimeIter; ++iStep) {
+    computeStep(iStep);
+    ++nRecomputed;
+
+    if (iStep == nextCheckpoint && iStep < iTimeIter) {
+      Store(checkpoints[iStep]);
+      --nFree;
+      offset = CheckpointOffset(iTimeIter - iStep, nFree);
+      nextCheckpoint = offset ? iStep + offset : iTimeIter;
+    }
+  }
+
+  /*--- The requested state is kept as long as there is space, e.g. for the start of the reverse sweep. ---*/
+
+  if (nFree > 0) Store(checkpoints[iTimeIter]);
+
+  Restore(scratch, false, true);
+}
@@ -49,6 +49,7 @@ CSourceBase_TurbSA::CSourceBase_TurbSA(unsigned short val_nDim,
   cb2_sigma = cb2/sigma;
   cw1 = cb1/k2+(1.0+cb2)/sigma;
   cr1 = 0.5;
+  c5 = 3.5;
 
   /*--- Setup the Jacobian pointer, we need to return su2double** but
    *    we know the Jacobian is 1x1 so we use this "trick" to avoid
@@ -218,7 +219,7 @@ CNumerics::ResidualType<> CSourcePieceWise_TurbSA::ComputeResidual(const CConfig
 CSourcePieceWise_TurbSA_COMP::CSourcePieceWise_TurbSA_COMP(unsigned short val_nDim,
                                                            unsigned short val_nVar,
                                                            const CConfig* config) :
-                              CSourceBase_TurbSA(val_nDim, val_nVar, config), c5(3.5) { }
+                              CSourceBase_TurbSA(val_nDim, val_nVar, config) { }
 
 CNumerics::ResidualType<> CSourcePieceWise_TurbSA_COMP::ComputeResidual(const CConfig* config) {
 
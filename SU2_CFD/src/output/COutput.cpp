@@ -83,12 +83,25 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   historyFilename = config->GetMultizone_HistoryFileName(historyFilename, config->GetiZone(), hist_ext);
 
-  /*--- Append the restart iteration ---*/
+  /*--- Append the restart iteration, or for parallel-in-time simulations the
+   first time iteration of the slice integrated by this group of ranks. ---*/
 
-  if (config->GetTime_Domain() && config->GetRestart()) {
+  if (config->GetnTime_Parallel_Groups() > 1) {
+    const auto firstIter = config->GetRestart() ? config->GetRestart_Iter() : 0ul;
+    const auto nSliceIter = (config->GetnTime_Iter() - firstIter) / config->GetnTime_Parallel_Groups();
+    historyFilename = config->GetUnsteady_FileName(historyFilename,
+                        firstIter + config->GetiTime_Parallel_Group() * nSliceIter, hist_ext);
+  }
+  else if (config->GetTime_Domain() && config->GetRestart()) {
     historyFilename = config->GetUnsteady_FileName(historyFilename, config->GetRestart_Iter(), hist_ext);
   }
 
+  /*--- For harmonic balance with groups of ranks append the first time instance of the group. ---*/
+
+  if (config->GetnHB_Parallel_Groups() > 1) {
+    historyFilename = config->GetMultiInstance_FileName(historyFilename, config->GetFirst_TimeInstance(), hist_ext);
+  }
+
   historySep = ",";
 
   /*--- Initialize residual ---*/
@@ -2012,6 +2025,29 @@ void COutput::SetCommonHistoryFields(CConfig *config){
 
   AddHistoryOutput("NONPHYSICAL_POINTS", "Nonphysical_Points", ScreenOutputFormat::INTEGER, "NONPHYSICAL_POINTS", "The number of non-physical points in the solution");
 
+  if (config->GetDiscrete_Adjoint()) {
+    /// BEGIN_GROUP: TAPE_MEMORY, DESCRIPTION: Memory of the last recording (MB, sum over ranks).
+    /// DESCRIPTION: Memory of the whole tape.
+    AddHistoryOutput("TAPE_TOTAL",   "Tape[MB]",        ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the last recording (MB)");
+    /// DESCRIPTION: Memory of the whole tape on the rank with the largest tape.
+    AddHistoryOutput("TAPE_PEAK",    "Tape_Peak[MB]",   ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the largest rank (MB)");
+    /// DESCRIPTION: Memory of the convective residuals.
+    AddHistoryOutput("TAPE_CONV",    "Tape_Conv[MB]",   ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the convective residuals (MB)");
+    /// DESCRIPTION: Memory of the viscous residuals.
+    AddHistoryOutput("TAPE_VISC",    "Tape_Visc[MB]",   ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the viscous residuals (MB)");
+    /// DESCRIPTION: Memory of the source terms.
+    AddHistoryOutput("TAPE_SOURCE",  "Tape_Source[MB]", ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the source terms (MB)");
+    /// DESCRIPTION: Memory of the boundary conditions.
+    AddHistoryOutput("TAPE_BC",      "Tape_BC[MB]",     ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the boundary conditions (MB)");
+    /// DESCRIPTION: Memory of the gradients.
+    AddHistoryOutput("TAPE_GRAD",    "Tape_Grad[MB]",   ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the gradients (MB)");
+    /// DESCRIPTION: Memory of the limiters.
+    AddHistoryOutput("TAPE_LIMITER", "Tape_Lim[MB]",    ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the slope limiters (MB)");
+    /// DESCRIPTION: Memory of the mesh deformation.
+    AddHistoryOutput("TAPE_DEFORM",  "Tape_Deform[MB]", ScreenOutputFormat::FIXED, "TAPE_MEMORY", "Tape memory of the mesh deformation (MB)");
+    /// END_GROUP
+  }
+
 }
 
 void COutput::LoadCommonHistoryData(CConfig *config){
@@ -2037,6 +2073,18 @@ void COutput::LoadCommonHistoryData(CConfig *config){
   SetHistoryOutputValue("WALL_TIME", UsedTime);
 
   SetHistoryOutputValue("NONPHYSICAL_POINTS", config->GetNonphysical_Points());
+
+  if (config->GetDiscrete_Adjoint()) {
+    SetHistoryOutputValue("TAPE_TOTAL", config->GetTape_Memory());
+    SetHistoryOutputValue("TAPE_PEAK", config->GetTape_PeakMemory());
+    SetHistoryOutputValue("TAPE_CONV", config->GetTapeRegion_Memory(TAPE_REGION::CONVECTIVE));
+    SetHistoryOutputValue("TAPE_VISC", config->GetTapeRegion_Memory(TAPE_REGION::VISCOUS));
+    SetHistoryOutputValue("TAPE_SOURCE", config->GetTapeRegion_Memory(TAPE_REGION::SOURCE));
+    SetHistoryOutputValue("TAPE_BC", config->GetTapeRegion_Memory(TAPE_REGION::BOUNDARY));
+    SetHistoryOutputValue("TAPE_GRAD", config->GetTapeRegion_Memory(TAPE_REGION::GRADIENT));
+    SetHistoryOutputValue("TAPE_LIMITER", config->GetTapeRegion_Memory(TAPE_REGION::LIMITER));
+    SetHistoryOutputValue("TAPE_DEFORM", config->GetTapeRegion_Memory(TAPE_REGION::MESH_DEFORM));
+  }
 }
 
 
@@ -670,9 +670,10 @@ void COutputLegacy::SetConvHistory_Body(ofstream *ConvHist_file,
           break;
       }
 
-      /*--- Output a file with the forces breakdown. ---*/
+      /*--- Output a file with the forces breakdown (requires all the time instances on this rank). ---*/
 
-      if (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE) {
+      if ((config[val_iZone]->GetTime_Marching() == TIME_MARCHING::HARMONIC_BALANCE) &&
+          (config[val_iZone]->GetnHB_Parallel_Groups() == 1)) {
         SpecialOutput_HarmonicBalance(solver_container, geometry, config, val_iInst, nInst, output_files);
       }
 
@@ -1553,7 +1554,10 @@ void COutputLegacy::SetConvHistory_Body(ofstream *ConvHist_file,
 
         }
       }
-      if ((val_iZone == 0 && val_iInst == 0)|| fluid_structure){
+      /*--- Only the first time instance is written to screen, with harmonic balance groups
+       *    (HB_PARALLEL_GROUPS) this is the first local instance of the first group. ---*/
+      const bool firstInst = (config[val_iZone]->GetFirst_TimeInstance() + val_iInst == 0);
+      if ((val_iZone == 0 && firstInst)|| fluid_structure){
         /*--- Write the screen header---*/
         if (  (!fem && ((write_heads) && !(!DualTime_Iteration && Unsteady))) ||
             (fem && ((write_heads_FEM) && !(!DualTime_Iteration && nonlinear_analysis)))
@@ -1971,7 +1975,7 @@ void COutputLegacy::SetConvHistory_Body(ofstream *ConvHist_file,
 
       /*--- Write the solution on the screen ---*/
 
-      if ((val_iZone == 0 && val_iInst == 0)|| fluid_structure){
+      if ((val_iZone == 0 && firstInst)|| fluid_structure){
         cout.precision(6);
         cout.setf(ios::fixed, ios::floatfield);
         if (!fem) {
@@ -32,6 +32,7 @@
 #include "../../include/fluid/CIdealGas.hpp"
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
+#include "../../include/fluid/CTabulatedGas.hpp"
 #include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
 
@@ -360,6 +361,10 @@ void CEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_containe
     SU2_MPI::Error("The numerical scheme + gas model in use do not "
                    "support vectorization.", CURRENT_FUNCTION);
 
+  /*--- Vectorized convective fluxes for the BCs that use a ghost state, the
+   *    legacy boundary numerics are used if this is not supported. ---*/
+  boundaryNumerics = CBoundaryNumericsSIMD::CreateBoundaryNumerics(*config, nDim, MGLevel);
+
   }
   END_SU2_OMP_MASTER
   SU2_OMP_BARRIER
@@ -1055,6 +1060,7 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
 
   assert(FluidModel.empty() && "Potential memory leak!");
   FluidModel.resize(omp_get_max_threads());
+  shared_ptr<const CTabulatedGas::Table> fluidTable;
 
   SU2_OMP_PARALLEL
   {
@@ -1084,6 +1090,16 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
         break;
     }
 
+    /*--- The table is built once and shared by the models of all threads. ---*/
+    if (config->GetFluidTable()) {
+      SU2_OMP_MASTER
+      fluidTable = CTabulatedGas::MakeTable(*FluidModel[thread], *config, Pressure_FreeStreamND, Density_FreeStreamND);
+      END_SU2_OMP_MASTER
+      SU2_OMP_BARRIER
+
+      FluidModel[thread] = new CTabulatedGas(FluidModel[thread], fluidTable);
+    }
+
     GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
     if (viscous) {
       GetFluidModel()->SetLaminarViscosityModel(config);
@@ -1571,6 +1587,10 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
+    /*--- Gradient and limiter computed in one pass, if requested and supported. ---*/
+
+    if (limiter && SetPrimitive_Gradient_Limiter(geometry, config, true)) return;
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
     switch (config->GetKind_Gradient_Method_Recon()) {
@@ -1596,6 +1616,24 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   AD::StartNoSharedReading();
 
+  if (config->GetUseVectorization()) {
+
+    /*--- Batches of points with the array-based interface of the fluid model. ---*/
+
+    constexpr auto batchSize = CFluidModel::BATCH_SIZE;
+    CFluidModel::StateBatch batch;
+
+    SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint += batchSize) {
+      batch.size = min<unsigned long>(batchSize, nPoint - iPoint);
+      nonPhysicalPoints += nodes->SetPrimVar_Batch(iPoint, batch, GetFluidModel(), nullptr, nullptr);
+    }
+    END_SU2_OMP_FOR
+
+    AD::EndNoSharedReading();
+    return nonPhysicalPoints;
+  }
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
@@ -1719,6 +1757,14 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     auto iEdge = color.indices[k];
 
+    /*--- Multirate local time stepping or active set, skip the edges that are not active. ---*/
+
+    const su2double weight = EdgeWeight(geometry, iEdge);
+    if (weight == 0.0) {
+      if (ReducerStrategy) EdgeFluxes.SetBlock_Zero(iEdge);
+      continue;
+    }
+
     unsigned short iDim, iVar;
 
     /*--- Points in edge and normal vectors ---*/
@@ -1873,13 +1919,12 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- Update residual value ---*/
 
     if (ReducerStrategy) {
-      EdgeFluxes.SetBlock(iEdge, residual);
+      EdgeFluxes.SetBlock(iEdge, residual, weight);
       if (implicit)
         Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
     }
     else {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
+      LinSysRes.UpdateBlocks(iPoint, jPoint, residual, weight);
 
       /*--- Set implicit computation ---*/
       if (implicit)
@@ -4446,27 +4491,30 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
 
 
-      /*--- Set various quantities in the numerics class ---*/
+      /*--- Set various quantities in the numerics class, unless the
+       *    convective flux is computed in batches after this loop. ---*/
 
-      conv_numerics->SetPrimitive(V_domain, V_infty);
+      if (!boundaryNumerics) {
+        conv_numerics->SetPrimitive(V_domain, V_infty);
 
-      if (dynamic_grid) {
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
-                                  geometry->nodes->GetGridVel(iPoint));
-      }
+        if (dynamic_grid) {
+          conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint),
+                                    geometry->nodes->GetGridVel(iPoint));
+        }
 
-      /*--- Compute the convective residual using an upwind scheme ---*/
+        /*--- Compute the convective residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+        auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Update residual value ---*/
+        /*--- Update residual value ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.AddBlock(iPoint, residual);
 
-      /*--- Convective Jacobian contribution for implicit integration ---*/
+        /*--- Convective Jacobian contribution for implicit integration ---*/
 
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        if (implicit)
+          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+      }
 
       /*--- Viscous residual contribution ---*/
 
@@ -4513,6 +4561,10 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   }
   END_SU2_OMP_FOR
 
+  /*--- Convective flux with the ghost states computed above. ---*/
+
+  if (boundaryNumerics) BoundaryFluxResidual(geometry, config, val_marker);
+
   /*--- Free locally allocated memory ---*/
   delete [] Normal;
 
@@ -6673,25 +6725,28 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
           break;
       }
 
-      /*--- Set various quantities in the solver class ---*/
+      /*--- Set various quantities in the solver class, unless the
+       *    convective flux is computed in batches after this loop. ---*/
 
-      conv_numerics->SetPrimitive(V_domain, V_inlet);
+      if (!boundaryNumerics) {
+        conv_numerics->SetPrimitive(V_domain, V_inlet);
 
-      if (dynamic_grid)
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
+        if (dynamic_grid)
+          conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
 
-      /*--- Compute the residual using an upwind scheme ---*/
+        /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+        auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Update residual value ---*/
+        /*--- Update residual value ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
+        LinSysRes.AddBlock(iPoint, residual);
 
-      /*--- Jacobian contribution for implicit integration ---*/
+        /*--- Jacobian contribution for implicit integration ---*/
 
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        if (implicit)
+          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+      }
 
 //      /*--- Viscous contribution, commented out because serious convergence problems ---*/
 //
@@ -6737,6 +6792,10 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   }
   END_SU2_OMP_FOR
 
+  /*--- Convective flux with the ghost states computed above. ---*/
+
+  if (boundaryNumerics) BoundaryFluxResidual(geometry, config, val_marker);
+
   /*--- Free locally allocated memory ---*/
 
   delete [] Normal;
@@ -6851,21 +6910,24 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       }
 
-      /*--- Set various quantities in the solver class ---*/
-      conv_numerics->SetPrimitive(V_domain, V_outlet);
+      /*--- Set various quantities in the solver class, unless the
+       *    convective flux is computed in batches after this loop. ---*/
+      if (!boundaryNumerics) {
+        conv_numerics->SetPrimitive(V_domain, V_outlet);
 
-      if (dynamic_grid)
-        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
+        if (dynamic_grid)
+          conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
 
-      /*--- Compute the residual using an upwind scheme ---*/
+        /*--- Compute the residual using an upwind scheme ---*/
 
-      auto residual = conv_numerics->ComputeResidual(config);
+        auto residual = conv_numerics->ComputeResidual(config);
 
-      /*--- Add Residuals and Jacobians ---*/
+        /*--- Add Residuals and Jacobians ---*/
 
-      LinSysRes.AddBlock(iPoint, residual);
-      if (implicit)
-        Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+        LinSysRes.AddBlock(iPoint, residual);
+        if (implicit)
+          Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
+      }
 
 //      /*--- Viscous contribution, commented out because serious convergence problems  ---*/
 //
@@ -6911,6 +6973,10 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   }
   END_SU2_OMP_FOR
 
+  /*--- Convective flux with the ghost states computed above. ---*/
+
+  if (boundaryNumerics) BoundaryFluxResidual(geometry, config, val_marker);
+
   /*--- Free locally allocated memory ---*/
   delete [] Normal;
 
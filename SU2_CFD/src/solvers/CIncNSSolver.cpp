@@ -70,20 +70,36 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute gradient for MUSCL reconstruction ---*/
 
+  /*--- The limiters are computed in the same pass as the gradient used for
+   *    reconstruction, if this is requested and supported. ---*/
+
+  const bool computeLimiter = muscl && !center && limiter && !van_albada && !Output;
+  bool fusedLimiter = false, fusedPrimGradient = false;
+
   if (config->GetReconstructionGradientRequired() && muscl && !center) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+    fusedLimiter = computeLimiter && SetPrimitive_Gradient_Limiter(geometry, config, true);
+
+    if (!fusedLimiter) {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
     }
   }
+  else if (computeLimiter) {
+    fusedLimiter = fusedPrimGradient = SetPrimitive_Gradient_Limiter(geometry, config, false);
+  }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+  if (fusedPrimGradient) {
+    /*--- Already computed with the limiters. ---*/
+  }
+  else if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
     SetPrimitive_Gradient_GG(geometry, config);
   }
   else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
@@ -92,7 +108,7 @@ void CIncNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (computeLimiter && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
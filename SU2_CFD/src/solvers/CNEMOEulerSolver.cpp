@@ -32,6 +32,7 @@
 #include "../../include/fluid/CMutationTCLib.hpp"
 #include "../../include/fluid/CSU2TCLib.hpp"
 #include "../../include/limiters/CLimiterDetails.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
                            unsigned short iMesh, const bool navier_stokes) :
@@ -122,6 +123,16 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     specified reference values. ---*/
   SetNondimensionalization(config, iMesh);
 
+  /*--- Thread-private fluid models for the chemistry sub-step, since the fluid model stores
+   *    the thermodynamic state. Mutation++ is only used by the master thread. ---*/
+  if (config->GetChemistry_Splitting() && (iMesh == MESH_0) && (config->GetKind_FluidModel() == SU2_NONEQ)) {
+    for (int iThread = 0; iThread < omp_get_max_threads(); ++iThread)
+      ChemistryModels.emplace_back(new CSU2TCLib(config, nDim, config->GetViscous()));
+  }
+  if (config->GetChemistry_Splitting() && (iMesh == MESH_0)) {
+    ChemistrySource.resize(nPointDomain, nSpecies+1) = su2double(0.0);
+  }
+
   /// TODO: This type of variables will be replaced.
 
   AllocateTerribleLegacyTemporaryVariables();
@@ -130,6 +141,11 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   Allocate(*config);
 
+  /*--- MPI + OpenMP initialization, the edge coloring is only used by the vectorized
+   *    numerics (EdgeFluxResidual), the legacy NEMO loops are not hybrid parallel. ---*/
+
+  if (config->GetUseVectorization()) HybridParallelInitialization(*config, *geometry);
+
   /*--- Allocate Jacobians for implicit time-stepping ---*/
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
 
@@ -467,6 +483,11 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
 void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                        CConfig *config, unsigned short iMesh) {
 
+  if (config->GetUseVectorization()) {
+    EdgeFluxResidual(geometry, solver_container, config);
+    return;
+  }
+
   /*--- Set booleans based on config settings ---*/
   const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
   const bool muscl            = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
@@ -634,6 +655,22 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   }
 }
 
+void CNEMOEulerSolver::InstantiateEdgeNumerics(const CSolver* const* solver_container, const CConfig* config) {
+
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER {
+
+  edgeNumerics = CNumericsSIMD::CreateNEMONumerics(*config, nDim, MGLevel, FluidModel);
+
+  if (!edgeNumerics)
+    SU2_MPI::Error("The numerical scheme + gas model in use do not support vectorization,\n"
+                   "only AUSM and AUSM+UP2 with 1, 2, or 5 species and no ionization are supported.", CURRENT_FUNCTION);
+
+  }
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
 su2double CNEMOEulerSolver::ComputeConsistentExtrapolation(CNEMOGas *fluidmodel, unsigned short nSpecies, su2double *V,
                                                            su2double* dPdU, su2double* dTdU, su2double* dTvedU,
                                                            su2double* val_eves, su2double *val_Cvves) {
@@ -753,6 +790,9 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   bool axisymm    = config->GetAxisymmetric();
   bool viscous    = config->GetViscous();
   bool rans       = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
+  /*--- With operator splitting, the thermochemical sources are integrated by ChemistrySubstep,
+   *    the residual includes their last value (see ChemistrySubstep). ---*/
+  bool split      = config->GetChemistry_Splitting();
 
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
 
@@ -792,7 +832,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
     /*--- Compute finite rate chemistry ---*/
 
-    if(!monoatomic){
+    if(!monoatomic && !split){
       if(!frozen){
         /*--- Compute the non-equilibrium chemistry ---*/
         auto residual = numerics->ComputeChemistry(config);
@@ -813,7 +853,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
     /*--- Compute vibrational energy relaxation ---*/
     /// NOTE: Jacobians don't account for relaxation time derivatives
 
-    if (!monoatomic){
+    if (!monoatomic && !split){
       auto residual = numerics->ComputeVibRelaxation(config);
 
       /*--- Check for errors before applying source to the linear system ---*/
@@ -828,6 +868,13 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
         eVib_local++;
     }
 
+    if (split && !ChemistrySource.empty()) {
+      const su2double Volume = geometry->nodes->GetVolume(iPoint);
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+        LinSysRes(iPoint,iSpecies) -= ChemistrySource(iPoint,iSpecies) * Volume;
+      LinSysRes(iPoint,nSpecies+nDim+1) -= ChemistrySource(iPoint,nSpecies) * Volume;
+    }
+
     /*--- Compute axisymmetric source terms (if needed) ---*/
     if (axisymm) {
 
@@ -900,17 +947,23 @@ void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solve
                                             CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<RUNGE_KUTTA_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep+1 == config->GetnRKStep()) ChemistrySubstep(geometry, config);
 }
 
 void CNEMOEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                                               CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep == 3) ChemistrySubstep(geometry, config);
 }
 
 void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
+
+  ChemistrySubstep(geometry, config);
 }
 
 void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
@@ -926,6 +979,154 @@ void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**,
 void CNEMOEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
   CompleteImplicitIteration_impl<true>(geometry, config);
+
+  ChemistrySubstep(geometry, config);
+}
+
+void CNEMOEulerSolver::ChemistrySubstep(CGeometry *geometry, const CConfig *config) {
+
+  /*--- Operator-split integration of the finite-rate chemistry and vibrational relaxation
+   * sources, dY/dt = S(Y) with Y = (rhos, rhoEve), over the time step of each point. These
+   * sources do not change momentum and total energy. Each sub-step is linearly implicit
+   * (Rosenbrock-Euler), (I - h dS/dY) dY = h S(Y), which is stable for stiff rates. The
+   * Jacobian is approximated by finite differences of the batched thermochemistry functions
+   * of the fluid model, i.e. nSpecies+2 batched evaluations per sub-step.
+   * The splitting is balanced: the flow update includes the sources S0 at the end of the
+   * previous chemistry step (explicitly, see Source_Residual), and the sub-steps integrate
+   * S(Y)-S0. Therefore a steady state of the coupled equations is a fixed point of the split
+   * update regardless of the time step (i.e. of the CFL), and the residual includes the
+   * chemistry. The sub-steps use the time step of the point, which is why CConfig rejects
+   * dual time stepping. ---*/
+
+  if (!config->GetChemistry_Splitting() || config->GetMonoatomic() ||
+      geometry->GetMGLevel() != MESH_0) return;
+
+  const bool frozen = config->GetFrozen();
+  const bool limit_vt = config->GetVTTransferResidualLimiting();
+  const unsigned short nSubSteps = config->GetChemistry_SubSteps();
+  const unsigned short nY = nSpecies+1;
+  const unsigned short iRhoE = nSpecies+nDim, iRhoEve = nSpecies+nDim+1;
+
+  /*--- Relative size of the finite difference perturbations, it is large compared to machine
+   * precision since the temperatures are obtained iteratively (with finite tolerance). ---*/
+  const su2double fdStep = 1e-6;
+
+  constexpr size_t BATCH_SIZE = CNEMOGas::BATCH_SIZE;
+
+  /*--- The points are independent, use all threads if there are thread-private fluid models. ---*/
+
+  SU2_OMP_PARALLEL_ON(max<int>(1, ChemistryModels.size()))
+  {
+  CNEMOGas* fluidModel = ChemistryModels.empty()? FluidModel : ChemistryModels[omp_get_thread_num()].get();
+
+  CNEMOGas::ThermoChemBatch batch(nSpecies);
+  su2activematrix Y(BATCH_SIZE,nY), Yp(BATCH_SIZE,nY), S(BATCH_SIZE,nY), Sp(BATCH_SIZE,nY);
+  vector<su2activematrix> Jac(BATCH_SIZE, su2activematrix(nY,nY));
+  su2double rho[BATCH_SIZE], dt[BATCH_SIZE], vtLimit[BATCH_SIZE], delta[BATCH_SIZE];
+  su2double* rows[MAXNVAR];
+  su2double rhs[MAXNVAR];
+
+  /*--- Evaluate the sources for states Ys (one row per point of the batch). ---*/
+  auto EvaluateSources = [&](const su2activematrix& Ys, su2activematrix& Ss) {
+    for (size_t k = 0; k < batch.size; ++k) {
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies)
+        batch.rhos[iSpecies*BATCH_SIZE + k] = fmax(Ys(k,iSpecies), 1E-20);
+      batch.rhoEve[k] = Ys(k,nSpecies);
+    }
+    fluidModel->ComputeBatchTemperatures(batch);
+    if (!frozen) fluidModel->ComputeBatchNetProductionRates(batch);
+    fluidModel->ComputeBatchEveSourceTerm(batch);
+
+    for (size_t k = 0; k < batch.size; ++k) {
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies)
+        Ss(k,iSpecies) = batch.ws[iSpecies*BATCH_SIZE + k];
+      Ss(k,nSpecies) = batch.EveSource[k];
+      if (limit_vt) Ss(k,nSpecies) = fmax(-vtLimit[k], fmin(Ss(k,nSpecies), vtLimit[k]));
+    }
+  };
+
+  const unsigned long nBatch = (nPointDomain + BATCH_SIZE - 1) / BATCH_SIZE;
+
+  SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size, BATCH_SIZE))
+  for (unsigned long iBatch = 0; iBatch < nBatch; ++iBatch) {
+
+    const unsigned long iPointBegin = iBatch * BATCH_SIZE;
+    batch.size = min<unsigned long>(BATCH_SIZE, nPointDomain-iPointBegin);
+
+    /*--- Gather the state of the points, total and kinetic energy are fixed. ---*/
+    for (size_t k = 0; k < batch.size; ++k) {
+      const auto iPoint = iPointBegin + k;
+      const su2double* U = nodes->GetSolution(iPoint);
+
+      rho[k] = 0.0;
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies) {
+        Y(k,iSpecies) = U[iSpecies];
+        rho[k] += U[iSpecies];
+      }
+      Y(k,nSpecies) = U[iRhoEve];
+
+      batch.rhoE[k] = U[iRhoE];
+      batch.rhoEvel[k] = 0.5 * GeometryToolbox::SquaredNorm(nDim, &U[nSpecies]) / rho[k];
+
+      dt[k] = nodes->GetDelta_Time(iPoint) / nSubSteps;
+
+      /*--- Same limits as CSource_NEMO::ComputeVibRelaxation, which are applied to the residual. ---*/
+      vtLimit[k] = 1E6 / geometry->nodes->GetVolume(iPoint);
+    }
+
+    for (unsigned short iSubStep = 0; iSubStep < nSubSteps; ++iSubStep) {
+
+      EvaluateSources(Y, S);
+
+      /*--- Jacobian of the sources, one column (i.e. one batched evaluation) at a time. ---*/
+      for (unsigned short jVar = 0; jVar < nY; ++jVar) {
+        for (size_t k = 0; k < batch.size; ++k) {
+          for (unsigned short iVar = 0; iVar < nY; ++iVar) Yp(k,iVar) = Y(k,iVar);
+
+          const su2double ref = (jVar < nSpecies)? 1E-10 * rho[k] : 1E-3 * fabs(batch.rhoE[k]);
+          delta[k] = fdStep * fmax(fabs(Y(k,jVar)), ref);
+          Yp(k,jVar) += delta[k];
+        }
+        EvaluateSources(Yp, Sp);
+
+        for (size_t k = 0; k < batch.size; ++k)
+          for (unsigned short iVar = 0; iVar < nY; ++iVar)
+            Jac[k](iVar,jVar) = su2double(iVar == jVar) - dt[k] * (Sp(k,iVar) - S(k,iVar)) / delta[k];
+      }
+
+      /*--- Solve for the increment of each point and update the state. ---*/
+      for (size_t k = 0; k < batch.size; ++k) {
+        for (unsigned short iVar = 0; iVar < nY; ++iVar) {
+          rows[iVar] = Jac[k][iVar];
+          rhs[iVar] = dt[k] * (S(k,iVar) - ChemistrySource(iPointBegin+k, iVar));
+        }
+        Gauss_Elimination(rows, rhs, nY);
+
+        for (unsigned short iVar = 0; iVar < nY; ++iVar) Y(k,iVar) += rhs[iVar];
+        for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies)
+          Y(k,iSpecies) = fmax(Y(k,iSpecies), 0.0);
+      }
+    }
+
+    /*--- Scatter the new species densities and vib.-el. energy, and store the
+     *    sources of the new state for the next flow update. ---*/
+    EvaluateSources(Y, S);
+
+    for (size_t k = 0; k < batch.size; ++k) {
+      su2double* U = nodes->GetSolution(iPointBegin + k);
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies) U[iSpecies] = Y(k,iSpecies);
+      U[iRhoEve] = Y(k,nSpecies);
+      for (unsigned short iVar = 0; iVar < nY; ++iVar) ChemistrySource(iPointBegin+k, iVar) = S(k,iVar);
+    }
+  }
+  END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- MPI solution ---*/
+
+  InitiateComms(geometry, config, SOLUTION);
+  CompleteComms(geometry, config, SOLUTION);
 }
 
 void CNEMOEulerSolver::ComputeUnderRelaxationFactor(const CConfig *config) {
@@ -173,6 +173,9 @@ void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep) {
 
+  /*--- The vectorized upwind schemes include the viscous fluxes. ---*/
+  if (config->GetUseVectorization() && (config->GetKind_ConvNumScheme_Flow() == SPACE_UPWIND)) return;
+
   bool err;
   unsigned short iVar;
   unsigned long iPoint, jPoint, iEdge;
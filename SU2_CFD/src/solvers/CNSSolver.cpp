@@ -88,20 +88,36 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   const auto nPrimVarGrad_bak = nPrimVarGrad;
   if (Output) ompMasterAssignBarrier(nPrimVarGrad, 1+nDim);
 
+  /*--- The limiters are computed in the same pass as the gradient used for
+   *    reconstruction, if this is requested and supported. ---*/
+
+  const bool computeLimiter = muscl && !center && limiter && !van_albada && !Output;
+  bool fusedLimiter = false, fusedPrimGradient = false;
+
   if (config->GetReconstructionGradientRequired() && muscl && !center) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+    fusedLimiter = computeLimiter && SetPrimitive_Gradient_Limiter(geometry, config, true);
+
+    if (!fusedLimiter) {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
     }
   }
+  else if (computeLimiter) {
+    fusedLimiter = fusedPrimGradient = SetPrimitive_Gradient_Limiter(geometry, config, false);
+  }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+  if (fusedPrimGradient) {
+    /*--- Already computed with the limiters. ---*/
+  }
+  else if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
     SetPrimitive_Gradient_GG(geometry, config);
   }
   else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
@@ -112,7 +128,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (computeLimiter && !fusedLimiter) {
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -137,6 +153,37 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
 
   AD::StartNoSharedReading();
 
+  if (config->GetUseVectorization()) {
+
+    /*--- Batches of points with the array-based interface of the fluid model. ---*/
+
+    constexpr auto batchSize = CFluidModel::BATCH_SIZE;
+    CFluidModel::StateBatch batch;
+    su2double eddyVisc[batchSize] = {0.0}, turbKE[batchSize] = {0.0};
+
+    const bool turbulent = (turb_model != TURB_MODEL::NONE) && (solver_container[TURB_SOL] != nullptr);
+    const bool hybridRANSLES = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
+
+    SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+    for (unsigned long iPoint = 0; iPoint < nPoint; iPoint += batchSize) {
+      batch.size = min<unsigned long>(batchSize, nPoint - iPoint);
+
+      if (turbulent) {
+        const auto turbNodes = solver_container[TURB_SOL]->GetNodes();
+        for (auto k = 0ul; k < batch.size; ++k) {
+          eddyVisc[k] = turbNodes->GetmuT(iPoint+k);
+          if (tkeNeeded) turbKE[k] = turbNodes->GetSolution(iPoint+k,0);
+          if (hybridRANSLES) nodes->SetDES_LengthScale(iPoint+k, turbNodes->GetDES_LengthScale(iPoint+k));
+        }
+      }
+      nonPhysicalPoints += nodes->SetPrimVar_Batch(iPoint, batch, GetFluidModel(), eddyVisc, turbKE);
+    }
+    END_SU2_OMP_FOR
+
+    AD::EndNoSharedReading();
+    return nonPhysicalPoints;
+  }
+
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
@@ -1326,6 +1326,7 @@ void CSolver::GetCommCountAndType(const CConfig* config,
       break;
     case MAX_EIGENVALUE:
     case SENSOR:
+    case TIME_STEP:
       COUNT_PER_POINT  = 1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
@@ -1489,6 +1490,9 @@ void CSolver::InitiateComms(CGeometry *geometry,
           case SENSOR:
             bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
             break;
+          case TIME_STEP:
+            bufDSend[buf_offset] = base_nodes->GetDelta_Time(iPoint);
+            break;
           case SOLUTION_GRADIENT:
           case PRIMITIVE_GRADIENT:
           case SOLUTION_GRAD_REC:
@@ -1640,6 +1644,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
           case SENSOR:
             base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
             break;
+          case TIME_STEP:
+            base_nodes->SetDelta_Time(iPoint,bufDRecv[buf_offset]);
+            break;
           case SOLUTION_GRADIENT:
           case PRIMITIVE_GRADIENT:
           case SOLUTION_GRAD_REC:
@@ -1882,7 +1889,7 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
       CFL *= CFLFactor;
       solverFlow->GetNodes()->SetLocalCFL(iPoint, CFL);
-      if ((iMesh == MESH_0) && solverTurb) {
+      if (((iMesh == MESH_0) || config->GetMG_Turbulence()) && solverTurb) {
         solverTurb->GetNodes()->SetLocalCFL(iPoint, CFL);
       }
 
@@ -1925,6 +1932,33 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
 }
 
+void CSolver::ComputeTimeTruncationError(const CGeometry *geometry, const CConfig *config,
+                                         unsigned short order, su2double *truncError) const {
+
+  /*--- With an extrapolation (predictor) of the same order as the BDF scheme (corrector), the local
+   *    error is C_c/(C_p-C_c) times their difference, C_p = 1 and C_c = -1/2 (BDF1) or -2/9 (BDF2).
+   *    This is multiplied by the leading coefficient of the BDF time derivative (1 or 3/2). ---*/
+
+  const su2double factor = (order == 1)? 1.0/3.0 : 1.5*2.0/11.0;
+  const su2double dt = config->GetDelta_UnstTimeND();
+
+  vector<su2double> localError(nVar, 0.0);
+
+  for (unsigned long iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    const su2double scale = factor * geometry->nodes->GetVolume(iPoint) / dt;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double delta = base_nodes->GetSolution(iPoint,iVar) -
+                              base_nodes->GetSolution_time_extrapolation(iPoint,iVar,order);
+      localError[iVar] += pow(scale*delta, 2);
+    }
+  }
+
+  SU2_MPI::Allreduce(localError.data(), truncError, nVar, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    truncError[iVar] = sqrt(truncError[iVar] / geometry->GetGlobal_nPointDomain());
+}
+
 void CSolver::SetResidual_RMS(const CGeometry *geometry, const CConfig *config) {
 
   if (geometry->GetMGLevel() != MESH_0) return;
@@ -57,10 +57,11 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   /*--- Define geometry constants in the solver structure ---*/
 
   nDim = geometry->GetnDim();
+  MGLevel = iMesh;
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or the coarse levels if the turbulence is part of the multigrid cycle ---*/
 
-  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE) {
+  if (iMesh == MESH_0 || config->GetMGCycle() == FULLMG_CYCLE || config->GetMG_Turbulence()) {
 
     /*--- Define some auxiliar vector related with the residual ---*/
 
@@ -190,7 +191,7 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
         unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0 || !config->GetMG_Turbulence());
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
   const auto kind_hybridRANSLES = config->GetKind_HybridRANSLES();
@@ -317,89 +318,96 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
   /*--- Pick one numerics object per thread. ---*/
   auto* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  AD::StartNoSharedReading();
+  /*--- The vectorized sources replace the point loop below, if the options in use are supported. ---*/
 
-  /*--- Loop over all points. ---*/
+  if (!config->GetUseVectorization() || !PointSourceResidual(geometry, solver_container, config)) {
 
-  SU2_OMP_FOR_DYN(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    AD::StartNoSharedReading();
 
-    /*--- Conservative variables w/o reconstruction ---*/
+    /*--- Loop over all points. ---*/
 
-    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
+    SU2_OMP_FOR_DYN(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    /*--- Gradient of the primitive and conservative variables ---*/
+      /*--- Conservative variables w/o reconstruction ---*/
 
-    numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
+      numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), nullptr);
 
-    /*--- Set vorticity and strain rate magnitude ---*/
+      /*--- Gradient of the primitive and conservative variables ---*/
 
-    numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
+      numerics->SetPrimVarGradient(flowNodes->GetGradient_Primitive(iPoint), nullptr);
 
-    numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
+      /*--- Set vorticity and strain rate magnitude ---*/
 
-    /*--- Set intermittency ---*/
+      numerics->SetVorticity(flowNodes->GetVorticity(iPoint), nullptr);
 
-    if (transition) {
-      numerics->SetIntermittency(solver_container[TRANS_SOL]->GetNodes()->GetIntermittency(iPoint));
-    }
+      numerics->SetStrainMag(flowNodes->GetStrainMag(iPoint), 0.0);
 
-    /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
+      /*--- Set intermittency ---*/
 
-    numerics->SetScalarVar(nodes->GetSolution(iPoint), nullptr);
-    numerics->SetScalarVarGradient(nodes->GetGradient(iPoint), nullptr);
+      if (transition) {
+        numerics->SetIntermittency(solver_container[TRANS_SOL]->GetNodes()->GetIntermittency(iPoint));
+      }
 
-    /*--- Set volume ---*/
+      /*--- Turbulent variables w/o reconstruction, and its gradient ---*/
 
-    numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+      numerics->SetScalarVar(nodes->GetSolution(iPoint), nullptr);
+      numerics->SetScalarVarGradient(nodes->GetGradient(iPoint), nullptr);
 
-    /*--- Get Hybrid RANS/LES Type and set the appropriate wall distance ---*/
+      /*--- Set volume ---*/
 
-    if (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) {
+      numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
 
-    /*--- For the SA model, wall roughness is accounted by modifying the computed wall distance
-       *                              d_new = d + 0.03 k_s
-       *    where k_s is the equivalent sand grain roughness height that is specified in cfg file.
-       *    For smooth walls, wall roughness is zero and computed wall distance remains the same. */
+      /*--- Get Hybrid RANS/LES Type and set the appropriate wall distance ---*/
 
-      su2double modifiedWallDistance = geometry->nodes->GetWall_Distance(iPoint);
+      if (config->GetKind_HybridRANSLES() == NO_HYBRIDRANSLES) {
 
-      modifiedWallDistance += 0.03*geometry->nodes->GetRoughnessHeight(iPoint);
+      /*--- For the SA model, wall roughness is accounted by modifying the computed wall distance
+         *                              d_new = d + 0.03 k_s
+         *    where k_s is the equivalent sand grain roughness height that is specified in cfg file.
+         *    For smooth walls, wall roughness is zero and computed wall distance remains the same. */
 
-      /*--- Set distance to the surface ---*/
+        su2double modifiedWallDistance = geometry->nodes->GetWall_Distance(iPoint);
 
-      numerics->SetDistance(modifiedWallDistance, 0.0);
+        modifiedWallDistance += 0.03*geometry->nodes->GetRoughnessHeight(iPoint);
 
-      /*--- Set the roughness of the closest wall. ---*/
+        /*--- Set distance to the surface ---*/
 
-      numerics->SetRoughness(geometry->nodes->GetRoughnessHeight(iPoint), 0.0 );
+        numerics->SetDistance(modifiedWallDistance, 0.0);
 
-    } else {
+        /*--- Set the roughness of the closest wall. ---*/
 
-      /*--- Set DES length scale ---*/
+        numerics->SetRoughness(geometry->nodes->GetRoughnessHeight(iPoint), 0.0 );
 
-      numerics->SetDistance(nodes->GetDES_LengthScale(iPoint), 0.0);
+      } else {
 
-    }
+        /*--- Set DES length scale ---*/
 
-    /*--- Compute the source term ---*/
+        numerics->SetDistance(nodes->GetDES_LengthScale(iPoint), 0.0);
 
-    auto residual = numerics->ComputeResidual(config);
+      }
 
-    /*--- Store the intermittency ---*/
+      /*--- Compute the source term ---*/
 
-    if (transition_BC) {
-      nodes->SetGammaBC(iPoint,numerics->GetGammaBC());
-    }
+      auto residual = numerics->ComputeResidual(config);
 
-    /*--- Subtract residual and the Jacobian ---*/
+      /*--- Store the intermittency ---*/
 
-    LinSysRes.SubtractBlock(iPoint, residual);
+      if (transition_BC) {
+        nodes->SetGammaBC(iPoint,numerics->GetGammaBC());
+      }
+
+      /*--- Subtract residual and the Jacobian ---*/
+
+      LinSysRes.SubtractBlock(iPoint, residual);
 
-    if (implicit) Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
+      if (implicit) Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
 
+    }
+    END_SU2_OMP_FOR
+
+    AD::EndNoSharedReading();
   }
-  END_SU2_OMP_FOR
 
   if (harmonic_balance) {
 
@@ -418,8 +426,6 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
     END_SU2_OMP_FOR
   }
 
-  AD::EndNoSharedReading();
-
 }
 
 void CTurbSASolver::Source_Template(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
@@ -57,10 +57,11 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
   /*--- Define geometry constants in the solver structure ---*/
 
   nDim = geometry->GetnDim();
+  MGLevel = iMesh;
 
-  /*--- Single grid simulation ---*/
+  /*--- Single grid simulation, or the coarse levels if the turbulence is part of the multigrid cycle ---*/
 
-  if (iMesh == MESH_0) {
+  if (iMesh == MESH_0 || config->GetMG_Turbulence()) {
 
     /*--- Define some auxiliary vector related with the residual ---*/
 
@@ -193,7 +194,7 @@ void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contain
          unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
-  const bool muscl = config->GetMUSCL_Turb();
+  const bool muscl = config->GetMUSCL_Turb() && (iMesh == MESH_0 || !config->GetMG_Turbulence());
   const bool limiter = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER) &&
                        (config->GetInnerIter() <= config->GetLimiterIter());
 
@@ -292,6 +293,10 @@ void CTurbSSTSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry,
 void CTurbSSTSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                      CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
+  /*--- Vectorized sources, if the options in use are supported. ---*/
+
+  if (config->GetUseVectorization() && PointSourceResidual(geometry, solver_container, config)) return;
+
   bool axisymmetric = config->GetAxisymmetric();
 
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -121,6 +121,66 @@ bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
   return RightVol;
 }
 
+unsigned long CEulerVariable::SetPrimVar_Batch(unsigned long iPointBegin, CFluidModel::StateBatch& batch,
+                                               CFluidModel *FluidModel, const su2double* eddyVisc,
+                                               const su2double* turbKE) {
+  for (size_t k = 0; k < batch.size; ++k) {
+    const auto iPoint = iPointBegin + k;
+    SetVelocity(iPoint);
+    batch.Density[k] = GetDensity(iPoint);
+    batch.StaticEnergy[k] = GetEnergy(iPoint) - 0.5*Velocity2(iPoint) - (turbKE? turbKE[k] : 0.0);
+  }
+
+  FluidModel->ComputeStates_rhoe(batch);
+
+  unsigned long nonPhysical = 0;
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    const auto iPoint = iPointBegin + k;
+
+    bool check_dens  = SetDensity(iPoint);
+    bool check_press = SetPressure(iPoint, batch.Pressure[k]);
+    bool check_sos   = SetSoundSpeed(iPoint, batch.SoundSpeed2[k]);
+    bool check_temp  = SetTemperature(iPoint, batch.Temperature[k]);
+
+    /*--- Non-physical states are recomputed from the old solution with the scalar
+     *    interface, the batch is updated as it is used for the transport properties. ---*/
+
+    if (check_dens || check_press || check_sos || check_temp) {
+
+      for (unsigned long iVar = 0; iVar < nVar; iVar++)
+        Solution(iPoint, iVar) = Solution_Old(iPoint, iVar);
+
+      SetVelocity(iPoint);
+      su2double density = GetDensity(iPoint);
+      su2double staticEnergy = GetEnergy(iPoint)-0.5*Velocity2(iPoint) - (turbKE? turbKE[k] : 0.0);
+      FluidModel->SetTDState_rhoe(density, staticEnergy);
+
+      SetDensity(iPoint);
+      SetPressure(iPoint, FluidModel->GetPressure());
+      SetSoundSpeed(iPoint, FluidModel->GetSoundSpeed2());
+      SetTemperature(iPoint, FluidModel->GetTemperature());
+
+      batch.Density[k] = density;
+      batch.Temperature[k] = FluidModel->GetTemperature();
+      batch.Cp[k] = FluidModel->GetCp();
+      batch.dPdrho_e[k] = FluidModel->GetdPdrho_e();
+      batch.dPde_rho[k] = FluidModel->GetdPde_rho();
+      batch.dTdrho_e[k] = FluidModel->GetdTdrho_e();
+      batch.dTde_rho[k] = FluidModel->GetdTde_rho();
+
+      nonPhysical++;
+    }
+
+    SetEnthalpy(iPoint);
+
+    SetdPdrho_e(iPoint, batch.dPdrho_e[k]);
+    SetdPde_rho(iPoint, batch.dPde_rho[k]);
+  }
+
+  return nonPhysical;
+}
+
 void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
@@ -34,9 +34,13 @@ CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned
   nPrimVar = nprimvar;
   nPrimVarGrad = nprimvargrad;
 
-  /*--- Allocate residual structures for multigrid. ---*/
+  /*--- Allocate residual structures for multigrid (without coarse levels the truncation error is 0). ---*/
 
-  Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
+  const bool skipUnused = config->GetSkip_Unused_Fields();
+
+  if (!skipUnused || config->GetnMGLevels() > 0) {
+    Res_TruncError.resize(nPoint, nVar) = su2double(0.0);
+  }
 
   for (unsigned long iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
     if (config->GetMG_CorrecSmooth(iMesh) > 0) {
@@ -72,8 +76,12 @@ CFlowVariable::CFlowVariable(unsigned long npoint, unsigned long ndim, unsigned
 
   if (config->GetKind_SlopeLimit_Flow() != NO_LIMITER && config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE) {
     Limiter_Primitive.resize(nPoint, nPrimVarGrad) = su2double(0.0);
-    Solution_Max.resize(nPoint, nPrimVarGrad) = su2double(0.0);
-    Solution_Min.resize(nPoint, nPrimVarGrad) = su2double(0.0);
+
+    /*--- Min/max are only stored for periodic communications. ---*/
+    if (!skipUnused || config->GetnMarker_Periodic() > 0) {
+      Solution_Max.resize(nPoint, nPrimVarGrad) = su2double(0.0);
+      Solution_Min.resize(nPoint, nPrimVarGrad) = su2double(0.0);
+    }
   }
 
   Velocity2.resize(nPoint) = su2double(0.0);
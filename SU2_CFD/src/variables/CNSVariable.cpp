@@ -201,6 +201,33 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
   return RightVol;
 }
 
+unsigned long CNSVariable::SetPrimVar_Batch(unsigned long iPointBegin, CFluidModel::StateBatch& batch,
+                                            CFluidModel *FluidModel, const su2double* eddyVisc,
+                                            const su2double* turbKE) {
+
+  const auto nonPhysical = CEulerVariable::SetPrimVar_Batch(iPointBegin, batch, FluidModel, eddyVisc, turbKE);
+
+  FluidModel->ComputeTransport(batch);
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    const auto iPoint = iPointBegin + k;
+
+    SetLaminarViscosity(iPoint, batch.LaminarViscosity[k]);
+    SetEddyViscosity(iPoint, eddyVisc? eddyVisc[k] : 0.0);
+    SetThermalConductivity(iPoint, batch.Conductivity[k]);
+    SetSpecificHeatCp(iPoint, batch.Cp[k]);
+
+    SetdTdrho_e(iPoint, batch.dTdrho_e[k]);
+    SetdTde_rho(iPoint, batch.dTde_rho[k]);
+    Setdmudrho_T(iPoint, batch.dmudrho_T[k]);
+    SetdmudT_rho(iPoint, batch.dmudT_rho[k]);
+    Setdktdrho_T(iPoint, batch.dktdrho_T[k]);
+    SetdktdT_rho(iPoint, batch.dktdT_rho[k]);
+  }
+
+  return nonPhysical;
+}
+
 void CNSVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
     /*--- Compute secondary thermodynamic properties (partial derivatives...) ---*/
@@ -46,8 +46,12 @@ CScalarVariable::CScalarVariable(unsigned long npoint, unsigned long ndim, unsig
    variables (check the logic - JST with 2nd order Turb model) ---*/
 
   Limiter.resize(nPoint, nVar) = su2double(0.0);
-  Solution_Max.resize(nPoint, nVar) = su2double(0.0);
-  Solution_Min.resize(nPoint, nVar) = su2double(0.0);
+
+  /*--- Min/max are only stored for periodic communications. ---*/
+  if (!config->GetSkip_Unused_Fields() || config->GetnMarker_Periodic() > 0) {
+    Solution_Max.resize(nPoint, nVar) = su2double(0.0);
+    Solution_Min.resize(nPoint, nVar) = su2double(0.0);
+  }
 
   Delta_Time.resize(nPoint) = su2double(0.0);
 
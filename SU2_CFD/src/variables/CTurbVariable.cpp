@@ -30,4 +30,19 @@
 
 
 CTurbVariable::CTurbVariable(unsigned long npoint, unsigned long ndim, unsigned long nvar, CConfig *config)
-  : CScalarVariable(npoint, ndim, nvar, config) { }
+  : CScalarVariable(npoint, ndim, nvar, config) {
+
+  /*--- Allocate residual structures for multigrid, if the turbulence equations are part of the cycle. ---*/
+
+  if (config->GetMG_Turbulence()) {
+    Res_TruncError.resize(nPoint,nVar) = su2double(0.0);
+
+    for (unsigned long iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+      if (config->GetMG_CorrecSmooth(iMesh) > 0) {
+        Residual_Sum.resize(nPoint,nVar);
+        Residual_Old.resize(nPoint,nVar);
+        break;
+      }
+    }
+  }
+}
@@ -64,6 +64,9 @@ CVariable::CVariable(unsigned long npoint, unsigned long ndim, unsigned long nva
   if (config->GetTime_Marching() != TIME_MARCHING::STEADY)
     Solution_time_n1.resize(nPoint,nVar) = su2double(0.0);
 
+  if (config->GetTime_Extrapolation_Order() > 1)
+    Solution_time_n2.resize(nPoint,nVar) = su2double(0.0);
+
   if (config->GetDiscrete_Adjoint()) {
     if (adjoint && config->GetMultizone_Problem())
       External.resize(nPoint,nVar) = su2double(0.0);
@@ -95,9 +98,30 @@ void CVariable::Set_Solution_time_n() {
 
 void CVariable::Set_Solution_time_n1() {
   assert(Solution_time_n1.size() == Solution_time_n.size());
+  if (!Solution_time_n2.empty())
+    parallelCopy(Solution_time_n1.size(), Solution_time_n1.data(), Solution_time_n2.data());
   parallelCopy(Solution_time_n.size(), Solution_time_n.data(), Solution_time_n1.data());
 }
 
+void CVariable::ExtrapolateSolution_time(unsigned short order, const vector<unsigned short>& positiveVars) {
+  assert(order < 2 || Solution_time_n2.size() == Solution.size());
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint,omp_get_num_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+    /*--- The extrapolation is only a guess, it is not worth risking non-physical states. ---*/
+    bool signChange = false;
+    for (auto iVar : positiveVars) {
+      signChange |= (GetSolution_time_extrapolation(iPoint,iVar,order) * Solution_time_n(iPoint,iVar) < 0.0);
+    }
+    if (signChange) continue;
+
+    for (unsigned long iVar = 0; iVar < nVar; ++iVar)
+      Solution(iPoint,iVar) = GetSolution_time_extrapolation(iPoint,iVar,order);
+  }
+  END_SU2_OMP_FOR
+}
+
 void CVariable::Set_BGSSolution_k() {
   assert(Solution_BGS_k.size() == Solution.size());
   parallelCopy(Solution.size(), Solution.data(), Solution_BGS_k.data());
@@ -832,6 +832,18 @@ def main():
     harmonic_balance.new_output = False
     test_list.append(harmonic_balance)
 
+    # Same case, one time instance per group of ranks (HB_PARALLEL_GROUPS)
+    harmonic_balance_groups           = TestCase('harmonic_balance_groups')
+    harmonic_balance_groups.cfg_dir   = "harmonic_balance"
+    harmonic_balance_groups.cfg_file  = "HB_groups.cfg"
+    harmonic_balance_groups.test_iter = 25
+    harmonic_balance_groups.test_vals = [-1.589739, 3.922579, 0.006702, 0.099632]
+    harmonic_balance_groups.su2_exec  = "mpirun -n 3 SU2_CFD"
+    harmonic_balance_groups.timeout   = 1600
+    harmonic_balance_groups.tol       = 0.00001
+    harmonic_balance_groups.new_output = False
+    test_list.append(harmonic_balance_groups)
+
     # Turbulent pitching NACA 64a010 airfoil
     hb_rans_preconditioning           = TestCase('hb_rans_preconditioning')
     hb_rans_preconditioning.cfg_dir   = "harmonic_balance/hb_rans_preconditioning"
@@ -957,6 +969,19 @@ def main():
     flatplate_unsteady.unsteady  = True
     test_list.append(flatplate_unsteady)
 
+    # Time-parallel (parareal) NACA0012, two time slabs
+    unst_parareal_naca0012            = TestCase('unst_parareal_naca0012')
+    unst_parareal_naca0012.cfg_dir    = "unsteady/naca0012_parareal"
+    unst_parareal_naca0012.cfg_file   = "inv_NACA0012_parareal.cfg"
+    unst_parareal_naca0012.test_iter  = 7
+    unst_parareal_naca0012.test_vals  = [-4.408683, -3.944526, 0.323165, 0.020914]
+    unst_parareal_naca0012.su2_exec   = "mpirun -n 2 SU2_CFD"
+    unst_parareal_naca0012.timeout    = 1600
+    unst_parareal_naca0012.tol        = 0.00001
+    unst_parareal_naca0012.unsteady   = True
+    unst_parareal_naca0012.new_output = True
+    test_list.append(unst_parareal_naca0012)
+
     ######################################
     ### NICFD                          ###
     ######################################
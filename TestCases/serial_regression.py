@@ -124,6 +124,30 @@ def main():
     naca0012.tol       = 0.00001
     test_list.append(naca0012)
 
+    # NACA0012, Newton-Krylov with Eisenstat-Walker tolerance, line search, and contraction based switch
+    naca0012_nk_ew           = TestCase('naca0012_nk_ew')
+    naca0012_nk_ew.cfg_dir   = "euler/naca0012"
+    naca0012_nk_ew.cfg_file  = "inv_NACA0012_nk_ew.cfg"
+    naca0012_nk_ew.test_iter = 40
+    naca0012_nk_ew.test_vals = [-4.044994, -3.684274, 0.073377, -0.053065]
+    naca0012_nk_ew.su2_exec  = "SU2_CFD"
+    naca0012_nk_ew.timeout   = 1600
+    naca0012_nk_ew.new_output= True
+    naca0012_nk_ew.tol       = 0.00001
+    test_list.append(naca0012_nk_ew)
+
+    # NACA0012, active set mode
+    naca0012_active_set           = TestCase('naca0012_active_set')
+    naca0012_active_set.cfg_dir   = "euler/naca0012"
+    naca0012_active_set.cfg_file  = "inv_NACA0012_active_set.cfg"
+    naca0012_active_set.test_iter = 20
+    naca0012_active_set.test_vals = [-3.829906, -3.271603, 0.288568, 0.015252]
+    naca0012_active_set.su2_exec  = "SU2_CFD"
+    naca0012_active_set.timeout   = 1600
+    naca0012_active_set.new_output= True
+    naca0012_active_set.tol       = 0.00001
+    test_list.append(naca0012_active_set)
+
     # Supersonic wedge
     wedge           = TestCase('wedge')
     wedge.cfg_dir   = "euler/wedge"
@@ -316,6 +340,18 @@ def main():
     turb_flatplate.tol       = 0.00001
     test_list.append(turb_flatplate)
 
+    # Flat plate, SA in the multigrid cycle
+    turb_flatplate_mg_turb            = TestCase('turb_flatplate_mg_turb')
+    turb_flatplate_mg_turb.cfg_dir    = "rans/flatplate"
+    turb_flatplate_mg_turb.cfg_file   = "turb_SA_flatplate_mg_turbulence.cfg"
+    turb_flatplate_mg_turb.test_iter  = 20
+    turb_flatplate_mg_turb.test_vals  = [-6.004381, -4.056786, -0.117965, 0.001246] #last 4 columns
+    turb_flatplate_mg_turb.su2_exec   = "SU2_CFD"
+    turb_flatplate_mg_turb.new_output = True
+    turb_flatplate_mg_turb.timeout    = 1600
+    turb_flatplate_mg_turb.tol        = 0.00001
+    test_list.append(turb_flatplate_mg_turb)
+
     # FLAT PLATE, WALL FUNCTIONS, COMPRESSIBLE SST
     turb_wallfunction_flatplate_sst           = TestCase('turb_sst_wallfunction_flatplate')
     turb_wallfunction_flatplate_sst.cfg_dir   = "wallfunctions/flatplate/compressible_SST"
@@ -1028,6 +1064,19 @@ def main():
     sine_gust.new_output = True
     test_list.append(sine_gust)
 
+    # Extrapolated initial guess and truncation error based stop of the inner iterations
+    unst_extrapolation_naca0012           = TestCase('unst_extrapolation_naca0012')
+    unst_extrapolation_naca0012.cfg_dir   = "unsteady/naca0012_extrapolation"
+    unst_extrapolation_naca0012.cfg_file  = "inv_NACA0012_extrapolation.cfg"
+    unst_extrapolation_naca0012.test_iter = 7
+    unst_extrapolation_naca0012.test_vals = [-5.682547, -5.159808, 0.175179, 0.000281]
+    unst_extrapolation_naca0012.su2_exec  = "SU2_CFD"
+    unst_extrapolation_naca0012.timeout   = 1600
+    unst_extrapolation_naca0012.tol       = 0.00001
+    unst_extrapolation_naca0012.unsteady  = True
+    unst_extrapolation_naca0012.new_output = True
+    test_list.append(unst_extrapolation_naca0012)
+
     # Aeroelastic
     aeroelastic         = TestCase('aeroelastic')
     aeroelastic.cfg_dir   = "aeroelastic"
@@ -1078,6 +1127,19 @@ def main():
     unst_deforming_naca0012.unsteady  = True
     test_list.append(unst_deforming_naca0012)
 
+    # Multirate local time stepping, NACA0012, Euler
+    unst_lts_naca0012           = TestCase('unst_lts_naca0012')
+    unst_lts_naca0012.cfg_dir   = "unsteady/naca0012_lts"
+    unst_lts_naca0012.cfg_file  = "inv_NACA0012_lts.cfg"
+    unst_lts_naca0012.test_iter = 10
+    unst_lts_naca0012.test_vals = [-3.097270, -2.501556, 0.020313, 0.089496] #last 4 columns
+    unst_lts_naca0012.su2_exec  = "SU2_CFD"
+    unst_lts_naca0012.timeout   = 1600
+    unst_lts_naca0012.tol       = 0.00001
+    unst_lts_naca0012.unsteady  = True
+    unst_lts_naca0012.new_output = True
+    test_list.append(unst_lts_naca0012)
+
     ######################################
     ### NICFD                          ###
     ######################################
@@ -0,0 +1,78 @@
+/*!
+ * \file BoxTestCase.hpp
+ * \brief Box mesh with a solver container, to be used in unit tests of the solvers.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <sstream>
+#include "../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../SU2_CFD/include/solvers/CSolverFactory.hpp"
+#include "../SU2_CFD/include/solvers/CSolver.hpp"
+
+/*!
+ * \brief Config, box geometry, and flow solver for one setup, the output is silenced.
+ */
+struct BoxTestCase {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+  CSolver** solver = nullptr;
+
+  BoxTestCase(const string& options, ENUM_MAIN_SOLVER kindSolver) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+
+    stringstream ss(options);
+    config = std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+    config->SetGlobalParam(kindSolver, RUNTIME_FLOW_SYS);
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config.get(), 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config.get()));
+    }
+    geometry->SetSendReceive(config.get());
+    geometry->SetBoundaries(config.get());
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config.get());
+    geometry->Check_BoundElem_Orientation(config.get());
+    geometry->SetEdges();
+    geometry->SetVertex(config.get());
+    geometry->SetControlVolume(config.get(), ALLOCATE);
+    geometry->SetBoundControlVolume(config.get(), ALLOCATE);
+    geometry->FindNormal_Neighbor(config.get());
+    geometry->SetGlobal_to_Local_Point();
+    geometry->PreprocessP2PComms(geometry.get(), config.get());
+
+    solver = CSolverFactory::CreateSolverContainer(kindSolver, config.get(), geometry.get(), MESH_0);
+
+    cout.rdbuf(origBuf);
+  }
+
+  ~BoxTestCase() {
+    for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) delete solver[iSol];
+    delete[] solver;
+  }
+};
@@ -0,0 +1,216 @@
+/*!
+ * \file CFluidModel_tests.cpp
+ * \brief Unit tests for the batched interface of the fluid models.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/fluid/CIdealGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CVanDerWaalsGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CSutherland.hpp"
+#include "../../../SU2_CFD/include/fluid/CTabulatedGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CSU2TCLib.hpp"
+#include <cstdio>
+
+/*--- Compare the batched (rho, e) interface with the scalar one. ---*/
+void checkStates_rhoe(CFluidModel& fluid) {
+  CFluidModel::StateBatch batch;
+  for (size_t i = 0; i < CFluidModel::BATCH_SIZE; ++i) {
+    batch.Density[i] = 0.5 + 0.1 * i;
+    batch.StaticEnergy[i] = 2.0 + 0.3 * i;
+  }
+  fluid.ComputeStates_rhoe(batch);
+
+  for (size_t i = 0; i < CFluidModel::BATCH_SIZE; ++i) {
+    fluid.SetTDState_rhoe(batch.Density[i], batch.StaticEnergy[i]);
+    CHECK(batch.Pressure[i] == Approx(fluid.GetPressure()));
+    CHECK(batch.Temperature[i] == Approx(fluid.GetTemperature()));
+    CHECK(batch.SoundSpeed2[i] == Approx(fluid.GetSoundSpeed2()));
+    CHECK(batch.Cp[i] == Approx(fluid.GetCp()));
+    CHECK(batch.dPdrho_e[i] == Approx(fluid.GetdPdrho_e()));
+    CHECK(batch.dPde_rho[i] == Approx(fluid.GetdPde_rho()));
+    CHECK(batch.dTdrho_e[i] == Approx(fluid.GetdTdrho_e()));
+    CHECK(batch.dTde_rho[i] == Approx(fluid.GetdTde_rho()));
+  }
+}
+
+TEST_CASE("Batched ideal gas", "[Fluid models]") {
+  CIdealGas fluid(1.4, 287.058);
+  checkStates_rhoe(fluid);
+
+  CFluidModel::StateBatch batch;
+  for (size_t i = 0; i < CFluidModel::BATCH_SIZE; ++i) {
+    batch.Pressure[i] = 1e5 + 1e3 * i;
+    batch.Temperature[i] = 250.0 + 5.0 * i;
+  }
+  fluid.ComputeStates_PT(batch);
+
+  for (size_t i = 0; i < CFluidModel::BATCH_SIZE; ++i) {
+    fluid.SetTDState_PT(1e5 + 1e3 * i, 250.0 + 5.0 * i);
+    CHECK(batch.Density[i] == Approx(fluid.GetDensity()));
+    CHECK(batch.StaticEnergy[i] == Approx(fluid.GetStaticEnergy()));
+  }
+}
+
+TEST_CASE("Batched Van der Waals gas", "[Fluid models]") {
+  CVanDerWaalsGas fluid(1.1, 0.2, 2.0, 1.5);
+  checkStates_rhoe(fluid);
+}
+
+TEST_CASE("Tabulated Van der Waals gas", "[Fluid models]") {
+  std::stringstream config_options;
+  config_options << "SOLVER= EULER" << std::endl;
+  config_options << "FLUID_MODEL= VW_GAS" << std::endl;
+  config_options << "CONV_NUM_METHOD_FLOW= ROE" << std::endl;
+  config_options << "FLUID_TABLE= YES" << std::endl;
+  config_options << "FLUID_TABLE_SIZE= (201, 201)" << std::endl;
+  config_options << "FLUID_TABLE_LIMITS= (0.5, 2.0, 0.5, 2.0)" << std::endl;
+  config_options << "FLUID_TABLE_FILENAME= fluid_table_test.bin" << std::endl;
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+
+  CVanDerWaalsGas reference(1.1, 0.2, 2.0, 1.5);
+  vector<passivedouble> built;
+  {
+    auto table = CTabulatedGas::MakeTable(reference, config, 1.0, 2.0);
+    built = table->data;
+
+    /*--- While the table is in use it is shared (e.g. by the solvers of coarse grids). ---*/
+    CHECK(CTabulatedGas::MakeTable(reference, config, 1.0, 2.0) == table);
+  }
+
+  /*--- Reading the table back gives the same data. ---*/
+  auto table = CTabulatedGas::MakeTable(reference, config, 1.0, 2.0);
+  CHECK(table->data == built);
+  CTabulatedGas fluid(new CVanDerWaalsGas(1.1, 0.2, 2.0, 1.5), table);
+
+  /*--- A file with the same size and limits, but for other model parameters, is not used. ---*/
+  {
+    std::stringstream other_options(config_options.str() + "CRITICAL_TEMPERATURE= 200.0\n");
+    CConfig other_config(other_options, SU2_COMPONENT::SU2_CFD, false);
+
+    std::stringstream log;
+    auto origBuf = cout.rdbuf(log.rdbuf());
+    auto otherTable = CTabulatedGas::MakeTable(reference, other_config, 1.0, 2.0);
+    cout.rdbuf(origBuf);
+
+    CHECK(otherTable != table);
+    CHECK(log.str().find("built") != string::npos);
+  }
+  std::remove("fluid_table_test.bin");
+
+  /*--- Interpolated states, and one outside the table which uses the original model. ---*/
+  reference.SetTDState_Prho(1.0, 2.0);
+  const su2double e0 = reference.GetStaticEnergy();
+
+  for (su2double rho : {1.3, 2.71, 3.9, 5.0}) {
+    for (su2double e : {0.6*e0, 1.17*e0, 1.9*e0}) {
+      reference.SetTDState_rhoe(rho, e);
+      fluid.SetTDState_rhoe(rho, e);
+      CHECK(fluid.GetPressure() == Approx(reference.GetPressure()).epsilon(1e-3));
+      CHECK(fluid.GetTemperature() == Approx(reference.GetTemperature()).epsilon(1e-3));
+      CHECK(fluid.GetSoundSpeed2() == Approx(reference.GetSoundSpeed2()).epsilon(1e-3));
+      CHECK(fluid.GetdPdrho_e() == Approx(reference.GetdPdrho_e()).epsilon(1e-3));
+      CHECK(fluid.GetdPde_rho() == Approx(reference.GetdPde_rho()).epsilon(1e-3));
+    }
+  }
+  checkStates_rhoe(fluid);
+}
+
+TEST_CASE("Batched SU2TCLib thermochemistry", "[Fluid models]") {
+  std::stringstream config_options;
+  config_options << "SOLVER= NEMO_EULER" << std::endl;
+  config_options << "FLUID_MODEL= SU2_NONEQ" << std::endl;
+  config_options << "GAS_MODEL= AIR-5" << std::endl;
+  config_options << "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)" << std::endl;
+  config_options << "CONV_NUM_METHOD_FLOW= AUSM" << std::endl;
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+
+  CSU2TCLib fluid(&config, 2, false);
+  const auto nSpecies = config.GetnSpecies();
+  fluid.GetSpeciesCvTraRot();
+
+  /*--- Partial batch of dissociating air states. ---*/
+  CNEMOGas::ThermoChemBatch batch(nSpecies);
+  batch.size = 7;
+  vector<su2double> rhos(nSpecies);
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies)
+      batch.rhos[iSpecies*CFluidModel::BATCH_SIZE + k] = 1e-3 * (1 + iSpecies + 0.5*k);
+    batch.T[k] = 4000.0 + 700.0 * k;
+    batch.Tve[k] = 3000.0 + 500.0 * k;
+  }
+  fluid.ComputeBatchNetProductionRates(batch);
+  fluid.ComputeBatchEveSourceTerm(batch);
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies)
+      rhos[iSpecies] = batch.rhos[iSpecies*CFluidModel::BATCH_SIZE + k];
+
+    fluid.SetTDStateRhosTTv(rhos, batch.T[k], batch.Tve[k]);
+    const auto ws = fluid.ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies)
+      CHECK(batch.ws[iSpecies*CFluidModel::BATCH_SIZE + k] == Approx(ws[iSpecies]));
+    CHECK(batch.EveSource[k] == Approx(fluid.ComputeEveSourceTerm()));
+
+    /*--- Energies for the temperature computation. ---*/
+    const auto energies = fluid.ComputeMixtureEnergies();
+    su2double rho = 0.0;
+    for (auto r : rhos) rho += r;
+    batch.rhoE[k] = rho * energies[0] + 100.0;
+    batch.rhoEve[k] = rho * energies[1];
+    batch.rhoEvel[k] = 100.0;
+  }
+
+  fluid.ComputeBatchTemperatures(batch);
+
+  for (size_t k = 0; k < batch.size; ++k) {
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; ++iSpecies)
+      rhos[iSpecies] = batch.rhos[iSpecies*CFluidModel::BATCH_SIZE + k];
+
+    const auto temps = fluid.ComputeTemperatures(rhos, batch.rhoE[k], batch.rhoEve[k], batch.rhoEvel[k]);
+    CHECK(batch.T[k] == Approx(temps[0]));
+    CHECK(batch.Tve[k] == Approx(temps[1]));
+    CHECK(batch.T[k] == Approx(4000.0 + 700.0 * k));
+    CHECK(batch.Tve[k] == Approx(3000.0 + 500.0 * k).epsilon(1e-4));
+  }
+}
+
+TEST_CASE("Batched Sutherland viscosity", "[Fluid models]") {
+  CSutherland model(1.716e-5, 273.15, 110.4);
+  constexpr auto n = CFluidModel::BATCH_SIZE;
+  su2double T[n], rho[n], mu[n], dmudrho[n], dmudT[n];
+  for (size_t i = 0; i < n; ++i) {
+    T[i] = 200.0 + 10.0 * i;
+    rho[i] = 1.0;
+  }
+  model.ComputeViscosity(n, T, rho, mu, dmudrho, dmudT);
+
+  for (size_t i = 0; i < n; ++i) {
+    model.SetViscosity(T[i], rho[i]);
+    model.SetDerViscosity(T[i], rho[i]);
+    CHECK(mu[i] == Approx(model.GetViscosity()));
+    CHECK(dmudT[i] == Approx(model.GetdmudT_rho()));
+    CHECK(dmudrho[i] == Approx(model.Getdmudrho_T()));
+  }
+}
@@ -31,6 +31,9 @@
 #include "../../SU2_CFD/include/solvers/CSolver.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/limiters/computeLimiters.hpp"
+#include "../../SU2_CFD/include/limiters/computeGradientsAndLimiters.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsEdges.hpp"
 
 /*!
  * \brief Base class for gradient tests using a unit cube geometry.
@@ -163,3 +166,100 @@ TEST_CASE("LS", "[Gradients]") {
 TEST_CASE("WLS", "[Gradients]") {
   testLeastSquares<LinearFunction>(true);
 }
+
+template<class TestField>
+void testFusedGradientsAndLimiters(ENUM_FLOW_GRADIENT kindGradient) {
+  TestField testField;
+  const auto nPoint = testField.geometry->GetnPoint();
+  const auto nDim = testField.geometry->GetnDim();
+  const auto nVar = testField.nVar;
+  auto& geometry = *testField.geometry.get();
+  const auto& config = *testField.config.get();
+
+  /*--- The limiters need a field of the same type as their outputs. ---*/
+  su2activematrix field(nPoint, nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      field(iPoint,iVar) = testField(iPoint,iVar);
+
+  C3DDoubleMatrix R(nPoint, nDim, nDim), gradRef(nPoint, nVar, nDim), grad(nPoint, nVar, nDim);
+  su2activematrix fieldMin(nPoint, nVar), fieldMax(nPoint, nVar), limRef(nPoint, nVar), lim(nPoint, nVar);
+
+  /*--- Separate passes. ---*/
+  if (kindGradient == GREEN_GAUSS) {
+    computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, geometry, config, field, 0, nVar, gradRef);
+  } else {
+    computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry, config,
+                                 kindGradient == WEIGHTED_LEAST_SQUARES, field, 0, nVar, gradRef, R);
+  }
+  computeLimiters(VENKATAKRISHNAN, nullptr, SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE, geometry, config,
+                  0, nVar, field, gradRef, fieldMin, fieldMax, limRef);
+
+  /*--- Fused pass. ---*/
+  computeGradientsAndLimiters(VENKATAKRISHNAN, nullptr, SOLUTION, SOLUTION_LIMITER, geometry, config, kindGradient,
+                              0, nVar, field, grad, R, lim);
+
+  su2double gradErr = 0.0, limErr = 0.0;
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      limErr = max(limErr, abs(lim(iPoint,iVar) - limRef(iPoint,iVar)));
+      for (auto iDim = 0ul; iDim < nDim; ++iDim)
+        gradErr = max(gradErr, abs(grad(iPoint,iVar,iDim) - gradRef(iPoint,iVar,iDim)));
+    }
+  }
+  CHECK(gradErr < 1e-12);
+  CHECK(limErr < 1e-12);
+}
+
+TEST_CASE("Fused GG and limiter", "[Gradients]") {
+  testFusedGradientsAndLimiters<LinearFunction>(GREEN_GAUSS);
+}
+
+TEST_CASE("Fused WLS and limiter", "[Gradients]") {
+  testFusedGradientsAndLimiters<LinearFunction>(WEIGHTED_LEAST_SQUARES);
+}
+
+template<class TestField>
+void testEdgeGradients(ENUM_FLOW_GRADIENT kindGradient) {
+  TestField field;
+  const auto nPoint = field.geometry->GetnPoint();
+  const auto nDim = field.geometry->GetnDim();
+  const auto nVar = field.nVar;
+  auto& geometry = *field.geometry.get();
+  const auto& config = *field.config.get();
+
+  const auto& coloring = geometry.GetEdgeColoring();
+  vector<GridColor<> > edgeColoring;
+  for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor)
+    edgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor),
+                              geometry.GetEdgeColorGroupSize());
+
+  C3DDoubleMatrix R(nPoint, nDim, nDim), gradRef(nPoint, nVar, nDim), grad(nPoint, nVar, nDim);
+
+  if (kindGradient == GREEN_GAUSS) {
+    computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, geometry, config, field, 0, nVar, gradRef);
+    computeGradientsGreenGaussEdges(nullptr, SOLUTION, PERIODIC_NONE, geometry, config, edgeColoring,
+                                    field, 0, nVar, grad);
+  } else {
+    const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+    computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry, config,
+                                 weighted, field, 0, nVar, gradRef, R);
+    computeGradientsLeastSquaresEdges(nullptr, SOLUTION, PERIODIC_NONE, geometry, config, edgeColoring,
+                                      weighted, field, 0, nVar, grad, R);
+  }
+
+  su2double gradErr = 0.0;
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      for (auto iDim = 0ul; iDim < nDim; ++iDim)
+        gradErr = max(gradErr, abs(grad(iPoint,iVar,iDim) - gradRef(iPoint,iVar,iDim)));
+  CHECK(gradErr < 1e-12);
+}
+
+TEST_CASE("Edge-based GG", "[Gradients]") {
+  testEdgeGradients<LinearFunction>(GREEN_GAUSS);
+}
+
+TEST_CASE("Edge-based WLS", "[Gradients]") {
+  testEdgeGradients<LinearFunction>(WEIGHTED_LEAST_SQUARES);
+}
@@ -0,0 +1,167 @@
+/*!
+ * \file CPrimalCheckpoints_tests.cpp
+ * \brief Unit tests for the primal checkpoints of the unsteady discrete adjoint.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include "../../BoxTestCase.hpp"
+#include "../../../SU2_CFD/include/iteration/CPrimalCheckpoints.hpp"
+
+TEST_CASE("Checkpoint offset, trivial cases", "[Checkpoints]") {
+
+  /*--- No free checkpoints, or nothing between the last checkpoint and the requested state. ---*/
+  CHECK(CPrimalCheckpoints::CheckpointOffset(10, 0) == 0);
+  CHECK(CPrimalCheckpoints::CheckpointOffset(0, 3) == 0);
+  CHECK(CPrimalCheckpoints::CheckpointOffset(1, 3) == 0);
+
+  /*--- With enough checkpoints every step is stored. ---*/
+  for (unsigned long nSteps = 2; nSteps <= 5; ++nSteps)
+    CHECK(CPrimalCheckpoints::CheckpointOffset(nSteps, 4) == 1);
+}
+
+TEST_CASE("Checkpoint offset, binomial placement", "[Checkpoints]") {
+
+  /*--- beta(s,t) = (s+t)!/(s!t!), the offset is beta(s,t-1) for the smallest t with beta(s,t) >= nSteps. ---*/
+  CHECK(CPrimalCheckpoints::CheckpointOffset(5, 1) == 4);
+  CHECK(CPrimalCheckpoints::CheckpointOffset(10, 2) == 6);
+  CHECK(CPrimalCheckpoints::CheckpointOffset(11, 2) == 10);
+  CHECK(CPrimalCheckpoints::CheckpointOffset(100, 3) == 84);
+
+  /*--- The offset always leaves the requested state in front of the checkpoint. ---*/
+  for (unsigned long nFree = 1; nFree <= 6; ++nFree) {
+    for (unsigned long nSteps = 2; nSteps <= 200; ++nSteps) {
+      const auto offset = CPrimalCheckpoints::CheckpointOffset(nSteps, nFree);
+      CHECK(offset >= 1);
+      CHECK(offset < nSteps);
+    }
+  }
+}
+
+TEST_CASE("Checkpoints restore the reverse sequence of time steps", "[Checkpoints]") {
+
+  const long nTimeSteps = 20;
+  const unsigned long nCheckpoints = 3;
+
+  BoxTestCase test("SOLVER= EULER\n"
+                   "MACH_NUMBER= 0.5\n"
+                   "CONV_NUM_METHOD_FLOW= ROE\n"
+                   "MUSCL_FLOW= NO\n"
+                   "TIME_DOMAIN= YES\n"
+                   "TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER\n"
+                   "TIME_STEP= 0.1\n"
+                   "UNST_ADJOINT_CHECKPOINTS= " + std::to_string(nCheckpoints) + "\n"
+                   "READ_BINARY_RESTART= NO\n"
+                   "SOLUTION_FILENAME= primal_checkpoints_test.dat\n"
+                   "MESH_FORMAT= BOX\n"
+                   "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+                   "MESH_BOX_SIZE= 3,3,3\n"
+                   "MESH_BOX_LENGTH= 1,1,1\n"
+                   "MESH_BOX_OFFSET= 0,0,0\n", EULER);
+
+  auto* config = test.config.get();
+  CGeometry* geometry[] = {test.geometry.get()};
+  CSolver** solver[] = {test.solver};
+  auto* nodes = test.solver[FLOW_SOL]->GetNodes();
+  const auto nPoint = test.geometry->GetnPoint();
+  const auto nVar = test.solver[FLOW_SOL]->GetnVar();
+
+  /*--- The state of a time step is a scaled free-stream, the free-stream itself is the state before the first step. ---*/
+
+  vector<su2double> freeStream(nVar);
+  for (auto iVar = 0u; iVar < nVar; ++iVar) freeStream[iVar] = nodes->GetSolution(0, iVar);
+  auto state = [&](long iStep, unsigned short iVar) { return freeStream[iVar] * (1.0 + 0.01 * (iStep + 1)); };
+
+  /*--- The first time step is read from its restart file. ---*/
+
+  const auto restartName = config->GetFilename(config->GetSolution_FileName(), "", 0) + ".csv";
+  {
+    ofstream restart(restartName);
+    restart << "\"PointID\",\"x\",\"y\",\"z\"";
+    for (auto iVar = 0u; iVar < nVar; ++iVar) restart << ",\"Var_" << iVar << "\"";
+    restart << "\n" << std::setprecision(16);
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      restart << iPoint;
+      for (auto iDim = 0u; iDim < 3; ++iDim) restart << ", " << test.geometry->nodes->GetCoord(iPoint, iDim);
+      for (auto iVar = 0u; iVar < nVar; ++iVar) restart << ", " << state(0, iVar);
+      restart << "\n";
+    }
+  }
+
+  /*--- The stub of the direct time step checks that it starts from the two previous states, and
+   *    pushes its state to the time levels, as the update of the direct iteration does. ---*/
+
+  auto computeStep = [&](long iStep) {
+    bool consistent = true;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        consistent &= (nodes->GetSolution_time_n(iPoint, iVar) == Approx(state(iStep - 1, iVar)));
+        consistent &= (nodes->GetSolution_time_n1(iPoint, iVar) == Approx(state(iStep - 2, iVar)));
+        nodes->SetSolution(iPoint, iVar, state(iStep, iVar));
+      }
+    }
+    CHECK(consistent);
+    nodes->Set_Solution_time_n1();
+    nodes->Set_Solution_time_n();
+  };
+
+  CPrimalCheckpoints checkpoints(config, geometry, solver, computeStep);
+
+  /*--- The reverse sweep requests the states in decreasing order, the time levels of the adjoint are not modified. ---*/
+
+  for (auto iStep = nTimeSteps - 1; iStep >= 0; --iStep) {
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        nodes->Set_Solution_time_n(iPoint, iVar, -1.0);
+        nodes->Set_Solution_time_n1(iPoint, iVar, -2.0);
+      }
+    }
+
+    checkpoints.Load(iStep);
+
+    bool restored = true;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      for (auto iVar = 0u; iVar < nVar; ++iVar) {
+        restored &= (nodes->GetSolution(iPoint, iVar) == Approx(state(iStep, iVar)));
+        restored &= (nodes->GetSolution_time_n(iPoint, iVar) == -1.0);
+        restored &= (nodes->GetSolution_time_n1(iPoint, iVar) == -2.0);
+      }
+    }
+    CHECK(restored);
+  }
+  std::remove(restartName.c_str());
+
+  /*--- Every step is recomputed at least once and at most t times, t being the smallest number of repetitions
+   *    for which beta(s,t) = (s+t)!/(s!t!) covers the steps after the first one (which is read). ---*/
+
+  unsigned long t = 0, beta = 1;
+  while (beta < nTimeSteps - 1ul) {
+    ++t;
+    beta = beta * (nCheckpoints + t) / t;
+  }
+  CHECK(checkpoints.GetnRecomputed() >= nTimeSteps - 1ul);
+  CHECK(checkpoints.GetnRecomputed() <= t * (nTimeSteps - 1));
+}
@@ -0,0 +1,161 @@
+/*!
+ * \file CFrozenJacobianFlux_tests.cpp
+ * \brief Discrete adjoint tests of the edge fluxes recorded with frozen Jacobians (FROZEN_CONV_JACOBIAN_DISC).
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../BoxTestCase.hpp"
+
+/*!
+ * \brief Record the vectorized edge residual w.r.t. the primitive variables and return their adjoints
+ *        for a fixed seed of the residual, the transposed Jacobian of the residual times the seed, mapped
+ *        to the primitive variables, is also returned.
+ */
+static void FrozenAdjoints(const string& scheme, passivedouble fixFactor,
+                           vector<passivedouble>& adjoints, vector<passivedouble>& expected) {
+
+  const string options =
+      "SOLVER= EULER\n"
+      "MACH_NUMBER= 0.8\n"
+      "FREESTREAM_PRESSURE= 101325.0\n"
+      "FREESTREAM_TEMPERATURE= 288.15\n"
+      "CONV_NUM_METHOD_FLOW= " + scheme + "\n"
+      "JST_SENSOR_COEFF= (0.5, 0.02)\n"
+      "CENTRAL_JACOBIAN_FIX_FACTOR= " + std::to_string(fixFactor) + "\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      "USE_VECTORIZATION= YES\n"
+      "FROZEN_CONV_JACOBIAN_DISC= YES\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 4,4,4\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n";
+
+  BoxTestCase test(options, EULER);
+
+  auto* solver = test.solver[FLOW_SOL];
+  auto* nodes = solver->GetNodes();
+  const auto nDim = test.geometry->GetnDim();
+  const auto nPoint = test.geometry->GetnPoint();
+  const auto nVar = solver->GetnVar();
+  const unsigned long nPrim = nDim+4;
+
+  /*--- Non-uniform state, the sensor and the undivided Laplacian are computed before recording. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto coord = test.geometry->nodes->GetCoord(iPoint);
+    const su2double scale = 1.0 + 0.2 * sin(3.0*coord[0]) * cos(2.0*coord[1]) + 0.1 * coord[2];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      nodes->SetSolution(iPoint, iVar, scale * nodes->GetSolution(iPoint, iVar));
+  }
+
+  auto origBuf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  solver->Preprocessing(test.geometry.get(), test.solver, test.config.get(), MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  cout.rdbuf(origBuf);
+
+  solver->LinSysRes.SetValZero();
+  solver->Jacobian.SetValZero();
+
+  AD::Reset();
+  AD::StartRecording();
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iPrim = 0ul; iPrim < nPrim; ++iPrim) AD::RegisterInput(nodes->GetPrimitive(iPoint)[iPrim]);
+
+  solver->Centered_Residual(test.geometry.get(), test.solver, nullptr, test.config.get(), MESH_0, NO_RK_ITER);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) AD::RegisterOutput(solver->LinSysRes(iPoint,iVar));
+
+  AD::StopRecording();
+
+  auto seed = [](unsigned long iPoint, unsigned long iVar) { return 1.0 + 0.1*(iPoint % 7) - 0.05*iVar; };
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) SU2_TYPE::SetDerivative(solver->LinSysRes(iPoint,iVar), seed(iPoint,iVar));
+
+  AD::ComputeAdjoint();
+
+  adjoints.clear();
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iPrim = 0ul; iPrim < nPrim; ++iPrim)
+      adjoints.push_back(SU2_TYPE::GetDerivative(nodes->GetPrimitive(iPoint)[iPrim]));
+
+  /*--- z = J^T seed, then the chain rule with dU/dV for U = (rho, rho*vel, rho*h-p), V = (T, vel, p, rho, h). ---*/
+
+  vector<passivedouble> z(nPoint*nVar, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (const auto jPoint : test.geometry->nodes->GetPoints(iPoint)) {
+      const auto block = solver->Jacobian.GetBlock(jPoint, iPoint);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          z[iPoint*nVar+jVar] += SU2_TYPE::GetValue(block[iVar*nVar+jVar]) * seed(jPoint,iVar);
+    }
+    const auto block = solver->Jacobian.GetBlock(iPoint, iPoint);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      for (auto jVar = 0ul; jVar < nVar; ++jVar)
+        z[iPoint*nVar+jVar] += SU2_TYPE::GetValue(block[iVar*nVar+jVar]) * seed(iPoint,iVar);
+  }
+
+  expected.clear();
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto V = nodes->GetPrimitive(iPoint);
+    const auto rho = SU2_TYPE::GetValue(V[nDim+2]);
+    const auto* zi = &z[iPoint*nVar];
+
+    passivedouble zRho = zi[0] + zi[nDim+1] * SU2_TYPE::GetValue(V[nDim+3]);
+    expected.push_back(0.0);
+    for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+      expected.push_back(zi[iDim+1] * rho);
+      zRho += zi[iDim+1] * SU2_TYPE::GetValue(V[iDim+1]);
+    }
+    expected.push_back(-zi[nDim+1]);
+    expected.push_back(zRho);
+    expected.push_back(zi[nDim+1] * rho);
+  }
+
+  AD::Reset();
+}
+
+TEST_CASE("Frozen Jacobian adjoints of centered schemes", "[AD tests]") {
+
+  for (const string scheme : {"JST", "LAX-FRIEDRICH"}) {
+    vector<passivedouble> adjoints, expected, adjointsFix, expectedFix;
+
+    /*--- The reverse sweep applies the Jacobians of the system matrix assembled during the recording. ---*/
+
+    FrozenAdjoints(scheme, 1.0, adjoints, expected);
+    REQUIRE(adjoints.size() == expected.size());
+    for (auto i = 0ul; i < adjoints.size(); ++i)
+      CHECK(adjoints[i] == Approx(expected[i]).margin(1e-10));
+
+    /*--- The recorded Jacobians are not scaled by CENTRAL_JACOBIAN_FIX_FACTOR. ---*/
+
+    FrozenAdjoints(scheme, 4.0, adjointsFix, expectedFix);
+    REQUIRE(adjointsFix.size() == adjoints.size());
+    for (auto i = 0ul; i < adjoints.size(); ++i)
+      CHECK(adjointsFix[i] == Approx(adjoints[i]).margin(1e-10));
+  }
+}
@@ -0,0 +1,321 @@
+/*!
+ * \file CNumericsSIMD_tests.cpp
+ * \brief Unit tests comparing the vectorized numerics with the legacy classes.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../BoxTestCase.hpp"
+#include "../../../SU2_CFD/include/numerics/NEMO/convection/ausm.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/convection/fds.hpp"
+#include "../../../SU2_CFD/include/numerics/flow/flow_diffusion.hpp"
+#include "../../../SU2_CFD/include/numerics/turbulent/turb_sources.hpp"
+
+/*!
+ * \brief Check that two residual vectors match to round-off, relative to the largest entry of each variable.
+ */
+static void CheckParity(const CSysVector<su2double>& legacy, const CSysVector<su2double>& simd,
+                        unsigned long nPoint, unsigned long nVar) {
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+    passivedouble scale = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      scale = max(scale, fabs(SU2_TYPE::GetValue(legacy(iPoint,iVar))));
+    REQUIRE(scale > 0.0);
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const passivedouble diff = SU2_TYPE::GetValue(legacy(iPoint,iVar) - simd(iPoint,iVar));
+      CHECK(fabs(diff) <= 1e-10 * scale);
+    }
+  }
+}
+
+TEST_CASE("Vectorized NEMO AUSM matches the legacy scheme", "[NEMO][vectorization]") {
+
+  const string options =
+      "SOLVER= NEMO_EULER\n"
+      "GAS_MODEL= AIR-5\n"
+      "GAS_COMPOSITION= (0.7, 0.2, 0.04, 0.03, 0.03)\n"
+      "FLUID_MODEL= SU2_NONEQ\n"
+      "MACH_NUMBER= 5\n"
+      "FREESTREAM_PRESSURE= 101325.0\n"
+      "FREESTREAM_TEMPERATURE= 288.15\n"
+      "FREESTREAM_TEMPERATURE_VE= 288.15\n"
+      "CONV_NUM_METHOD_FLOW= AUSM\n"
+      "MUSCL_FLOW= NO\n"
+      "TIME_DISCRE_FLOW= EULER_EXPLICIT\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 5,5,5\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n";
+
+  BoxTestCase legacy(options + "USE_VECTORIZATION= NO\n", NEMO_EULER);
+  BoxTestCase simd(options + "USE_VECTORIZATION= YES\n", NEMO_EULER);
+
+  const auto nDim = legacy.geometry->GetnDim();
+  const auto nPoint = legacy.geometry->GetnPoint();
+  const auto nSpecies = legacy.config->GetnSpecies();
+  const auto nVar = legacy.solver[FLOW_SOL]->GetnVar();
+
+  /*--- Non-uniform but physical state, the density is scaled and the velocity is
+   *    stretched (the total energy is corrected for the change in kinetic energy). ---*/
+
+  for (auto* test : {&legacy, &simd}) {
+    auto* nodes = test->solver[FLOW_SOL]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const auto coord = test->geometry->nodes->GetCoord(iPoint);
+      const su2double scale = 1.0 + 0.2 * sin(3.0*coord[0]) * cos(2.0*coord[1]);
+      const su2double stretch = 1.0 + 0.3 * coord[2];
+
+      su2double rho = 0.0;
+      for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies)
+        rho += nodes->GetSolution(iPoint, iSpecies);
+
+      su2double kinOld = 0.0, kinNew = 0.0;
+      for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+        const su2double mom = nodes->GetSolution(iPoint, nSpecies+iDim);
+        kinOld += 0.5 * pow(mom, 2) / rho;
+        kinNew += 0.5 * pow(mom*stretch, 2) / rho;
+        nodes->SetSolution(iPoint, nSpecies+iDim, mom*stretch);
+      }
+      nodes->AddSolution(iPoint, nSpecies+nDim, kinNew-kinOld);
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        nodes->SetSolution(iPoint, iVar, scale * nodes->GetSolution(iPoint, iVar));
+    }
+  }
+
+  /*--- Residuals of both paths, the legacy numerics are not used by the vectorized solver. ---*/
+
+  const auto nPrimVar = legacy.solver[FLOW_SOL]->GetnPrimVar();
+  const auto nPrimVarGrad = legacy.solver[FLOW_SOL]->GetnPrimVarGrad();
+
+  CNumerics* numerics[MAX_TERMS] = {nullptr};
+  numerics[CONV_TERM] = new CUpwAUSM_NEMO(nDim, nVar, nPrimVar, nPrimVarGrad, legacy.config.get());
+
+  for (auto* test : {&legacy, &simd}) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    test->solver[FLOW_SOL]->Preprocessing(test->geometry.get(), test->solver, test->config.get(), MESH_0,
+                                          NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    test->solver[FLOW_SOL]->Upwind_Residual(test->geometry.get(), test->solver, numerics, test->config.get(), MESH_0);
+    cout.rdbuf(origBuf);
+  }
+  delete numerics[CONV_TERM];
+
+  CheckParity(legacy.solver[FLOW_SOL]->LinSysRes, simd.solver[FLOW_SOL]->LinSysRes, legacy.geometry->GetnPointDomain(), nVar);
+}
+
+TEST_CASE("Vectorized incompressible FDS keeps the non-physical points first order", "[incompressible][vectorization]") {
+
+  const string options =
+      "SOLVER= INC_NAVIER_STOKES\n"
+      "INC_ENERGY_EQUATION= YES\n"
+      "INC_DENSITY_MODEL= VARIABLE\n"
+      "FLUID_MODEL= INC_IDEAL_GAS\n"
+      "INC_VELOCITY_INIT= (10.0, 1.0, 0.5)\n"
+      "CONV_NUM_METHOD_FLOW= FDS\n"
+      "MUSCL_FLOW= YES\n"
+      "SLOPE_LIMITER_FLOW= NONE\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 5,5,5\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n";
+
+  BoxTestCase legacy(options + "USE_VECTORIZATION= NO\n", INC_NAVIER_STOKES);
+  BoxTestCase simd(options + "USE_VECTORIZATION= YES\n", INC_NAVIER_STOKES);
+
+  const auto nDim = legacy.geometry->GetnDim();
+  const auto nPoint = legacy.geometry->GetnPoint();
+  const auto nVar = legacy.solver[FLOW_SOL]->GetnVar();
+
+  /*--- Non-uniform velocity and temperature (the gradients make the reconstruction
+   *    second order), every third point is flagged as non-physical. ---*/
+
+  for (auto* test : {&legacy, &simd}) {
+    auto* nodes = test->solver[FLOW_SOL]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const auto coord = test->geometry->nodes->GetCoord(iPoint);
+      const su2double wave = sin(3.0*coord[0]) * cos(2.0*coord[1]) + 0.5*coord[2];
+      for (auto iDim = 0ul; iDim < nDim; ++iDim)
+        nodes->SetSolution(iPoint, iDim+1, (1.0 + 0.3*wave) * nodes->GetSolution(iPoint, iDim+1));
+      nodes->SetSolution(iPoint, nDim+1, (1.0 + 0.1*wave) * nodes->GetSolution(iPoint, nDim+1));
+      nodes->SetNon_Physical(iPoint, iPoint % 3 == 0);
+    }
+  }
+
+  CNumerics* numerics[MAX_TERMS] = {nullptr};
+  numerics[CONV_TERM] = new CUpwFDSInc_Flow(nDim, nVar, legacy.config.get());
+  numerics[VISC_TERM] = new CAvgGradInc_Flow(nDim, nVar, true, legacy.config.get());
+
+  for (auto* test : {&legacy, &simd}) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    test->solver[FLOW_SOL]->Preprocessing(test->geometry.get(), test->solver, test->config.get(), MESH_0,
+                                          NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    test->solver[FLOW_SOL]->Upwind_Residual(test->geometry.get(), test->solver, numerics, test->config.get(), MESH_0);
+    cout.rdbuf(origBuf);
+  }
+  delete numerics[CONV_TERM];
+  delete numerics[VISC_TERM];
+
+  CheckParity(legacy.solver[FLOW_SOL]->LinSysRes, simd.solver[FLOW_SOL]->LinSysRes, legacy.geometry->GetnPointDomain(), nVar);
+
+  /*--- The flags are updated in the same way by both paths. ---*/
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    CHECK(simd.solver[FLOW_SOL]->GetNodes()->GetNon_Physical(iPoint) ==
+          legacy.solver[FLOW_SOL]->GetNodes()->GetNon_Physical(iPoint));
+}
+
+/*!
+ * \brief Compare the vectorized source terms of a turbulence model with the legacy numerics,
+ *        residuals and diagonal blocks of the Jacobian.
+ */
+static void TurbSourceParity(const string& turbModel) {
+
+  const string options =
+      "SOLVER= RANS\n"
+      "KIND_TURB_MODEL= " + turbModel + "\n"
+      "MACH_NUMBER= 0.5\n"
+      "REYNOLDS_NUMBER= 1e6\n"
+      "INIT_OPTION= TD_CONDITIONS\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      "TIME_DISCRE_TURB= EULER_IMPLICIT\n"
+      "MESH_FORMAT= BOX\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_FAR= (x_minus, x_plus, z_minus, z_plus)\n"
+      "MESH_BOX_SIZE= 5,5,5\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n";
+
+  BoxTestCase legacy(options + "USE_VECTORIZATION= NO\n", RANS);
+  BoxTestCase simd(options + "USE_VECTORIZATION= YES\n", RANS);
+
+  const bool sst = (legacy.config->GetKind_Turb_Model() == TURB_MODEL::SST);
+  const bool negative = (legacy.config->GetKind_Turb_Model() == TURB_MODEL::SA_NEG);
+  const auto nDim = legacy.geometry->GetnDim();
+  const auto nPoint = legacy.geometry->GetnPoint();
+  const auto nVar = legacy.solver[TURB_SOL]->GetnVar();
+
+  /*--- Sheared velocity (for the vorticity), varying turbulence variables (negative
+   *    in parts of the domain for SA-neg), and the distance to the y walls. ---*/
+
+  for (auto* test : {&legacy, &simd}) {
+    auto* flowNodes = test->solver[FLOW_SOL]->GetNodes();
+    auto* turbNodes = test->solver[TURB_SOL]->GetNodes();
+
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      const auto coord = test->geometry->nodes->GetCoord(iPoint);
+      test->geometry->nodes->SetWall_Distance(iPoint, min(coord[1], 1.0-coord[1]));
+
+      const su2double rho = flowNodes->GetSolution(iPoint, 0);
+      const su2double shear[3] = {1.0 + coord[1], 0.8 + 0.2*sin(3.0*coord[0]), 1.0 - 0.3*coord[1]};
+      su2double kinOld = 0.0, kinNew = 0.0;
+      for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+        const su2double mom = flowNodes->GetSolution(iPoint, iDim+1);
+        kinOld += 0.5 * pow(mom, 2) / rho;
+        kinNew += 0.5 * pow(mom*shear[iDim], 2) / rho;
+        flowNodes->SetSolution(iPoint, iDim+1, mom*shear[iDim]);
+      }
+      flowNodes->AddSolution(iPoint, nDim+1, kinNew-kinOld);
+
+      const su2double wave = sin(3.0*coord[0]) * cos(2.0*coord[2]);
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        const su2double factor = negative? wave : 1.0 + 0.5*wave;
+        turbNodes->SetSolution(iPoint, iVar, factor * turbNodes->GetSolution(iPoint, iVar));
+      }
+    }
+  }
+
+  /*--- Legacy numerics for the legacy setup, the vectorized setup gets none so that
+   *    a silent fallback to the point loop cannot go unnoticed. ---*/
+
+  CNumerics* numerics[MAX_TERMS] = {nullptr};
+  CNumerics* noNumerics[MAX_TERMS] = {nullptr};
+  auto* config = legacy.config.get();
+  const auto* turbSolver = legacy.solver[TURB_SOL];
+
+  switch (config->GetKind_Turb_Model()) {
+    case TURB_MODEL::SA: numerics[SOURCE_FIRST_TERM] = new CSourcePieceWise_TurbSA(nDim, nVar, config); break;
+    case TURB_MODEL::SA_E: numerics[SOURCE_FIRST_TERM] = new CSourcePieceWise_TurbSA_E(nDim, nVar, config); break;
+    case TURB_MODEL::SA_COMP: numerics[SOURCE_FIRST_TERM] = new CSourcePieceWise_TurbSA_COMP(nDim, nVar, config); break;
+    case TURB_MODEL::SA_E_COMP: numerics[SOURCE_FIRST_TERM] = new CSourcePieceWise_TurbSA_E_COMP(nDim, nVar, config); break;
+    case TURB_MODEL::SA_NEG: numerics[SOURCE_FIRST_TERM] = new CSourcePieceWise_TurbSA_Neg(nDim, nVar, config); break;
+    case TURB_MODEL::SST:
+      numerics[SOURCE_FIRST_TERM] = new CSourcePieceWise_TurbSST(nDim, nVar, turbSolver->GetConstants(),
+                                                                 turbSolver->GetTke_Inf(), turbSolver->GetOmega_Inf(), config);
+      break;
+    default: break;
+  }
+  REQUIRE(numerics[SOURCE_FIRST_TERM] != nullptr);
+
+  for (auto* test : {&legacy, &simd}) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    auto* cfg = test->config.get();
+    auto* geo = test->geometry.get();
+    auto** sol = test->solver;
+
+    cfg->SetGlobalParam(RANS, RUNTIME_FLOW_SYS);
+    sol[FLOW_SOL]->Preprocessing(geo, sol, cfg, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+
+    cfg->SetGlobalParam(RANS, RUNTIME_TURB_SYS);
+    sol[TURB_SOL]->Preprocessing(geo, sol, cfg, MESH_0, NO_RK_ITER, RUNTIME_TURB_SYS, false);
+    if (sst) {
+      /*--- Blending functions, and then clear the system again. ---*/
+      sol[TURB_SOL]->Postprocessing(geo, sol, cfg, MESH_0);
+      sol[TURB_SOL]->Preprocessing(geo, sol, cfg, MESH_0, NO_RK_ITER, RUNTIME_TURB_SYS, false);
+    }
+    sol[TURB_SOL]->Source_Residual(geo, sol, (test == &legacy)? numerics : noNumerics, cfg, MESH_0);
+    cout.rdbuf(origBuf);
+  }
+  delete numerics[SOURCE_FIRST_TERM];
+
+  const auto nPointDomain = legacy.geometry->GetnPointDomain();
+  CheckParity(legacy.solver[TURB_SOL]->LinSysRes, simd.solver[TURB_SOL]->LinSysRes, nPointDomain, nVar);
+
+  const auto& jacLegacy = legacy.solver[TURB_SOL]->Jacobian;
+  const auto& jacSimd = simd.solver[TURB_SOL]->Jacobian;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+        const passivedouble ref = SU2_TYPE::GetValue(jacLegacy.GetBlock(iPoint, iPoint, iVar, jVar));
+        const passivedouble val = SU2_TYPE::GetValue(jacSimd.GetBlock(iPoint, iPoint, iVar, jVar));
+        CHECK(val == Approx(ref).epsilon(1e-6).margin(1e-12));
+      }
+    }
+  }
+}
+
+TEST_CASE("Vectorized SA sources match the legacy numerics", "[turbulence][vectorization]") {
+  const string model = GENERATE(as<string>{}, "SA", "SA_E", "SA_COMP", "SA_E_COMP", "SA_NEG");
+  TurbSourceParity(model);
+}
+
+TEST_CASE("Vectorized SST sources match the legacy numerics", "[turbulence][vectorization]") {
+  TurbSourceParity("SST");
+}
@@ -0,0 +1,151 @@
+/*!
+ * \file CNEMOEulerSolver_tests.cpp
+ * \brief Unit tests of the operator-split chemistry of the NEMO solver.
+ * \author P. Gomes
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../BoxTestCase.hpp"
+#include "../../../SU2_CFD/include/numerics/NEMO/NEMO_sources.hpp"
+
+static const string splitOptions =
+    "SOLVER= NEMO_EULER\n"
+    "GAS_MODEL= AIR-5\n"
+    "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)\n"
+    "FLUID_MODEL= SU2_NONEQ\n"
+    "MACH_NUMBER= 0.5\n"
+    "FREESTREAM_PRESSURE= 10000.0\n"
+    "FREESTREAM_TEMPERATURE= 6000.0\n"
+    "FREESTREAM_TEMPERATURE_VE= 3000.0\n"
+    "TIME_DISCRE_FLOW= EULER_EXPLICIT\n"
+    "MESH_FORMAT= BOX\n"
+    "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+    "MESH_BOX_SIZE= 3,3,3\n"
+    "MESH_BOX_LENGTH= 1,1,1\n"
+    "MESH_BOX_OFFSET= 0,0,0\n";
+
+TEST_CASE("Balanced chemistry splitting does not move a steady state", "[NEMO]") {
+
+  /*--- The free-stream is far from chemical equilibrium, and the flow residual is set to zero
+   *    (i.e. the convective fluxes are balanced by the chemistry in the residual). ---*/
+
+  BoxTestCase test(splitOptions + "CHEMISTRY_SPLITTING= YES\nCHEMISTRY_SUBSTEPS= 2\n", NEMO_EULER);
+
+  auto* solver = test.solver[FLOW_SOL];
+  auto* nodes = solver->GetNodes();
+  const auto nPointDomain = test.geometry->GetnPointDomain();
+  const auto nVar = solver->GetnVar();
+
+  auto Iterate = [&](su2double dt) {
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) nodes->SetDelta_Time(iPoint, dt);
+    solver->Set_OldSolution();
+    solver->LinSysRes.SetValZero();
+    solver->ExplicitEuler_Iteration(test.geometry.get(), test.solver, test.config.get());
+  };
+
+  /*--- The first step integrates the sources since none were included in the residual. ---*/
+
+  const su2activematrix initial = nodes->GetSolution();
+  Iterate(1e-7);
+
+  passivedouble change = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      change = max(change, fabs(SU2_TYPE::GetValue(nodes->GetSolution(iPoint,iVar) - initial(iPoint,iVar))));
+  REQUIRE(change > 0.0);
+
+  /*--- Afterwards, the residual includes the sources, when it is zero the split update
+   *    must not change the solution, for any time step (i.e. CFL). ---*/
+
+  const su2activematrix balanced = nodes->GetSolution();
+
+  for (const su2double dt : {1e-7, 1e-5, 1e-3}) {
+    Iterate(dt);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        const passivedouble ref = SU2_TYPE::GetValue(balanced(iPoint,iVar));
+        CHECK(SU2_TYPE::GetValue(nodes->GetSolution(iPoint,iVar)) == Approx(ref).margin(1e-12 * fabs(ref)));
+      }
+    }
+  }
+}
+
+TEST_CASE("The residual of split chemistry includes the thermochemical sources", "[NEMO]") {
+
+  BoxTestCase split(splitOptions + "CHEMISTRY_SPLITTING= YES\n", NEMO_EULER);
+  BoxTestCase coupled(splitOptions + "CHEMISTRY_SPLITTING= NO\n", NEMO_EULER);
+
+  const auto nDim = split.geometry->GetnDim();
+  const auto nPointDomain = split.geometry->GetnPointDomain();
+  const auto nSpecies = split.config->GetnSpecies();
+  const auto nVar = split.solver[FLOW_SOL]->GetnVar();
+  const auto nPrimVar = split.solver[FLOW_SOL]->GetnPrimVar();
+  const auto nPrimVarGrad = split.solver[FLOW_SOL]->GetnPrimVarGrad();
+
+  /*--- One split step to store the sources, the coupled solver uses the resulting state. ---*/
+
+  auto* nodes = split.solver[FLOW_SOL]->GetNodes();
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) nodes->SetDelta_Time(iPoint, 1e-7);
+  split.solver[FLOW_SOL]->Set_OldSolution();
+  split.solver[FLOW_SOL]->LinSysRes.SetValZero();
+  split.solver[FLOW_SOL]->ExplicitEuler_Iteration(split.geometry.get(), split.solver, split.config.get());
+
+  auto* coupledNodes = coupled.solver[FLOW_SOL]->GetNodes();
+  for (auto iPoint = 0ul; iPoint < split.geometry->GetnPoint(); ++iPoint)
+    coupledNodes->SetSolution(iPoint, nodes->GetSolution(iPoint));
+
+  CNumerics* numerics[MAX_TERMS] = {nullptr};
+  numerics[SOURCE_FIRST_TERM] = new CSource_NEMO(nDim, nVar, nPrimVar, nPrimVarGrad, split.config.get());
+
+  for (auto* test : {&split, &coupled}) {
+    auto origBuf = cout.rdbuf();
+    cout.rdbuf(nullptr);
+    test->solver[FLOW_SOL]->Preprocessing(test->geometry.get(), test->solver, test->config.get(), MESH_0,
+                                          NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    test->solver[FLOW_SOL]->LinSysRes.SetValZero();
+    test->solver[FLOW_SOL]->Source_Residual(test->geometry.get(), test->solver, numerics, test->config.get(), MESH_0);
+    cout.rdbuf(origBuf);
+  }
+  delete numerics[SOURCE_FIRST_TERM];
+
+  /*--- Same species and vib.-el. energy sources, up to the tolerance of the temperature iterations. ---*/
+
+  const auto& resSplit = split.solver[FLOW_SOL]->LinSysRes;
+  const auto& resCoupled = coupled.solver[FLOW_SOL]->LinSysRes;
+
+  const unsigned long iVarEve = nSpecies+nDim+1;
+
+  for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+    if (iVar >= nSpecies && iVar != iVarEve) continue;
+
+    passivedouble scale = 0.0;
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+      scale = max(scale, fabs(SU2_TYPE::GetValue(resCoupled(iPoint,iVar))));
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const passivedouble diff = SU2_TYPE::GetValue(resSplit(iPoint,iVar) - resCoupled(iPoint,iVar));
+      CHECK(fabs(diff) <= 1e-6 * scale);
+    }
+  }
+}
@@ -0,0 +1,108 @@
+/*!
+ * \file CVariable_tests.cpp
+ * \brief Unit tests of the extrapolation of the initial guess of dual time steps.
+ * \version 7.2.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2021, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../BoxTestCase.hpp"
+
+static const string extrapolationOptions =
+    "SOLVER= EULER\n"
+    "MACH_NUMBER= 0.5\n"
+    "TIME_DOMAIN= YES\n"
+    "TIME_MARCHING= DUAL_TIME_STEPPING-2ND_ORDER\n"
+    "TIME_STEP= 0.1\n"
+    "TIME_EXTRAPOLATION_ORDER= 2\n"
+    "MESH_FORMAT= BOX\n"
+    "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+    "MESH_BOX_SIZE= 3,3,3\n"
+    "MESH_BOX_LENGTH= 1,1,1\n"
+    "MESH_BOX_OFFSET= 0,0,0\n";
+
+TEST_CASE("Time extrapolation is exact for polynomials of its order", "[Dual Time]") {
+
+  BoxTestCase test(extrapolationOptions, EULER);
+
+  auto* nodes = test.solver[FLOW_SOL]->GetNodes();
+  const auto nPoint = test.geometry->GetnPoint();
+  const auto nVar = test.solver[FLOW_SOL]->GetnVar();
+
+  for (unsigned short order = 1; order <= 2; ++order) {
+
+    /*--- Polynomial of the time step index, the solution at time n+1 (index 1) is extrapolated from 0, -1, and -2. ---*/
+
+    auto exact = [&](unsigned long iPoint, unsigned long iVar, int iTime) {
+      const su2double a = 1.0 + 0.01 * iPoint + iVar, b = 0.1 * (iVar + 1), c = (order == 2)? 0.05 : 0.0;
+      return a + b * iTime + c * iTime * iTime;
+    };
+
+    /*--- Push the time levels as the update of the dual time iteration does. ---*/
+
+    for (int iTime = -2; iTime <= 0; ++iTime) {
+      nodes->Set_Solution_time_n1();
+      for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          nodes->SetSolution(iPoint, iVar, exact(iPoint, iVar, iTime));
+      nodes->Set_Solution_time_n();
+    }
+
+    nodes->ExtrapolateSolution_time(order, {0});
+
+    bool isExact = true;
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        isExact &= (nodes->GetSolution(iPoint, iVar) == Approx(exact(iPoint, iVar, 1)));
+    CHECK(isExact);
+  }
+}
+
+TEST_CASE("Time extrapolation keeps the sign of positive variables", "[Dual Time]") {
+
+  BoxTestCase test(extrapolationOptions, EULER);
+
+  auto* nodes = test.solver[FLOW_SOL]->GetNodes();
+  const auto nVar = test.solver[FLOW_SOL]->GetnVar();
+
+  /*--- The density of point 0 decreases quickly (1, 0.5, 0.1), point 1 is linear. ---*/
+
+  const su2double density[][3] = {{1.0, 0.5, 0.1}, {1.0, 0.9, 0.8}};
+
+  for (int iTime = 0; iTime < 3; ++iTime) {
+    nodes->Set_Solution_time_n1();
+    for (auto iPoint = 0ul; iPoint < 2; ++iPoint) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) nodes->SetSolution(iPoint, iVar, iTime + 1.0);
+      nodes->SetSolution(iPoint, 0, density[iPoint][iTime]);
+    }
+    nodes->Set_Solution_time_n();
+  }
+
+  nodes->ExtrapolateSolution_time(2, {0});
+
+  /*--- 3*(0.1-0.5)+1 < 0, point 0 keeps all the variables at time n. ---*/
+  CHECK(nodes->GetSolution(0, 0) == Approx(0.1));
+  CHECK(nodes->GetSolution(0, 1) == Approx(3.0));
+
+  CHECK(nodes->GetSolution(1, 0) == Approx(0.7));
+  CHECK(nodes->GetSolution(1, 1) == Approx(4.0));
+}